@@ -51,6 +51,7 @@
 
 #include <type_traits>
 #include <algorithm>
+#include <numeric>
 
 #include <seqan/basic.h>
 #include <seqan/simd.h>
@@ -151,6 +152,7 @@
 #include <seqan/align/dp_matrix_navigator_score_matrix.h>
 #include <seqan/align/dp_matrix_navigator_score_matrix_sparse.h>
 #include <seqan/align/dp_matrix_navigator_trace_matrix.h>
+#include <seqan/align/dp_matrix_navigator_trace_matrix_packed.h>
 
 // Ensures the backwards compatibility for the global interfaces of the
 // alignment algorithms. Based on the called function this selects the
@@ -161,20 +163,23 @@
 #ifdef SEQAN_SIMD_ENABLED
 #include <seqan/align/dp_scout_simd.h>
 #include <seqan/align/dp_align_simd_helper.h>
+#include <seqan/align/dp_align_striped_impl.h>
 #endif  // SEQAN_SIMD_ENABLED
 
 // The actual implementations of the traceback and the dynamic programming that
 // is used by all different alignment algorithms.
 #include <seqan/align/dp_traceback_impl.h>
 #include <seqan/align/dp_algorithm_impl.h>
+#include <seqan/align/dp_align_difference_impl.h>
 
 //################################################################################
 // Old module
 //################################################################################
 
 // Also, we have an implementation of Hirschberg's algorithm to compute
-// alignments.
+// alignments, and its affine generalization by Myers and Miller.
 #include <seqan/align/global_alignment_hirschberg_impl.h>
+#include <seqan/align/global_alignment_myers_miller_impl.h>
 
 // The implementations of Myers' bitvector algorithm for alignments can only
 // compute alignment scores.  The combination of Hirschberg's and Myers'
@@ -182,6 +187,10 @@
 #include <seqan/align/global_alignment_myers_impl.h>
 #include <seqan/align/global_alignment_myers_hirschberg_impl.h>
 
+// The wavefront algorithms compute gap-affine alignments of similar sequences
+// in time proportional to their penalty.
+#include <seqan/align/global_alignment_wfa_impl.h>
+
 // Implementations of the local alignment algorithms with declumping.  We also
 // use them for the localAlignment() calls and return the best local alignment
 // only.
@@ -214,8 +223,9 @@
 #include <seqan/align/local_alignment_enumeration_banded.h>
 
 // The front-end functions for the more specialized alignment algorithms such as
-// Hirschberg, Myers and Myers-Hirschberg.
+// Hirschberg, Myers, Myers-Hirschberg and the striped SIMD algorithm.
 #include <seqan/align/global_alignment_specialized.h>
+#include <seqan/align/local_alignment_specialized.h>
 
 // ============================================================================
 // Operations On Alignments
@@ -88,6 +88,8 @@ typedef Tag<NeedlemanWunsch_> NeedlemanWunsch;
  * @headerfile <seqan/align.h>
  * @brief Tag for selecting Hirschberg's DP algorithm.
  *
+ * Affine gap scores select the generalization of Myers and Miller, which also needs only linear memory.
+ *
  * @signature struct Hirschberg_;
  * @signature typedef Tag<Hirschberg_> Hirschberg;
  */
@@ -119,6 +121,70 @@ typedef Tag<MyersBitVector_> MyersBitVector;
 struct MyersHirschberg_;
 typedef Tag<MyersHirschberg_> MyersHirschberg;
 
+/*!
+ * @tag AlignmentAlgorithmTags#Striped
+ * @headerfile <seqan/align.h>
+ * @brief Tag for selecting Farrar's striped SIMD DP algorithm for a single pair of sequences.
+ *
+ * Can be used for global and local alignments with linear or affine gap costs.  Falls back to the standard DP
+ * algorithm if SIMD is not enabled.
+ *
+ * @signature struct Striped_;
+ * @signature typedef Tag<Striped_> Striped;
+ */
+
+struct Striped_;
+typedef Tag<Striped_> Striped;
+
+/*!
+ * @tag AlignmentAlgorithmTags#Wfa
+ * @headerfile <seqan/align.h>
+ * @brief Tag for selecting the gap-affine wavefront algorithm (WFA).
+ *
+ * Runs in O(n s) time for sequences of length n whose alignment has the penalty s, which makes it fast for
+ * similar sequences.  Requires a @link SimpleScore @endlink with integral scores.  If the match score is not higher
+ * than the mismatch score and twice the gap extension score, or the gap open score is higher than the gap extension
+ * score, the alignment is computed by dynamic programming instead.
+ *
+ * @signature struct Wfa_;
+ * @signature typedef Tag<Wfa_> Wfa;
+ */
+
+struct Wfa_;
+typedef Tag<Wfa_> Wfa;
+
+/*!
+ * @tag AlignmentAlgorithmTags#BiWfa
+ * @headerfile <seqan/align.h>
+ * @brief Tag for selecting the bidirectional wavefront algorithm (BiWFA).
+ *
+ * Computes the same alignments as @link AlignmentAlgorithmTags#Wfa @endlink but needs memory linear in the
+ * penalty of the alignment instead of quadratic, which allows to align multi-megabase sequences.  Scoring schemes
+ * that the WFA does not support are aligned with @link AlignmentAlgorithmTags#Hirschberg @endlink.
+ *
+ * @signature struct BiWfa_;
+ * @signature typedef Tag<BiWfa_> BiWfa;
+ */
+
+struct BiWfa_;
+typedef Tag<BiWfa_> BiWfa;
+
+/*!
+ * @tag AlignmentAlgorithmTags#DifferenceRecurrence
+ * @headerfile <seqan/align.h>
+ * @brief Tag for selecting the banded affine alignment on score differences (Suzuki-Kasahara).
+ *
+ * Stores the differences between adjacent scores instead of the scores themselves, which fit into 8 bit, and
+ * computes the matrix by anti-diagonals so that the inner loop is vectorized.  Requires a @link SimpleScore @endlink
+ * or a score matrix whose scores and gap open score fit into 8 bit.
+ *
+ * @signature struct DifferenceRecurrence_;
+ * @signature typedef Tag<DifferenceRecurrence_> DifferenceRecurrence;
+ */
+
+struct DifferenceRecurrence_;
+typedef Tag<DifferenceRecurrence_> DifferenceRecurrence;
+
 // ----------------------------------------------------------------------------
 // Local Alignment Algorithm Tags
 // ----------------------------------------------------------------------------
@@ -1194,15 +1194,17 @@ _correctTraceValue(TTraceNavigator & traceNavigator,
 {
     _setToPosition(traceNavigator, maxHostPosition(dpScout));
 
+    // Read and write the trace value through the navigator, which also works for packed trace matrices.
+    typename TraceBitMap_<TScoreValue>::Type traceValue = scalarValue(traceNavigator);
     if (_verticalScoreOfCell(dpScout._maxScore) == _scoreOfCell(dpScout._maxScore))
     {
-        value(traceNavigator) &= ~TraceBitMap_<TScoreValue>::DIAGONAL;
-        value(traceNavigator) |= TraceBitMap_<TScoreValue>::MAX_FROM_VERTICAL_MATRIX;
+        traceValue &= ~TraceBitMap_<TScoreValue>::DIAGONAL;
+        assignValue(traceNavigator, traceValue | TraceBitMap_<TScoreValue>::MAX_FROM_VERTICAL_MATRIX);
     }
     else if (_horizontalScoreOfCell(dpScout._maxScore) == _scoreOfCell(dpScout._maxScore))
     {
-        value(traceNavigator) &= ~TraceBitMap_<TScoreValue>::DIAGONAL;
-        value(traceNavigator) |= TraceBitMap_<TScoreValue>::MAX_FROM_HORIZONTAL_MATRIX;
+        traceValue &= ~TraceBitMap_<TScoreValue>::DIAGONAL;
+        assignValue(traceNavigator, traceValue | TraceBitMap_<TScoreValue>::MAX_FROM_HORIZONTAL_MATRIX);
     }
 }
 
@@ -1431,7 +1433,7 @@ _computeAlignment(DPContext<TDPScoreValue, TTraceValue, TScoreMatHost, TTraceMat
     TDPTraceMatrixNavigator dpTraceMatrixNavigator{dpTraceMatrix, band};
 
     TDPScout dpScout(scoutState);
-#if SEQAN_ALIGN_SIMD_PROFILE
+#if defined(SEQAN_SIMD_ENABLED) && SEQAN_ALIGN_SIMD_PROFILE
     profile.preprTimer += sysTime() - timer;
     timer = sysTime();
 #endif
@@ -1439,7 +1441,7 @@ _computeAlignment(DPContext<TDPScoreValue, TTraceValue, TScoreMatHost, TTraceMat
     _computeAlignmentImpl(dpScout, dpScoreMatrixNavigator, dpTraceMatrixNavigator, seqH, seqV, scoreScheme, band,
                           dpProfile, TNavigationSpec{});
 
-#if SEQAN_ALIGN_SIMD_PROFILE
+#if defined(SEQAN_SIMD_ENABLED) && SEQAN_ALIGN_SIMD_PROFILE
     profile.alignTimer += sysTime() - timer;
     timer = sysTime();
 #endif
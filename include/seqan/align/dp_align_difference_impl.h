@@ -0,0 +1,531 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Banded affine alignment with the difference recurrence of Suzuki and
+// Kasahara (as in minimap2's ksw2).  Instead of the scores H, E and F the
+// kernel keeps the differences
+//
+//   u(i,j) = H(i,j) - H(i-1,j)       v(i,j) = H(i,j) - H(i,j-1)
+//   x(i,j) = E(i+1,j) - H(i,j)       y(i,j) = F(i,j+1) - H(i,j)
+//
+// which are bounded by the substitution and gap scores and therefore fit into
+// 8 bit.  The cells are computed by anti-diagonals, so the cells of one
+// anti-diagonal are independent and the inner loop is vectorized.  Here i is
+// the position in the vertical and j the position in the horizontal sequence.
+//
+// The absolute score H is only kept for the first cell of every
+// anti-diagonal, the scores of its other cells follow from the differences
+// H(i+1,j-1) - H(i,j) = u(i+1,j-1) - v(i,j).
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_ALIGN_DP_ALIGN_DIFFERENCE_IMPL_H_
+#define INCLUDE_SEQAN_ALIGN_DP_ALIGN_DIFFERENCE_IMPL_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class DifferenceTrace_
+// ----------------------------------------------------------------------------
+
+// Bits of the trace byte stored for every cell.
+struct DifferenceTrace_
+{
+    static const uint8_t DIAGONAL = 0;
+    static const uint8_t VERTICAL = 1;        // H(i,j) = E(i,j)
+    static const uint8_t HORIZONTAL = 2;      // H(i,j) = F(i,j)
+    static const uint8_t SOURCE_MASK = 3;
+    static const uint8_t EXTEND_VERTICAL = 4;     // E(i+1,j) extends E(i,j)
+    static const uint8_t EXTEND_HORIZONTAL = 8;   // F(i,j+1) extends F(i,j)
+};
+
+// ----------------------------------------------------------------------------
+// Class DifferenceMatrix_
+// ----------------------------------------------------------------------------
+
+// Working set of the difference recurrence.  The 8 bit arrays are indexed by i and hold the values of the last
+// anti-diagonal on which the cell of that row was computed.
+struct DifferenceMatrix_
+{
+    String<int8_t> sub;     // substitution scores of the current anti-diagonal
+    String<int8_t> u;
+    String<int8_t> y;
+    String<int8_t> v[2];    // previous and current anti-diagonal
+    String<int8_t> x[2];
+
+    String<uint8_t> trace;          // the trace bytes of all anti-diagonals, concatenated
+    String<size_t> traceBegin;      // begin of the trace of an anti-diagonal
+    String<int> first;              // the first row of an anti-diagonal
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _differenceScoreRange()
+// ----------------------------------------------------------------------------
+
+template <typename TScoreValue>
+inline bool
+_differenceScoreRange(int & minScore, int & maxScore, Score<TScoreValue, Simple> const & scoringScheme)
+{
+    minScore = _min(scoreMatch(scoringScheme), scoreMismatch(scoringScheme));
+    maxScore = _max(scoreMatch(scoringScheme), scoreMismatch(scoringScheme));
+    return true;
+}
+
+template <typename TScoreValue, typename TScoreSpec>
+inline SEQAN_FUNC_ENABLE_IF(IsScoreMatrix_<TScoreSpec>, bool)
+_differenceScoreRange(int & minScore, int & maxScore, Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef Score<TScoreValue, TScoreSpec> TScore;
+
+    minScore = maxScore = scoringScheme.data_tab[0];
+    for (unsigned i = 1; i < static_cast<unsigned>(TScore::TAB_SIZE); ++i)
+    {
+        minScore = _min(minScore, static_cast<int>(scoringScheme.data_tab[i]));
+        maxScore = _max(maxScore, static_cast<int>(scoringScheme.data_tab[i]));
+    }
+    return true;
+}
+
+template <typename TScoreValue, typename TScoreSpec>
+inline SEQAN_FUNC_DISABLE_IF(IsScoreMatrix_<TScoreSpec>, bool)
+_differenceScoreRange(int & /*minScore*/, int & /*maxScore*/, Score<TScoreValue, TScoreSpec> const & /*scoringScheme*/)
+{
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function _isDifferenceRecurrenceApplicable()
+// ----------------------------------------------------------------------------
+
+// The differences u and v lie in [-q-e, maxScore+q+e], x and y in [-q-e, -e], where q+e is the penalty of the first
+// gap character and e the one of every further one.
+template <typename TScoreValue, typename TScoreSpec>
+inline bool
+_isDifferenceRecurrenceApplicable(Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    int minScore = 0;
+    int maxScore = 0;
+    if (!_differenceScoreRange(minScore, maxScore, scoringScheme))
+        return false;
+
+    int const gapOpen = -static_cast<int>(scoreGapOpen(scoringScheme));
+    int const gapExtend = -static_cast<int>(scoreGapExtend(scoringScheme));
+    return gapExtend >= 0 && gapOpen >= gapExtend && minScore >= -128 && maxScore >= 0 &&
+           maxScore + gapOpen <= 127;
+}
+
+// ----------------------------------------------------------------------------
+// Function _differenceCell()
+// ----------------------------------------------------------------------------
+
+// Computes a cell at the border of the band or the matrix, where the upper or left neighbour may be missing, and
+// returns z(i,j) = H(i,j) - H(i-1,j-1).
+inline int
+_differenceCell(DifferenceMatrix_ & mat, int cur, int i, int j, int lowerDiag, int upperDiag,
+                int q, int e, uint8_t & trace)
+{
+    int const prev = 1 - cur;
+    int const d = j - i;
+    int const negInf = -(1 << 20);
+
+    // Upper neighbour (i-1,j).
+    bool const hasUp = d + 1 <= upperDiag;
+    int vUp = 0;
+    int xUp = 0;
+    if (hasUp)
+    {
+        if (i == 1)
+        {
+            vUp = (j == 1) ? -q - e : -e;
+            xUp = -q - e;
+        }
+        else
+        {
+            vUp = mat.v[prev][i - 1];
+            xUp = mat.x[prev][i - 1];
+        }
+    }
+
+    // Left neighbour (i,j-1).
+    bool const hasLeft = d - 1 >= lowerDiag;
+    int uLeft = 0;
+    int yLeft = 0;
+    if (hasLeft)
+    {
+        if (j == 1)
+        {
+            uLeft = (i == 1) ? -q - e : -e;
+            yLeft = -q - e;
+        }
+        else
+        {
+            uLeft = mat.u[i];
+            yLeft = mat.y[i];
+        }
+    }
+
+    int const zE = hasUp ? xUp + vUp : negInf;
+    int const zF = hasLeft ? yLeft + uLeft : negInf;
+    int z = mat.sub[i];
+    trace = DifferenceTrace_::DIAGONAL;
+    if (zE > z)
+    {
+        z = zE;
+        trace = DifferenceTrace_::VERTICAL;
+    }
+    if (zF > z)
+    {
+        z = zF;
+        trace = DifferenceTrace_::HORIZONTAL;
+    }
+    if (zE - z > -q)
+        trace |= DifferenceTrace_::EXTEND_VERTICAL;
+    if (zF - z > -q)
+        trace |= DifferenceTrace_::EXTEND_HORIZONTAL;
+
+    // The values that refer to a missing neighbour are never read.
+    mat.u[i] = hasUp ? z - vUp : 0;
+    mat.v[cur][i] = hasLeft ? z - uLeft : 0;
+    mat.x[cur][i] = _max(-q, zE - z) - e;
+    mat.y[i] = _max(-q, zF - z) - e;
+    return z;
+}
+
+// ----------------------------------------------------------------------------
+// Function _differenceAntiDiagonal()
+// ----------------------------------------------------------------------------
+
+// Computes the cells [iBegin, iEnd) of the anti-diagonal r = i + j, whose neighbours are all inside the band.  The
+// arrays are passed as restricted parameters, so that the compiler can vectorize the loop without alias checks.
+template <typename TTracebackConfig>
+inline void
+_differenceAntiDiagonal(int8_t const * SEQAN_RESTRICT sub,
+                        int8_t * SEQAN_RESTRICT u,
+                        int8_t * SEQAN_RESTRICT y,
+                        int8_t const * SEQAN_RESTRICT vPrev,
+                        int8_t const * SEQAN_RESTRICT xPrev,
+                        int8_t * SEQAN_RESTRICT vCur,
+                        int8_t * SEQAN_RESTRICT xCur,
+                        uint8_t * SEQAN_RESTRICT trace,
+                        int iBegin, int iEnd, int q, int e,
+                        TTracebackConfig const & /*tag*/)
+{
+    for (int i = iBegin; i < iEnd; ++i)
+    {
+        int const vUp = vPrev[i - 1];
+        int const uLeft = u[i];
+        int const zE = xPrev[i - 1] + vUp;
+        int const zF = y[i] + uLeft;
+        int const s = sub[i];
+        int const z = _max(s, _max(zE, zF));
+
+        SEQAN_IF_CONSTEXPR (IsTracebackEnabled_<TTracebackConfig>::VALUE)
+        {
+            uint8_t t = (zF > s && zF > zE) ? DifferenceTrace_::HORIZONTAL
+                                            : ((zE > s) ? DifferenceTrace_::VERTICAL : DifferenceTrace_::DIAGONAL);
+            t |= (zE - z > -q) ? DifferenceTrace_::EXTEND_VERTICAL : 0;
+            t |= (zF - z > -q) ? DifferenceTrace_::EXTEND_HORIZONTAL : 0;
+            trace[i - iBegin] = t;
+        }
+
+        u[i] = z - vUp;
+        vCur[i] = z - uLeft;
+        xCur[i] = _max(-q, zE - z) - e;
+        y[i] = _max(-q, zF - z) - e;
+    }
+}
+
+template <typename TTracebackConfig>
+inline void
+_differenceAntiDiagonal(DifferenceMatrix_ & mat, int cur, int iBegin, int iEnd, int q, int e, uint8_t * trace,
+                        TTracebackConfig const & tag)
+{
+    _differenceAntiDiagonal(begin(mat.sub, Standard()), begin(mat.u, Standard()), begin(mat.y, Standard()),
+                            begin(mat.v[1 - cur], Standard()), begin(mat.x[1 - cur], Standard()),
+                            begin(mat.v[cur], Standard()), begin(mat.x[cur], Standard()), trace,
+                            iBegin, iEnd, q, e, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function _differenceTraceValue()
+// ----------------------------------------------------------------------------
+
+inline uint8_t
+_differenceTraceValue(DifferenceMatrix_ const & mat, int i, int j)
+{
+    int const r = i + j;
+    return mat.trace[mat.traceBegin[r] + (i - mat.first[r])];
+}
+
+// ----------------------------------------------------------------------------
+// Function _differenceTraceback()
+// ----------------------------------------------------------------------------
+
+// Records the trace segments from the cell (i,j) back to the origin.
+template <typename TTraceSegments>
+inline void
+_differenceTraceback(TTraceSegments & traceSegments, DifferenceMatrix_ const & mat, int i, int j)
+{
+    typedef TraceBitMap_<> TTraceBitMap;
+
+    uint8_t state = DifferenceTrace_::DIAGONAL;
+    uint8_t runValue = TTraceBitMap::NONE;
+    int runLength = 0;
+    while (i > 0 || j > 0)
+    {
+        // The first row and column consist of a single gap.
+        if (i == 0)
+            state = DifferenceTrace_::HORIZONTAL;
+        else if (j == 0)
+            state = DifferenceTrace_::VERTICAL;
+        else if (state == DifferenceTrace_::DIAGONAL)
+            state = _differenceTraceValue(mat, i, j) & DifferenceTrace_::SOURCE_MASK;
+
+        uint8_t value = (state == DifferenceTrace_::DIAGONAL) ? TTraceBitMap::DIAGONAL :
+                        ((state == DifferenceTrace_::VERTICAL) ? TTraceBitMap::VERTICAL : TTraceBitMap::HORIZONTAL);
+        if (value != runValue)
+        {
+            _recordSegment(traceSegments, j, i, runLength, runValue);
+            runValue = value;
+            runLength = 0;
+        }
+        ++runLength;
+
+        if (state == DifferenceTrace_::DIAGONAL)
+        {
+            --i;
+            --j;
+        }
+        else if (state == DifferenceTrace_::VERTICAL)
+        {
+            // E(i,j) either extends E(i-1,j) or opens from H(i-1,j).
+            --i;
+            if (i == 0 || j == 0 || !(_differenceTraceValue(mat, i, j) & DifferenceTrace_::EXTEND_VERTICAL))
+                state = DifferenceTrace_::DIAGONAL;
+        }
+        else
+        {
+            --j;
+            if (i == 0 || j == 0 || !(_differenceTraceValue(mat, i, j) & DifferenceTrace_::EXTEND_HORIZONTAL))
+                state = DifferenceTrace_::DIAGONAL;
+        }
+    }
+    _recordSegment(traceSegments, j, i, runLength, runValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignDifferenceRecurrence()
+// ----------------------------------------------------------------------------
+
+// Aligns the sequences globally within the band [lowerDiag, upperDiag] of diagonals h - v.  If extension is true the
+// alignment may end in any cell and ends in the best one.  If zDrop is not negative the computation stops as soon as
+// the best score of an anti-diagonal drops more than zDrop below the best score so far, not counting the gap
+// extensions needed to get from the diagonal of the best cell to the diagonal of the anti-diagonal's best cell.
+// The band must contain the first cell and, for global alignments, the last one.
+template <typename TTraceSegments, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpec, typename TTracebackConfig>
+inline TScoreValue
+_alignDifferenceRecurrence(TTraceSegments & traceSegments,
+                           TSequenceH const & seqH,
+                           TSequenceV const & seqV,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           int lowerDiag,
+                           int upperDiag,
+                           bool extension,
+                           int zDrop,
+                           TTracebackConfig const & tag)
+{
+    int const n = length(seqH);
+    int const m = length(seqV);
+    int const e = -static_cast<int>(scoreGapExtend(scoringScheme));
+    int const q = -static_cast<int>(scoreGapOpen(scoringScheme)) - e;
+    bool const traceback = IsTracebackEnabled_<TTracebackConfig>::VALUE;
+
+    SEQAN_ASSERT(_isDifferenceRecurrenceApplicable(scoringScheme));
+    SEQAN_ASSERT_LEQ(lowerDiag, 0);
+    SEQAN_ASSERT_GEQ(upperDiag, 0);
+
+    lowerDiag = _max(lowerDiag, -m);
+    upperDiag = _min(upperDiag, n);
+
+    int bestI = 0;
+    int bestJ = 0;
+    int bestScore = 0;
+    if (m == 0 || n == 0)
+    {
+        // A single gap, or nothing if extending.
+        if (!extension)
+        {
+            SEQAN_ASSERT(lowerDiag <= n - m && n - m <= upperDiag);
+            bestI = m;
+            bestJ = n;
+            bestScore = (m + n == 0) ? 0 : -q - (m + n) * e;
+        }
+        if (traceback)
+            _differenceTraceback(traceSegments, DifferenceMatrix_(), bestI, bestJ);
+        return bestScore;
+    }
+    SEQAN_ASSERT(extension || (lowerDiag <= n - m && n - m <= upperDiag));
+
+    DifferenceMatrix_ mat;
+    resize(mat.sub, m + 1, 0, Exact());
+    resize(mat.u, m + 1, 0, Exact());
+    resize(mat.y, m + 1, 0, Exact());
+    for (unsigned k = 0; k < 2; ++k)
+    {
+        resize(mat.v[k], m + 1, 0, Exact());
+        resize(mat.x[k], m + 1, 0, Exact());
+    }
+    if (traceback)
+    {
+        resize(mat.traceBegin, m + n + 1, 0, Exact());
+        resize(mat.first, m + n + 1, 0, Exact());
+        // An anti-diagonal holds at most one cell of every second diagonal of the band.
+        reserve(mat.trace, static_cast<size_t>(m + n) * ((upperDiag - lowerDiag) / 2 + 1), Exact());
+    }
+
+    // The score of the first cell (iTop, rTop - iTop) of the last anti-diagonal with cells, starting at the origin.
+    int hTop = 0;
+    int iTop = 0;
+    int rTop = 0;
+
+    int cur = 0;
+    for (int r = 2; r <= m + n; ++r)
+    {
+        // Rows of the cells (i, r - i) inside the matrix and the band lowerDiag <= r - 2i <= upperDiag.
+        int const iBegin = _max(_max(1, r - n), (r - upperDiag + 1) >> 1);
+        int const iEnd = _min(_min(m, r - 1), (r - lowerDiag) >> 1) + 1;
+        if (iBegin >= iEnd)
+        {
+            // Only possible for a band of a single diagonal, whose cells lie on every second anti-diagonal.
+            continue;
+        }
+
+        for (int i = iBegin; i < iEnd; ++i)
+            mat.sub[i] = score(scoringScheme, seqH[r - i - 1], seqV[i - 1]);
+
+        uint8_t * trace = 0;
+        uint8_t dummy[2];
+        if (traceback)
+        {
+            mat.traceBegin[r] = length(mat.trace);
+            mat.first[r] = iBegin;
+            resize(mat.trace, length(mat.trace) + (iEnd - iBegin), Exact());
+            trace = begin(mat.trace, Standard()) + mat.traceBegin[r];
+        }
+
+        int const zTop = _differenceCell(mat, cur, iBegin, r - iBegin, lowerDiag, upperDiag, q, e,
+                                         traceback ? trace[0] : dummy[0]);
+        if (iEnd - iBegin > 1)
+        {
+            _differenceAntiDiagonal(mat, cur, iBegin + 1, iEnd - 1, q, e, traceback ? trace + 1 : 0, tag);
+            _differenceCell(mat, cur, iEnd - 1, r - iEnd + 1, lowerDiag, upperDiag, q, e,
+                            traceback ? trace[iEnd - 1 - iBegin] : dummy[1]);
+        }
+
+        // The first cell has its left, upper or, for a band of a single diagonal, its diagonal neighbour as the
+        // first cell of the last anti-diagonal.
+        if (rTop == r - 1 && iTop == iBegin)
+            hTop += mat.v[cur][iBegin];
+        else if (rTop == r - 1)
+            hTop += mat.u[iBegin];
+        else
+            hTop += zTop;
+        SEQAN_ASSERT(rTop == r - 1 ? (iTop == iBegin || iTop == iBegin - 1) : (rTop == r - 2 && iTop == iBegin - 1));
+        iTop = iBegin;
+        rTop = r;
+
+        if (extension)
+        {
+            int8_t const * u = begin(mat.u, Standard());
+            int8_t const * v = begin(mat.v[cur], Standard());
+            int h = hTop;
+            int maxH = hTop;
+            int maxI = iBegin;
+            for (int i = iBegin + 1; i < iEnd; ++i)
+            {
+                h += u[i] - v[i - 1];
+                if (h > maxH)
+                {
+                    maxH = h;
+                    maxI = i;
+                }
+            }
+
+            if (maxH > bestScore)
+            {
+                bestScore = maxH;
+                bestI = maxI;
+                bestJ = r - maxI;
+            }
+            else if (zDrop >= 0)
+            {
+                int const diagDistance = std::abs((r - 2 * maxI) - (bestJ - bestI));
+                if (bestScore - maxH > zDrop + diagDistance * e)
+                    break;
+            }
+        }
+
+        cur = 1 - cur;
+    }
+
+    if (!extension)
+    {
+        // The last anti-diagonal consists of the last cell only.
+        SEQAN_ASSERT_EQ(rTop, m + n);
+        bestI = m;
+        bestJ = n;
+        bestScore = hTop;
+    }
+    if (traceback)
+        _differenceTraceback(traceSegments, mat, bestI, bestJ);
+    return bestScore;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_ALIGN_DP_ALIGN_DIFFERENCE_IMPL_H_
@@ -44,12 +44,22 @@ struct AlignSimdProfile_
     double preprTimer = 0.0;
     double alignTimer = 0.0;
     double traceTimer = 0.0;
+    uint64_t usedCells = 0;      // DP cells of the aligned pairs.
+    uint64_t computedCells = 0;  // DP cells computed by all lanes, including the padding of shorter pairs.
 
     void clear()
     {
         preprTimer = 0.0;
         alignTimer = 0.0;
         traceTimer = 0.0;
+        usedCells = 0;
+        computedCells = 0;
+    }
+
+    // Fraction of the computed cells that belong to an aligned pair.
+    double laneUtilization() const
+    {
+        return (computedCells == 0) ? 1.0 : static_cast<double>(usedCells) / computedCells;
     }
 };
 
@@ -98,8 +108,9 @@ _createSimdRepImpl(TSimdVecs & vecs,
                    TStrings const & strs,
                    std::index_sequence<I...> const & /*unsued*/)
 {
+    // Store the ordinal values, converting an alphabet to 8 bit elements would yield its character instead.
     for (size_t pos = 0; pos < length(vecs); ++pos)
-        fillVector(vecs[pos], strs[I][pos]...);
+        fillVector(vecs[pos], ordValue(strs[I][pos])...);
 }
 
 template <typename TSimdVecs,
@@ -271,36 +282,235 @@ _prepareAndRunSimdAlignment(TResult & results,
 }
 
 // ----------------------------------------------------------------------------
-// Function _alignWrapperSimd(); Score; StringSet vs. StringSet
+// Function _sortSimdBatchPositions()
 // ----------------------------------------------------------------------------
 
-template <typename TSetH,
+// Orders the pairs by their lengths, such that every batch holds pairs of similar lengths.  All lanes of a batch are
+// computed up to the longest pair of the batch, so mixing short and long pairs leaves most lanes idle.
+template <typename TSetH, typename TSetV>
+inline void
+_sortSimdBatchPositions(String<unsigned> & positions,
+                        TSetH const & stringsH,
+                        TSetV const & stringsV)
+{
+    std::stable_sort(begin(positions, Standard()), end(positions, Standard()),
+                     [&](unsigned const lhs, unsigned const rhs)
+                     {
+                         return std::make_pair(length(stringsH[lhs]), length(stringsV[lhs])) <
+                                std::make_pair(length(stringsH[rhs]), length(stringsV[rhs]));
+                     });
+}
+
+#if SEQAN_ALIGN_SIMD_PROFILE
+// ----------------------------------------------------------------------------
+// Function _recordSimdLaneUtilization()
+// ----------------------------------------------------------------------------
+
+// Records the cells of the first numUsed pairs of a batch and the cells computed for the whole batch.
+template <typename TSetH, typename TSetV>
+inline void
+_recordSimdLaneUtilization(TSetH const & batchH,
+                           TSetV const & batchV,
+                           unsigned const numUsed)
+{
+    uint64_t maxH = 0;
+    uint64_t maxV = 0;
+    for (unsigned i = 0; i < length(batchH); ++i)
+    {
+        maxH = std::max<uint64_t>(maxH, length(batchH[i]));
+        maxV = std::max<uint64_t>(maxV, length(batchV[i]));
+        if (i < numUsed)
+            profile.usedCells += static_cast<uint64_t>(length(batchH[i])) * length(batchV[i]);
+    }
+    profile.computedCells += length(batchH) * maxH * maxV;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// Function _substitutionScoreRange()
+// ----------------------------------------------------------------------------
+
+template <typename TScoreValue, typename TScoreSpec>
+inline SEQAN_FUNC_DISABLE_IF(IsScoreMatrix_<TScoreSpec>, void)
+_substitutionScoreRange(int64_t & minScore,
+                        int64_t & maxScore,
+                        Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    minScore = std::min<int64_t>(scoreMatch(scoringScheme), scoreMismatch(scoringScheme));
+    maxScore = std::max<int64_t>(scoreMatch(scoringScheme), scoreMismatch(scoringScheme));
+}
+
+template <typename TScoreValue, typename TScoreSpec>
+inline SEQAN_FUNC_ENABLE_IF(IsScoreMatrix_<TScoreSpec>, void)
+_substitutionScoreRange(int64_t & minScore,
+                        int64_t & maxScore,
+                        Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef Score<TScoreValue, TScoreSpec> TScore;
+
+    minScore = maxScore = scoringScheme.data_tab[0];
+    for (unsigned i = 1; i < static_cast<unsigned>(TScore::TAB_SIZE); ++i)
+    {
+        minScore = std::min<int64_t>(minScore, scoringScheme.data_tab[i]);
+        maxScore = std::max<int64_t>(maxScore, scoringScheme.data_tab[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _maxSimdScoreStep()
+// ----------------------------------------------------------------------------
+
+// The largest absolute value added to a cell in a single step of the recursion.
+template <typename TScoreValue, typename TScoreSpec>
+inline int64_t
+_maxSimdScoreStep(Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    int64_t minScore, maxScore;
+    _substitutionScoreRange(minScore, maxScore, scoringScheme);
+
+    return std::max(std::max(std::abs(minScore), std::abs(maxScore)),
+                    std::max(std::abs(static_cast<int64_t>(scoreGapOpen(scoringScheme))),
+                             std::abs(static_cast<int64_t>(scoreGapExtend(scoringScheme)))));
+}
+
+// ----------------------------------------------------------------------------
+// Function _maxSimdSequenceValue()
+// ----------------------------------------------------------------------------
+
+// The largest value stored in the SIMD representation of the sequences.
+// Score matrices store the offset into the data table (see _precomputeScoreMatrixOffset()).
+template <typename TScoreValue, typename TScoreSpec>
+inline SEQAN_FUNC_DISABLE_IF(IsScoreMatrix_<TScoreSpec>, int64_t)
+_maxSimdSequenceValue(Score<TScoreValue, TScoreSpec> const & /*scoringScheme*/)
+{
+    return 0;
+}
+
+template <typename TScoreValue, typename TScoreSpec>
+inline SEQAN_FUNC_ENABLE_IF(IsScoreMatrix_<TScoreSpec>, int64_t)
+_maxSimdSequenceValue(Score<TScoreValue, TScoreSpec> const & /*scoringScheme*/)
+{
+    return static_cast<int64_t>(Score<TScoreValue, TScoreSpec>::TAB_SIZE) - 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _fitsSimdScoreValue()
+// ----------------------------------------------------------------------------
+
+// Returns true if a pair of sequences with the given lengths can be stored in TValue elements.  The kernel uses
+// wrapping arithmetic and half of the lowest value as infinity, so every single step of the recursion has to be
+// smaller than the infinity.
+template <typename TValue, typename TScoreValue, typename TScoreSpec>
+inline bool
+_fitsSimdElements(Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                  int64_t const lengthH,
+                  int64_t const lengthV)
+{
+    int64_t const maxValue = std::numeric_limits<TValue>::max();
+    int64_t const infinity = -static_cast<int64_t>(std::numeric_limits<TValue>::lowest()) / 2;
+
+    if (scoreGapOpen(scoringScheme) > 0 || scoreGapExtend(scoringScheme) > 0)
+        return false;
+    if (std::max(lengthH, lengthV) > maxValue || _maxSimdSequenceValue(scoringScheme) > maxValue)
+        return false;
+    return _maxSimdScoreStep(scoringScheme) < infinity;
+}
+
+// Local alignments are computed optimistically: their values are never negative and only an overflow of the
+// maximum can corrupt them, which is detected afterwards by _isSimdScoreSaturated().
+template <typename TValue, typename TScoreValue, typename TScoreSpec, typename TSpec>
+inline bool
+_fitsSimdScoreValue(Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                    int64_t const lengthH,
+                    int64_t const lengthV,
+                    LocalAlignment_<TSpec> const & /*algo*/)
+{
+    return _fitsSimdElements<TValue>(scoringScheme, lengthH, lengthV);
+}
+
+// Global alignments are only computed if no value can leave the range between the infinity and the maximal value.
+// No path scores more than only matches, and every cell is reached by a diagonal followed by a gap, which costs at
+// most the gap open plus the larger of a mismatch and a gap extension per position.
+template <typename TValue, typename TScoreValue, typename TScoreSpec, typename TSpec>
+inline bool
+_fitsSimdScoreValue(Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                    int64_t const lengthH,
+                    int64_t const lengthV,
+                    GlobalAlignment_<TSpec> const & /*algo*/)
+{
+    if (!_fitsSimdElements<TValue>(scoringScheme, lengthH, lengthV))
+        return false;
+
+    int64_t const maxValue = std::numeric_limits<TValue>::max();
+    int64_t const infinity = -static_cast<int64_t>(std::numeric_limits<TValue>::lowest()) / 2;
+
+    int64_t minScore, maxScore;
+    _substitutionScoreRange(minScore, maxScore, scoringScheme);
+
+    int64_t const match = std::max<int64_t>(maxScore, 0);
+    int64_t const mismatch = std::max<int64_t>(-minScore, 0);
+    int64_t const gapOpen = -static_cast<int64_t>(scoreGapOpen(scoringScheme));
+    int64_t const gapExtend = -static_cast<int64_t>(scoreGapExtend(scoringScheme));
+
+    int64_t const maxPathScore = match * std::min(lengthH, lengthV);
+    int64_t const maxPathPenalty = gapOpen + std::max(mismatch, gapExtend) * std::max(lengthH, lengthV);
+    return maxPathScore <= maxValue && maxPathPenalty + _maxSimdScoreStep(scoringScheme) < infinity;
+}
+
+// ----------------------------------------------------------------------------
+// Function _isSimdScoreSaturated()
+// ----------------------------------------------------------------------------
+
+// Returns true if the score computed with TValue elements might be corrupted by an overflow.  A cell of a local
+// alignment can only overflow if its diagonal predecessor is larger than the maximal value minus the match score,
+// and this predecessor is tracked as best score.
+template <typename TValue, typename TScoreValue, typename TScoreSpec, typename TSpec>
+inline bool
+_isSimdScoreSaturated(TScoreValue const score,
+                      Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                      LocalAlignment_<TSpec> const & /*algo*/)
+{
+    int64_t minScore, maxScore;
+    _substitutionScoreRange(minScore, maxScore, scoringScheme);
+    return static_cast<int64_t>(score) > static_cast<int64_t>(std::numeric_limits<TValue>::max()) - maxScore;
+}
+
+// Global alignments are only computed if they cannot overflow.
+template <typename TValue, typename TScoreValue, typename TScoreSpec, typename TSpec>
+inline bool
+_isSimdScoreSaturated(TScoreValue const /*score*/,
+                      Score<TScoreValue, TScoreSpec> const & /*scoringScheme*/,
+                      GlobalAlignment_<TSpec> const & /*algo*/)
+{
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignWrapperSimdBatches()
+// ----------------------------------------------------------------------------
+
+// Computes the scores of the pairs at the given positions in batches of TSimdAlign lanes.
+template <typename TSimdAlign,
+          typename TResults,
+          typename TPositions,
+          typename TSetH,
           typename TSetV,
           typename TScoreValue, typename TScoreSpec,
           typename TAlignConfig,
-          typename TGapModel,
-          std::enable_if_t<And<And<Is<ContainerConcept<TSetH>>,
-                                   Is<ContainerConcept<typename Value<TSetH>::Type>>>,
-                               And<Is<ContainerConcept<TSetV>>,
-                                   Is<ContainerConcept<typename Value<TSetV>::Type>>>
-                               >::VALUE,
-                          int> = 0>
-inline auto
-_alignWrapperSimd(TSetH const & stringsH,
-                  TSetV const & stringsV,
-                  Score<TScoreValue, TScoreSpec> const & scoringScheme,
-                  TAlignConfig const & config,
-                  TGapModel const & /*gaps*/)
+          typename TGapModel>
+inline void
+_alignWrapperSimdBatches(TResults & results,
+                         TPositions const & positions,
+                         TSetH const & stringsH,
+                         TSetV const & stringsV,
+                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                         TAlignConfig const & config,
+                         TGapModel const & /*gaps*/)
 {
-    typedef typename SimdVector<TScoreValue>::Type TSimdAlign;
-
-    unsigned const numAlignments = length(stringsV);
+    unsigned const numAlignments = length(positions);
     unsigned const sizeBatch = LENGTH<TSimdAlign>::VALUE;
     unsigned const fullSize = sizeBatch * ((numAlignments + sizeBatch - 1) / sizeBatch);
 
-    String<TScoreValue> results;
-    resize(results, numAlignments);
-
     StringSet<String<Nothing> > trace;  // We need to declare it, but it will not be used.
 
     // Create a SIMD scoring scheme.
@@ -308,44 +518,168 @@ _alignWrapperSimd(TSetH const & stringsH,
 
     for (auto pos = 0u; pos < fullSize; pos += sizeBatch)
     {
-        TSimdAlign resultsBatch;
-        if (SEQAN_UNLIKELY(numAlignments < pos + sizeBatch))
+        // Fill the last batch with the last pair.
+        StringSet<std::remove_const_t<typename Value<TSetH>::Type>, Dependent<> > depSetH;
+        StringSet<std::remove_const_t<typename Value<TSetV>::Type>, Dependent<> > depSetV;
+        for (unsigned i = pos; i < pos + sizeBatch; ++i)
         {
-            StringSet<std::remove_const_t<typename Value<TSetH>::Type>, Dependent<> > depSetH;
-            StringSet<std::remove_const_t<typename Value<TSetV>::Type>, Dependent<> > depSetV;
-            for (unsigned i = pos; i < fullSize; ++i)
-            {
-                if (i >= numAlignments)
-                {
-                    appendValue(depSetH, back(stringsH));
-                    appendValue(depSetV, back(stringsV));
-                }
-                else
-                {
-                    appendValue(depSetH, stringsH[i]);
-                    appendValue(depSetV, stringsV[i]);
-                }
-            }
-            SEQAN_ASSERT_EQ(length(depSetH), sizeBatch);
-            SEQAN_ASSERT_EQ(length(depSetV), sizeBatch);
-
-            _prepareAndRunSimdAlignment(resultsBatch, trace, depSetH, depSetV, simdScoringScheme, config, TGapModel());
+            auto const id = positions[std::min(i, numAlignments - 1)];
+            appendValue(depSetH, stringsH[id]);
+            appendValue(depSetV, stringsV[id]);
         }
-        else
-        {
-            auto infSetH = infixWithLength(stringsH, pos, sizeBatch);
-            auto infSetV = infixWithLength(stringsV, pos, sizeBatch);
 
-            _prepareAndRunSimdAlignment(resultsBatch, trace, infSetH, infSetV, simdScoringScheme, config, TGapModel());
-        }
+        TSimdAlign resultsBatch;
+        _prepareAndRunSimdAlignment(resultsBatch, trace, depSetH, depSetV, simdScoringScheme, config, TGapModel());
+#if SEQAN_ALIGN_SIMD_PROFILE
+        _recordSimdLaneUtilization(depSetH, depSetV, std::min(sizeBatch, numAlignments - pos));
+#endif
 
-        // TODO(rrahn): Could be parallelized!
-        for(auto x = pos; x < pos + sizeBatch && x < numAlignments; ++x)
-            results[x] = resultsBatch[x - pos];
+        for (auto x = pos; x < pos + sizeBatch && x < numAlignments; ++x)
+            results[positions[x]] = resultsBatch[x - pos];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignWrapperSimdNarrow()
+// ----------------------------------------------------------------------------
+
+// Computes the scores of all pairs that fit into TValue lanes and removes them from the positions, unless their
+// scores might have overflowed.  Those pairs are kept and computed again in wider lanes.
+template <typename TValue,
+          typename TResults,
+          typename TSetH,
+          typename TSetV,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlgo, typename TFreeEndGaps, typename TTraceback,
+          typename TGapModel>
+inline void
+_alignWrapperSimdNarrow(TResults & results,
+                        String<unsigned> & positions,
+                        TSetH const & stringsH,
+                        TSetV const & stringsV,
+                        Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                        AlignConfig2<TAlgo, DPBandConfig<BandOff>, TFreeEndGaps, TTraceback> const & config,
+                        TGapModel const & /*gaps*/,
+                        std::true_type const & /*isNarrower*/)
+{
+    String<unsigned> narrowPositions;
+    for (unsigned i = 0; i < length(positions); ++i)
+    {
+        unsigned const id = positions[i];
+        if (_fitsSimdScoreValue<TValue>(scoringScheme, length(stringsH[id]), length(stringsV[id]), TAlgo()))
+            appendValue(narrowPositions, id);
+    }
+
+    _alignWrapperSimdBatches<typename SimdVector<TValue>::Type>(results, narrowPositions, stringsH, stringsV,
+                                                                scoringScheme, config, TGapModel());
+
+    // The narrow positions are a subsequence of the positions, so the remaining ones keep their order.
+    String<unsigned> widePositions;
+    for (unsigned i = 0, j = 0; i < length(positions); ++i)
+    {
+        unsigned const id = positions[i];
+        if (j < length(narrowPositions) && narrowPositions[j] == id)
+        {
+            ++j;
+            if (!_isSimdScoreSaturated<TValue>(results[id], scoringScheme, TAlgo()))
+                continue;
+        }
+        appendValue(widePositions, id);
     }
+    swap(positions, widePositions);
+}
+
+// Banded alignments and score value types that are not wider than TValue are computed with the score value type.
+template <typename TValue,
+          typename TResults,
+          typename TSetH,
+          typename TSetV,
+          typename TScore,
+          typename TAlignConfig,
+          typename TGapModel,
+          typename TIsNarrower>
+inline void
+_alignWrapperSimdNarrow(TResults & /*results*/,
+                        String<unsigned> & /*positions*/,
+                        TSetH const & /*stringsH*/,
+                        TSetV const & /*stringsV*/,
+                        TScore const & /*scoringScheme*/,
+                        TAlignConfig const & /*config*/,
+                        TGapModel const & /*gaps*/,
+                        TIsNarrower const & /*isNarrower*/)
+{}
+
+// ----------------------------------------------------------------------------
+// Function _alignWrapperSimdAdaptive()
+// ----------------------------------------------------------------------------
+
+// Computes the scores of all pairs in the narrowest lanes that do not overflow for them: first in 8 bit lanes,
+// then the remaining pairs in 16 bit lanes and the rest with the score value type. Narrower lanes compute
+// more alignments per instruction, e.g. 32 instead of 8 alignments with AVX2 for 32 bit scores.
+// Score matrices start with 16 bit lanes, as the offsets into their data table do not fit into 8 bit elements
+// and there is no 8 bit gather.
+template <typename TSetH,
+          typename TSetV,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlignConfig,
+          typename TGapModel>
+inline String<TScoreValue>
+_alignWrapperSimdAdaptive(TSetH const & stringsH,
+                          TSetV const & stringsV,
+                          Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                          TAlignConfig const & config,
+                          TGapModel const & /*gaps*/)
+{
+    typedef std::integral_constant<bool, std::is_integral<TScoreValue>::value &&
+                                         !IsScoreMatrix_<TScoreSpec>::VALUE &&
+                                         (sizeof(int8_t) < sizeof(TScoreValue))>    TIsNarrower8;
+    typedef std::integral_constant<bool, std::is_integral<TScoreValue>::value &&
+                                         (sizeof(int16_t) < sizeof(TScoreValue))>   TIsNarrower16;
+
+    unsigned const numAlignments = length(stringsV);
+
+    String<TScoreValue> results;
+    resize(results, numAlignments);
+
+    String<unsigned> positions;
+    resize(positions, numAlignments, Exact());
+    std::iota(begin(positions, Standard()), end(positions, Standard()), 0u);
+    _sortSimdBatchPositions(positions, stringsH, stringsV);
+
+    _alignWrapperSimdNarrow<int8_t>(results, positions, stringsH, stringsV, scoringScheme, config, TGapModel(),
+                                    TIsNarrower8());
+    _alignWrapperSimdNarrow<int16_t>(results, positions, stringsH, stringsV, scoringScheme, config, TGapModel(),
+                                     TIsNarrower16());
+    _alignWrapperSimdBatches<typename SimdVector<TScoreValue>::Type>(results, positions, stringsH, stringsV,
+                                                                     scoringScheme, config, TGapModel());
     return results;
 }
 
+// ----------------------------------------------------------------------------
+// Function _alignWrapperSimd(); Score; StringSet vs. StringSet
+// ----------------------------------------------------------------------------
+
+template <typename TSetH,
+          typename TSetV,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlignConfig,
+          typename TGapModel,
+          std::enable_if_t<And<And<Is<ContainerConcept<TSetH>>,
+                                   Is<ContainerConcept<typename Value<TSetH>::Type>>>,
+                               And<Is<ContainerConcept<TSetV>>,
+                                   Is<ContainerConcept<typename Value<TSetV>::Type>>>
+                               >::VALUE,
+                          int> = 0>
+inline auto
+_alignWrapperSimd(TSetH const & stringsH,
+                  TSetV const & stringsV,
+                  Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                  TAlignConfig const & config,
+                  TGapModel const & /*gaps*/)
+{
+    return _alignWrapperSimdAdaptive(stringsH, stringsV, scoringScheme, config, TGapModel());
+}
+
 // ----------------------------------------------------------------------------
 // Function _alignWrapperSimd(); Score; String vs. StringSet
 // ----------------------------------------------------------------------------
@@ -368,52 +702,13 @@ _alignWrapperSimd(TSeqH const & stringH,
                   TAlignConfig const & config,
                   TGapModel const & /*gaps*/)
 {
-    typedef typename SimdVector<TScoreValue>::Type TSimdAlign;
-
-    unsigned const numAlignments = length(stringsV);
-    unsigned const sizeBatch = LENGTH<TSimdAlign>::VALUE;
-    unsigned const fullSize = sizeBatch * ((numAlignments + sizeBatch - 1) / sizeBatch);
-
-    String<TScoreValue> results;
-    resize(results, numAlignments);
-
-    // Prepare strings.
+    // Pair the horizontal sequence with every vertical sequence.
     StringSet<TSeqH, Dependent<> > setH;
-    for (auto i = 0u; i < sizeBatch; ++i)
+    reserve(setH, length(stringsV), Exact());
+    for (auto i = 0u; i < length(stringsV); ++i)
         appendValue(setH, stringH);
 
-    StringSet<String<Nothing> > trace;  // We need to declare it, but it will not be used.
-
-    // Create a SIMD scoring scheme.
-    Score<TSimdAlign, ScoreSimdWrapper<Score<TScoreValue, TScoreSpec> > > simdScoringScheme(scoringScheme);
-
-    for (auto pos = 0u; pos < fullSize; pos += sizeBatch)
-    {
-        TSimdAlign resultsBatch;
-        if (SEQAN_UNLIKELY(numAlignments < pos + sizeBatch))
-        {
-            StringSet<std::remove_const_t<typename Value<TSetV>::Type>, Dependent<> > depSetV;
-            for (unsigned i = pos; i < fullSize; ++i)
-            {
-                if (i >= numAlignments)
-                    appendValue(depSetV, back(stringsV));
-                else
-                    appendValue(depSetV, stringsV[i]);
-            }
-            SEQAN_ASSERT_EQ(length(depSetV), sizeBatch);
-
-            _prepareAndRunSimdAlignment(resultsBatch, trace, setH, depSetV, simdScoringScheme, config, TGapModel());
-        }
-        else
-        {
-            auto infSetV = infixWithLength(stringsV, pos, sizeBatch);
-            _prepareAndRunSimdAlignment(resultsBatch, trace, setH, infSetV, simdScoringScheme, config, TGapModel());
-        }
-        // TODO(rrahn): Could be parallelized!
-        for(auto x = pos; x < pos + sizeBatch && x < numAlignments; ++x)
-            results[x] = resultsBatch[x - pos];
-    }
-    return results;
+    return _alignWrapperSimdAdaptive(setH, stringsV, scoringScheme, config, TGapModel());
 }
 
 // ----------------------------------------------------------------------------
@@ -460,23 +755,31 @@ _alignWrapperSimd(TSetH & gapSeqSetH,
     // Create a SIMD scoring scheme.
     Score<TSimdAlign, ScoreSimdWrapper<Score<TScoreValue, TScoreSpec> > > simdScoringScheme(scoringScheme);
 
-    // Prepare string sets with sequences.
+    // Prepare string sets with sequences, ordered by their lengths and filled up with the longest pair.
+    StringSet<std::remove_const_t<typename Source<TGapSequenceH>::Type>, Dependent<> > sourceSetH;
+    StringSet<std::remove_const_t<typename Source<TGapSequenceV>::Type>, Dependent<> > sourceSetV;
+    reserve(sourceSetH, numAlignments);
+    reserve(sourceSetV, numAlignments);
+    for (unsigned i = 0; i < numAlignments; ++i)
+    {
+        appendValue(sourceSetH, source(gapSeqSetH[i]));
+        appendValue(sourceSetV, source(gapSeqSetV[i]));
+    }
+
+    String<unsigned> positions;
+    resize(positions, numAlignments, Exact());
+    std::iota(begin(positions, Standard()), end(positions, Standard()), 0u);
+    _sortSimdBatchPositions(positions, sourceSetH, sourceSetV);
+
     StringSet<std::remove_const_t<typename Source<TGapSequenceH>::Type>, Dependent<> > depSetH;
     StringSet<std::remove_const_t<typename Source<TGapSequenceV>::Type>, Dependent<> > depSetV;
     reserve(depSetH, fullSize);
     reserve(depSetV, fullSize);
     for (unsigned i = 0; i < fullSize; ++i)
     {
-        if (i >= numAlignments)
-        {
-            appendValue(depSetH, source(back(gapSeqSetH)));
-            appendValue(depSetV, source(back(gapSeqSetV)));
-        }
-        else
-        {
-            appendValue(depSetH, source(gapSeqSetH[i]));
-            appendValue(depSetV, source(gapSeqSetV[i]));
-        }
+        auto const id = positions[std::min(i, numAlignments - 1)];
+        appendValue(depSetH, sourceSetH[id]);
+        appendValue(depSetV, sourceSetV[id]);
     }
 
     // Run alignments in batches.
@@ -491,14 +794,17 @@ _alignWrapperSimd(TSetH & gapSeqSetH,
         resize(trace, sizeBatch, Exact());
 
         _prepareAndRunSimdAlignment(resultsBatch, trace, infSetH, infSetV, simdScoringScheme, config, TGapModel());
+#if SEQAN_ALIGN_SIMD_PROFILE
+        _recordSimdLaneUtilization(infSetH, infSetV, std::min(sizeBatch, numAlignments - pos));
+#endif
 
         // copy results and finish traceback
         // TODO(rrahn): Could be parallelized!
         // to for_each call
         for(auto x = pos; x < pos + sizeBatch && x < numAlignments; ++x)
         {
-            results[x] = resultsBatch[x - pos];
-            _adaptTraceSegmentsTo(gapSeqSetH[x], gapSeqSetV[x], trace[x - pos]);
+            results[positions[x]] = resultsBatch[x - pos];
+            _adaptTraceSegmentsTo(gapSeqSetH[positions[x]], gapSeqSetV[positions[x]], trace[x - pos]);
         }
 #if SEQAN_ALIGN_SIMD_PROFILE
         profile.traceTimer += sysTime() - timer;
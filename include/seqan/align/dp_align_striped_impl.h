@@ -0,0 +1,393 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Striped (Farrar) intra-sequence vectorization of a single pairwise
+// alignment.  The vertical sequence is split into LENGTH<TSimdVector>
+// stripes, one per lane, such that the cells of one column that are computed
+// together never depend on each other.  The vertical dependencies across the
+// stripes are resolved by the lazy-F loop.  The traceback stores the scores
+// of the DP matrix and recovers the predecessors by recomputation.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_ALIGN_DP_ALIGN_STRIPED_IMPL_H_
+#define INCLUDE_SEQAN_ALIGN_DP_ALIGN_STRIPED_IMPL_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _stripedShiftIn()
+// ----------------------------------------------------------------------------
+
+// Moves every element one lane up and inserts the given value into the first lane.
+template <typename TSimdVector, typename TValue>
+inline TSimdVector
+_stripedShiftIn(TSimdVector const & vector, TValue const value)
+{
+    TSimdVector result = vector;
+    for (unsigned k = LENGTH<TSimdVector>::VALUE - 1; k > 0; --k)
+        assignValue(result, k, getValue(vector, k - 1));
+    assignValue(result, 0, value);
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function _stripedAnyGreater()
+// ----------------------------------------------------------------------------
+
+template <typename TSimdVector>
+inline bool
+_stripedAnyGreater(TSimdVector const & a, TSimdVector const & b)
+{
+    auto const mask = cmpGt(a, b);
+    for (unsigned k = 0; k < LENGTH<TSimdVector>::VALUE; ++k)
+        if (mask[k])
+            return true;
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function _stripedCellScore()
+// ----------------------------------------------------------------------------
+
+// Returns the score of cell (row, col) of the DP matrix, including the initialized first row and column.
+template <typename TValue, typename TScores, typename TAlgo>
+inline int64_t
+_stripedCellScore(TScores const & scores,
+                  size_t const segLen,
+                  size_t const row,
+                  size_t const col,
+                  int64_t const gapOpen,
+                  int64_t const gapExtend,
+                  TAlgo const & /*algo*/)
+{
+    if (row == 0 || col == 0)
+    {
+        if (IsSameType<TAlgo, DPLocal>::VALUE || row + col == 0)
+            return 0;
+        return gapOpen + static_cast<int64_t>(row + col - 1) * gapExtend;
+    }
+    return static_cast<TValue>(getValue(scores[(col - 1) * segLen + (row - 1) % segLen], (row - 1) / segLen));
+}
+
+// ----------------------------------------------------------------------------
+// Function _stripedTraceback()
+// ----------------------------------------------------------------------------
+
+// Traces back from cell (row, col) and records the segments from the end to the begin of the alignment.  The score
+// of a cell is either the diagonal predecessor plus the substitution score or the score of the cell k steps to the
+// left or above plus the costs of a gap of length k.  The gaps are searched in both directions with increasing
+// length, so the traceback needs time linear in the length of the alignment.
+template <typename TValue, typename TTraceSegments, typename TScores, typename TSeqH, typename TSeqV,
+          typename TScoreValue, typename TScoreSpec, typename TAlgo>
+inline void
+_stripedTraceback(TTraceSegments & traceSegments,
+                  TScores const & scores,
+                  size_t const segLen,
+                  size_t row,
+                  size_t col,
+                  TSeqH const & seqH,
+                  TSeqV const & seqV,
+                  Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                  TAlgo const & /*algo*/)
+{
+    typedef TraceBitMap_<> TTraceBitMap;
+
+    int64_t const gapOpen = scoreGapOpen(scoringScheme);
+    int64_t const gapExtend = scoreGapExtend(scoringScheme);
+    auto cellScore = [&](size_t const r, size_t const c)
+    {
+        return _stripedCellScore<TValue>(scores, segLen, r, c, gapOpen, gapExtend, TAlgo());
+    };
+
+    size_t diagonal = 0;
+    while (row > 0 && col > 0)
+    {
+        int64_t const current = cellScore(row, col);
+        if (IsSameType<TAlgo, DPLocal>::VALUE && current == 0)
+            break;
+
+        if (current == cellScore(row - 1, col - 1) + score(scoringScheme, seqH[col - 1], seqV[row - 1]))
+        {
+            ++diagonal;
+            --row;
+            --col;
+            continue;
+        }
+
+        _recordSegment(traceSegments, col, row, diagonal, TTraceBitMap::DIAGONAL);
+        diagonal = 0;
+        for (size_t k = 1; ; ++k)
+        {
+            SEQAN_ASSERT_LEQ(k, std::max(row, col));
+            int64_t const gapScore = gapOpen + static_cast<int64_t>(k - 1) * gapExtend;
+            if (k <= col && current == cellScore(row, col - k) + gapScore)
+            {
+                col -= k;
+                _recordSegment(traceSegments, col, row, k, TTraceBitMap::HORIZONTAL);
+                break;
+            }
+            if (k <= row && current == cellScore(row - k, col) + gapScore)
+            {
+                row -= k;
+                _recordSegment(traceSegments, col, row, k, TTraceBitMap::VERTICAL);
+                break;
+            }
+        }
+    }
+    _recordSegment(traceSegments, col, row, diagonal, TTraceBitMap::DIAGONAL);
+
+    if (IsSameType<TAlgo, DPGlobal>::VALUE)
+    {
+        _recordSegment(traceSegments, 0, row, col, TTraceBitMap::HORIZONTAL);
+        _recordSegment(traceSegments, 0, 0, row, TTraceBitMap::VERTICAL);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignStripedImpl()
+// ----------------------------------------------------------------------------
+
+// Computes the alignment of seqH (columns) and seqV (rows) with the striped kernel on TSimdVector.  With the
+// traceback enabled, all columns of the score matrix are kept, otherwise only the previous one.
+template <typename TSimdVector, typename TTraceSegments, typename TSeqH, typename TSeqV,
+          typename TScoreValue, typename TScoreSpec, typename TAlgo, typename TTraceFlag>
+inline TScoreValue
+_alignStripedImpl(TTraceSegments & traceSegments,
+                  TSeqH const & seqH,
+                  TSeqV const & seqV,
+                  Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                  TAlgo const & /*algo*/,
+                  TTraceFlag const & /*traceFlag*/)
+{
+    typedef typename Value<TSimdVector>::Type                   TValue;
+    typedef String<TSimdVector, Alloc<OverAligned> >            TVectorString;
+    typedef typename Value<TSeqH>::Type                         TAlphabetH;
+
+    constexpr unsigned LANES = LENGTH<TSimdVector>::VALUE;
+    constexpr bool IS_LOCAL = IsSameType<TAlgo, DPLocal>::VALUE;
+    constexpr bool TRACEBACK = IsTracebackEnabled_<TTraceFlag>::VALUE;
+
+    size_t const lengthH = length(seqH);
+    size_t const lengthV = length(seqV);
+    size_t const segLen = (lengthV + LANES - 1) / LANES;
+    int64_t const gapOpen = scoreGapOpen(scoringScheme);
+    int64_t const gapExtend = scoreGapExtend(scoringScheme);
+
+    // The query profile holds the substitution scores of every value of the horizontal alphabet against the
+    // striped vertical sequence.  The padding rows behind the end of seqV are never read back.
+    unsigned const alphabetSize = ValueSize<TAlphabetH>::VALUE;
+    TVectorString profile;
+    resize(profile, alphabetSize * segLen, Exact());
+    for (unsigned c = 0; c < alphabetSize; ++c)
+    {
+        TAlphabetH const valueH = static_cast<TAlphabetH>(c);
+        for (size_t s = 0; s < segLen; ++s)
+        {
+            TSimdVector & vec = profile[c * segLen + s];
+            vec = createVector<TSimdVector>(0);
+            for (size_t k = 0, pos = s; k < LANES && pos < lengthV; ++k, pos += segLen)
+                assignValue(vec, k, score(scoringScheme, valueH, seqV[pos]));
+        }
+    }
+
+    TValue const infinity = std::numeric_limits<TValue>::lowest() / 2;
+    TSimdVector const vInfinity = createVector<TSimdVector>(infinity);
+    TSimdVector const vZero = createVector<TSimdVector>(0);
+    TSimdVector const vGapOpen = createVector<TSimdVector>(gapOpen);
+    TSimdVector const vGapExtend = createVector<TSimdVector>(gapExtend);
+
+    // The first column and the horizontal gaps leaving it.
+    TVectorString initColumn;
+    TVectorString gapsE;
+    resize(initColumn, segLen, Exact());
+    resize(gapsE, segLen, Exact());
+    for (size_t s = 0; s < segLen; ++s)
+    {
+        initColumn[s] = vZero;
+        if (!IS_LOCAL)
+            for (size_t k = 0, row = s; k < LANES; ++k, row += segLen)
+                assignValue(initColumn[s], k, std::max<int64_t>(gapOpen + static_cast<int64_t>(row) * gapExtend,
+                                                                infinity));
+        gapsE[s] = initColumn[s] + vGapOpen;
+    }
+
+    TVectorString scores;
+    resize(scores, (TRACEBACK ? lengthH : 2) * segLen, Exact());
+
+    TSimdVector vBest = createVector<TSimdVector>(IS_LOCAL ? 0 : infinity);
+    int64_t best = 0;
+    size_t bestCol = 0;
+
+    TSimdVector const * pvHLoad = begin(initColumn, Standard());
+    for (size_t col = 1; col <= lengthH; ++col)
+    {
+        TSimdVector * pvHStore = begin(scores, Standard()) + (TRACEBACK ? col - 1 : col % 2) * segLen;
+        TSimdVector const * pvP = begin(profile, Standard()) + ordValue(seqH[col - 1]) * segLen;
+        TSimdVector * pvE = begin(gapsE, Standard());
+
+        TSimdVector vF = vInfinity;
+        TSimdVector vH = _stripedShiftIn(pvHLoad[segLen - 1],
+                                         _stripedCellScore<TValue>(scores, segLen, 0, col - 1, gapOpen, gapExtend,
+                                                                   TAlgo()));
+        if (!IS_LOCAL)
+            assignValue(vF, 0, _stripedCellScore<TValue>(scores, segLen, 0, col, gapOpen, gapExtend, TAlgo()) +
+                               gapOpen);
+
+        TSimdVector vColumnMax = vBest;
+        for (size_t s = 0; s < segLen; ++s)
+        {
+            vH = vH + pvP[s];
+            vH = max(vH, pvE[s]);
+            vH = max(vH, vF);
+            if (IS_LOCAL)
+            {
+                vH = max(vH, vZero);
+                vColumnMax = max(vColumnMax, vH);
+            }
+            pvHStore[s] = vH;
+
+            TSimdVector const vHOpen = vH + vGapOpen;
+            pvE[s] = max(pvE[s] + vGapExtend, vHOpen);
+            vF = max(vF + vGapExtend, vHOpen);
+            vH = pvHLoad[s];
+        }
+
+        // Lazy-F loop: propagate the vertical gaps from the end of every stripe into the next one, until no lane
+        // can improve a cell over the vertical gap already opened from it.
+        vF = _stripedShiftIn(vF, infinity);
+        for (unsigned pass = 0; pass < LANES; ++pass, vF = _stripedShiftIn(vF, infinity))
+        {
+            size_t s = 0;
+            for (; s < segLen; ++s)
+            {
+                vH = pvHStore[s];
+                if (!_stripedAnyGreater(vF + vGapExtend, vH + vGapOpen))
+                    break;
+                vH = max(vH, vF);
+                pvHStore[s] = vH;
+                if (IS_LOCAL)
+                    vColumnMax = max(vColumnMax, vH);
+                pvE[s] = max(pvE[s], vH + vGapOpen);
+                vF = max(vF + vGapExtend, vInfinity);
+            }
+            if (s < segLen)
+                break;
+        }
+
+        if (IS_LOCAL && _stripedAnyGreater(vColumnMax, vBest))
+        {
+            for (unsigned k = 0; k < LANES; ++k)
+                best = std::max<int64_t>(best, getValue(vColumnMax, k));
+            vBest = createVector<TSimdVector>(best);
+            bestCol = col;
+        }
+        pvHLoad = pvHStore;
+    }
+
+    if (!IS_LOCAL)
+    {
+        bestCol = lengthH;
+        best = _stripedCellScore<TValue>(scores, segLen, lengthV, TRACEBACK ? lengthH : lengthH % 2 + 1,
+                                         gapOpen, gapExtend, TAlgo());
+    }
+
+    if (TRACEBACK)
+    {
+        // The local alignment ends in the first row of the best column that holds the best score.
+        size_t bestRow = lengthV;
+        if (IS_LOCAL)
+            for (bestRow = 0; bestCol != 0 && _stripedCellScore<TValue>(scores, segLen, bestRow, bestCol, gapOpen,
+                                                                        gapExtend, TAlgo()) != best; ++bestRow)
+            {}
+        _stripedTraceback<TValue>(traceSegments, scores, segLen, bestRow, bestCol, seqH, seqV, scoringScheme,
+                                  TAlgo());
+    }
+    return best;
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignStriped()
+// ----------------------------------------------------------------------------
+
+// Runs the striped kernel in 16 bit lanes if no score can overflow them and in 32 bit lanes otherwise.
+template <typename TTraceSegments, typename TSeqH, typename TSeqV,
+          typename TScoreValue, typename TScoreSpec, typename TAlgo, typename TTraceFlag>
+inline TScoreValue
+_alignStriped(TTraceSegments & traceSegments,
+              TSeqH const & seqH,
+              TSeqV const & seqV,
+              Score<TScoreValue, TScoreSpec> const & scoringScheme,
+              TAlgo const & /*algo*/,
+              TTraceFlag const & /*traceFlag*/)
+{
+    if (empty(seqH) || empty(seqV))
+    {
+        if (IsSameType<TAlgo, DPLocal>::VALUE)
+            return 0;
+        if (IsTracebackEnabled_<TTraceFlag>::VALUE)
+        {
+            _recordSegment(traceSegments, 0, 0, length(seqH), TraceBitMap_<>::HORIZONTAL);
+            _recordSegment(traceSegments, 0, 0, length(seqV), TraceBitMap_<>::VERTICAL);
+        }
+        size_t const gapLength = std::max(length(seqH), length(seqV));
+        if (gapLength == 0)
+            return 0;
+        return scoreGapOpen(scoringScheme) + static_cast<TScoreValue>(gapLength - 1) * scoreGapExtend(scoringScheme);
+    }
+
+    // Overflows are not detected afterwards, so local alignments have to fit the bound of global ones.
+    if (_fitsSimdScoreValue<int16_t>(scoringScheme, length(seqH), length(seqV), DPGlobal()))
+        return _alignStripedImpl<typename SimdVector<int16_t>::Type>(traceSegments, seqH, seqV, scoringScheme,
+                                                                     TAlgo(), TTraceFlag());
+    return _alignStripedImpl<typename SimdVector<int32_t>::Type>(traceSegments, seqH, seqV, scoringScheme,
+                                                                 TAlgo(), TTraceFlag());
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_ALIGN_DP_ALIGN_STRIPED_IMPL_H_
@@ -0,0 +1,277 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Packed storage for the traceback matrix.  With a single trace each cell
+// of the linear gap recursion stores one of four directions, which fits
+// into two bits.  The affine recursion additionally stores whether the
+// horizontal and the vertical gap were opened or extended, which fits into
+// four bits.  The trace matrix is hosted by a packed string of these codes
+// and the navigator translates between the codes and the TraceBitMap_
+// values, so that the recursion and the traceback work unchanged.
+//
+// The pairwise alignment functions use it if the algorithm tag is wrapped
+// into PackedTrace, e.g. globalAlignment(align, score, PackedTrace<Gotoh>()).
+// Complete traces and dynamic gaps need the full byte.  The SIMD batch
+// alignments store one vector of lane bytes per cell and are not packed.
+//
+// A DPContext can also host its trace matrix packed explicitly, e.g.
+//
+//   typedef PackedTraceValue_<AffineGaps> TTraceValue;
+//   DPContext<DPCell_<int, AffineGaps>, TTraceValue, String<DPCell_<int, AffineGaps> >,
+//             PackedTraceMatrixHost_<AffineGaps>::Type> dpContext;
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_ALIGN_DP_MATRIX_NAVIGATOR_TRACE_MATRIX_PACKED_H_
+#define INCLUDE_SEQAN_ALIGN_DP_MATRIX_NAVIGATOR_TRACE_MATRIX_PACKED_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class PackedTraceValue_
+// ----------------------------------------------------------------------------
+
+template <typename TGapCosts>
+struct PackedTrace_;
+
+// The code of a trace value in the packed trace matrix.
+template <typename TGapCosts>
+using PackedTraceValue_ = SimpleType<unsigned char, PackedTrace_<TGapCosts> >;
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction ValueSize                                    [PackedTraceValue_]
+// ----------------------------------------------------------------------------
+
+// Linear gaps: none, diagonal, horizontal and vertical.
+template <>
+struct ValueSize<PackedTraceValue_<LinearGaps> >
+{
+    typedef uint8_t Type;
+    static const Type VALUE = 4;
+};
+
+template <>
+struct BitsPerValue<PackedTraceValue_<LinearGaps> >
+{
+    typedef uint8_t Type;
+    static const Type VALUE = 2;
+};
+
+// Affine gaps: the two bits of the linear code for the origin of the cell and one bit per gap matrix that is set if
+// the gap was extended.
+template <>
+struct ValueSize<PackedTraceValue_<AffineGaps> >
+{
+    typedef uint8_t Type;
+    static const Type VALUE = 16;
+};
+
+template <>
+struct BitsPerValue<PackedTraceValue_<AffineGaps> >
+{
+    typedef uint8_t Type;
+    static const Type VALUE = 4;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction PackedTraceMatrixHost_
+// ----------------------------------------------------------------------------
+
+// The host of a packed trace matrix.  Sixteen affine or 32 linear cells share one 64 bit word.
+template <typename TGapCosts>
+struct PackedTraceMatrixHost_
+{
+    typedef String<PackedTraceValue_<TGapCosts>, Packed<> > Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction CanPackTraceMatrix_
+// ----------------------------------------------------------------------------
+
+// Whether the traces of the given configuration can be stored in a packed trace matrix.
+template <typename TTraceFlag, typename TGapCosts>
+struct CanPackTraceMatrix_ : False
+{};
+
+template <typename TGapsPlacement>
+struct CanPackTraceMatrix_<TracebackOn<TracebackConfig_<SingleTrace, TGapsPlacement> >, LinearGaps> : True
+{};
+
+template <typename TGapsPlacement>
+struct CanPackTraceMatrix_<TracebackOn<TracebackConfig_<SingleTrace, TGapsPlacement> >, AffineGaps> : True
+{};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _packTraceValue()
+// ----------------------------------------------------------------------------
+
+template <typename TTraceValue>
+inline PackedTraceValue_<LinearGaps>
+_packTraceValue(TTraceValue const traceValue, LinearGaps const & /*tag*/)
+{
+    typedef TraceBitMap_<> TBitMap;
+
+    if (traceValue & TBitMap::DIAGONAL)
+        return 1u;
+    if (traceValue & TBitMap::HORIZONTAL)
+        return 2u;
+    if (traceValue & TBitMap::VERTICAL)
+        return 3u;
+    return 0u;
+}
+
+template <typename TTraceValue>
+inline PackedTraceValue_<AffineGaps>
+_packTraceValue(TTraceValue const traceValue, AffineGaps const & /*tag*/)
+{
+    typedef TraceBitMap_<> TBitMap;
+
+    uint8_t origin = 0u;
+    if (traceValue & TBitMap::MAX_FROM_VERTICAL_MATRIX)
+        origin = 3u;
+    else if (traceValue & TBitMap::MAX_FROM_HORIZONTAL_MATRIX)
+        origin = 2u;
+    else if (traceValue & TBitMap::DIAGONAL)
+        origin = 1u;
+    return origin | ((traceValue & TBitMap::HORIZONTAL) ? 4u : 0u) | ((traceValue & TBitMap::VERTICAL) ? 8u : 0u);
+}
+
+// ----------------------------------------------------------------------------
+// Function _unpackTraceValue()
+// ----------------------------------------------------------------------------
+
+inline TraceBitMap_<>::Type
+_unpackTraceValue(PackedTraceValue_<LinearGaps> const code)
+{
+    typedef TraceBitMap_<> TBitMap;
+
+    static const TBitMap::Type TABLE[4] =
+    {
+        TBitMap::NONE,
+        TBitMap::DIAGONAL,
+        TBitMap::HORIZONTAL | TBitMap::MAX_FROM_HORIZONTAL_MATRIX,
+        TBitMap::VERTICAL | TBitMap::MAX_FROM_VERTICAL_MATRIX
+    };
+    return TABLE[ordValue(code)];
+}
+
+// A cell without origin is the begin of a local alignment and has no gap information either.  Otherwise the gap
+// bits are either extensions or openings; cells that do not compute a gap matrix are never reached within a gap.
+inline TraceBitMap_<>::Type
+_unpackTraceValue(PackedTraceValue_<AffineGaps> const code)
+{
+    typedef TraceBitMap_<> TBitMap;
+
+    static const TBitMap::Type ORIGIN[4] =
+    {
+        TBitMap::NONE,
+        TBitMap::DIAGONAL,
+        TBitMap::MAX_FROM_HORIZONTAL_MATRIX,
+        TBitMap::MAX_FROM_VERTICAL_MATRIX
+    };
+    uint8_t ord = ordValue(code);
+    if ((ord & 3u) == 0u)
+        return TBitMap::NONE;
+    return ORIGIN[ord & 3u] |
+           ((ord & 4u) ? TBitMap::HORIZONTAL : TBitMap::HORIZONTAL_OPEN) |
+           ((ord & 8u) ? TBitMap::VERTICAL : TBitMap::VERTICAL_OPEN);
+}
+
+// ----------------------------------------------------------------------------
+// Function assignValue()                                [PackedTraceValue_]
+// ----------------------------------------------------------------------------
+
+template <typename TGapCosts, typename THost, typename TTraceFlag, typename TNavigationSpec, typename TValue>
+inline void
+assignValue(DPMatrixNavigator_<DPMatrix_<PackedTraceValue_<TGapCosts>, FullDPMatrix, THost>,
+                               DPTraceMatrix<TTraceFlag>, TNavigationSpec> & dpNavigator,
+            TValue const & element)
+{
+    static_assert(!IsTracebackEnabled_<TTraceFlag>::VALUE || IsSingleTrace_<TTraceFlag>::VALUE,
+                  "Only single traces can be stored in a packed trace matrix.");
+
+    SEQAN_IF_CONSTEXPR (IsSameType<TTraceFlag, TracebackOff>::VALUE)
+        return;  // Do nothing since no trace back is computed.
+
+    assignValue(dpNavigator._activeColIterator, _packTraceValue(element, TGapCosts()));
+}
+
+// ----------------------------------------------------------------------------
+// Function scalarValue()                                [PackedTraceValue_]
+// ----------------------------------------------------------------------------
+
+template <typename TGapCosts, typename THost, typename TTraceFlag, typename TNavigationSpec>
+inline TraceBitMap_<>::Type
+scalarValue(DPMatrixNavigator_<DPMatrix_<PackedTraceValue_<TGapCosts>, FullDPMatrix, THost>,
+                               DPTraceMatrix<TTraceFlag>, TNavigationSpec> const & dpNavigator)
+{
+    SEQAN_IF_CONSTEXPR (IsSameType<TTraceFlag, TracebackOff>::VALUE)
+        SEQAN_ASSERT_FAIL("Try to access uninitialized object!");
+
+    return _unpackTraceValue(static_cast<PackedTraceValue_<TGapCosts> >(getValue(dpNavigator._activeColIterator)));
+}
+
+// ----------------------------------------------------------------------------
+// Function position()                                   [PackedTraceValue_]
+// ----------------------------------------------------------------------------
+
+// Packed iterators do not know their position, so it is computed from the begin of the host.
+template <typename TGapCosts, typename THost, typename TTraceFlag, typename TNavigationSpec>
+inline typename Position<DPMatrixNavigator_<DPMatrix_<PackedTraceValue_<TGapCosts>, FullDPMatrix, THost>,
+                                            DPTraceMatrix<TTraceFlag>, TNavigationSpec> >::Type
+position(DPMatrixNavigator_<DPMatrix_<PackedTraceValue_<TGapCosts>, FullDPMatrix, THost>,
+                            DPTraceMatrix<TTraceFlag>, TNavigationSpec> const & dpNavigator)
+{
+    SEQAN_IF_CONSTEXPR (IsSameType<TTraceFlag, TracebackOff>::VALUE)
+        return 0;
+
+    return dpNavigator._activeColIterator - begin(*dpNavigator._ptrDataContainer, Standard());
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_ALIGN_DP_MATRIX_NAVIGATOR_TRACE_MATRIX_PACKED_H_
@@ -330,6 +330,29 @@ typedef Tag<AffineGaps_> AffineGaps;
 struct DynamicGaps_;
 typedef Tag<DynamicGaps_> DynamicGaps;
 
+// ----------------------------------------------------------------------------
+// Tag PackedTrace
+// ----------------------------------------------------------------------------
+
+/*!
+ * @tag AlignmentAlgorithmTags#PackedTrace
+ * @headerfile <seqan/align.h>
+ * @brief Tag for storing the trace matrix with 2 bits per cell for linear and 4 bits per cell for affine gap costs.
+ *
+ * @signature template <typename TAlgoTag>
+ *            struct PackedTrace;
+ *
+ * @tparam TAlgoTag The wrapped gap cost model or algorithm, e.g. @link AlignmentAlgorithmTags#AffineGaps @endlink or
+ *                  @link AlignmentAlgorithmTags#NeedlemanWunsch @endlink.
+ *
+ * The pairwise alignment of two sequences with traceback then needs about half or a quarter of the memory, but
+ * filling the matrix is slower.  Only single traces of linear and affine gap costs are packed, other configurations
+ * and the SIMD batch alignments use the default trace matrix.
+ */
+
+template <typename TAlgoTag>
+struct PackedTrace {};
+
 // ----------------------------------------------------------------------------
 // Class DPProfile
 // ----------------------------------------------------------------------------
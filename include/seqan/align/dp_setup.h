@@ -204,6 +204,12 @@ struct SubstituteAlgoTag_<Gotoh>
     typedef AffineGaps Type;
 };
 
+template <typename TAlgoTag>
+struct SubstituteAlgoTag_<PackedTrace<TAlgoTag> >
+{
+    typedef PackedTrace<typename SubstituteAlgoTag_<TAlgoTag>::Type> Type;
+};
+
 // ----------------------------------------------------------------------------
 // SetUpAlignmentProfile
 // ----------------------------------------------------------------------------
@@ -308,6 +314,76 @@ _setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
     return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig);
 }
 
+template <typename TTraceSegment, typename TSpec,
+          typename TDPScoutStateSpec,
+          typename TSequenceH,
+          typename TSequenceV,
+          typename TScoreValue2, typename TScoreSpec,
+          typename TDPType, typename TBand, typename TFreeEndGaps, typename TTraceConfig,
+          typename TGapModel>
+typename Value<Score<TScoreValue2, TScoreSpec> >::Type
+_setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
+                      DPScoutState_<TDPScoutStateSpec> & dpScoutState,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue2, TScoreSpec> const & scoringScheme,
+                      AlignConfig2<TDPType, TBand, TFreeEndGaps, TTraceConfig> const & alignConfig,
+                      PackedTrace<TGapModel> const & /**/)
+{
+    // Some algorithms replace the trace configuration, e.g. extensions always compute complete traces.
+    typedef typename SetupAlignmentProfile_<TDPType, TFreeEndGaps, TGapModel, TTraceConfig>::Type TDPProfile;
+    typedef typename DPProfileType<TDPProfile, DPProfileTypeId::TRACE_CONFIG>::Type TTraceFlag;
+    typedef typename CanPackTraceMatrix_<TTraceFlag, TGapModel>::Type TCanPack;
+
+    return _setUpAndRunAlignment(traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig, TGapModel(),
+                                 TCanPack());
+}
+
+template <typename TTraceSegment, typename TSpec,
+          typename TDPScoutStateSpec,
+          typename TSequenceH,
+          typename TSequenceV,
+          typename TScoreValue2, typename TScoreSpec,
+          typename TDPType, typename TBand, typename TFreeEndGaps, typename TTraceConfig,
+          typename TGapModel>
+typename Value<Score<TScoreValue2, TScoreSpec> >::Type
+_setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
+                      DPScoutState_<TDPScoutStateSpec> & dpScoutState,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue2, TScoreSpec> const & scoringScheme,
+                      AlignConfig2<TDPType, TBand, TFreeEndGaps, TTraceConfig> const & alignConfig,
+                      TGapModel const & /**/,
+                      True const & /*packTraceMatrix*/)
+{
+    typedef DPCell_<TScoreValue2, TGapModel> TDPCell;
+
+    DPContext<TDPCell, PackedTraceValue_<TGapModel>, String<TDPCell>,
+              typename PackedTraceMatrixHost_<TGapModel>::Type> dpContext;
+    return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig);
+}
+
+template <typename TTraceSegment, typename TSpec,
+          typename TDPScoutStateSpec,
+          typename TSequenceH,
+          typename TSequenceV,
+          typename TScoreValue2, typename TScoreSpec,
+          typename TDPType, typename TBand, typename TFreeEndGaps, typename TTraceConfig,
+          typename TGapModel>
+typename Value<Score<TScoreValue2, TScoreSpec> >::Type
+_setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
+                      DPScoutState_<TDPScoutStateSpec> & dpScoutState,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue2, TScoreSpec> const & scoringScheme,
+                      AlignConfig2<TDPType, TBand, TFreeEndGaps, TTraceConfig> const & alignConfig,
+                      TGapModel const & /**/,
+                      False const & /*packTraceMatrix*/)
+{
+    DPContext<DPCell_<TScoreValue2, TGapModel>, typename TraceBitMap_<>::Type> dpContext;
+    return _setUpAndRunAlignment(dpContext, traceSegments, dpScoutState, seqH, seqV, scoringScheme, alignConfig);
+}
+
 template <typename TTraceSegment, typename TSpec, typename TDPScoutStateSpec,
           typename TSequenceH, typename TSequenceV, typename TScoreValue2, typename TScoreSpec, typename TDPType,
           typename TBand, typename TFreeEndGaps, typename TTraceConfig>
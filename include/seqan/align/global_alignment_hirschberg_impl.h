@@ -415,8 +415,9 @@ _globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
                 ++target_0;
                 ++target_1;
             }
+            total_score += static_cast<TScoreValue>(_end1(target) - _begin1(target)) * score_gap;
         }
-        if(_begin1(target) == _end1(target))
+        else if(_begin1(target) == _end1(target))
         {
             for(i = 0;i < (_end2(target) - _begin2(target));++i)
             {
@@ -424,6 +425,7 @@ _globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
                 ++target_0;
                 ++target_1;
             }
+            total_score += static_cast<TScoreValue>(_end2(target) - _begin2(target)) * score_gap;
         }
         else if(_begin1(target) + 1 == _end1(target) || _begin2(target) + 1 == _end2(target))
         {
@@ -47,6 +47,26 @@ namespace seqan2 {
 // Tags, Classes, Enums
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Class MyersBlockTrace_
+// ----------------------------------------------------------------------------
+
+// The bit-vectors of the blocks computed in every column of the banded block-based algorithm, from which the
+// traceback recovers the values of the DP matrix.  The blocks of column j are stored at [columnBegin[j],
+// columnBegin[j + 1]) and cover the rows of the blocks firstBlock[j], firstBlock[j] + 1, ...
+struct MyersBlockTrace_
+{
+    typedef uint64_t TWord;
+
+    static const unsigned BLOCK_SIZE = BitsPerValue<TWord>::VALUE;
+
+    String<TWord> vp;
+    String<TWord> vn;
+    String<int> score;              // the value of the last row of the block
+    String<size_t> columnBegin;
+    String<unsigned> firstBlock;
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -196,6 +216,308 @@ _globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
     return score;
 }
 
+// ----------------------------------------------------------------------------
+// Function _myersAdvanceBlock()
+// ----------------------------------------------------------------------------
+
+// Advances a block of Myers' bit-vectors by one column, given the horizontal delta hin in {-1, 0, 1} entering the
+// block from above (Hyyro 2003).  Returns the horizontal delta leaving the block at its last row.
+inline int
+_myersAdvanceBlock(uint64_t & vp, uint64_t & vn, uint64_t eq, int hin)
+{
+    uint64_t const highBit = static_cast<uint64_t>(1) << (MyersBlockTrace_::BLOCK_SIZE - 1);
+
+    uint64_t xv = eq | vn;
+    if (hin < 0)
+        eq |= 1;
+    uint64_t xh = (((eq & vp) + vp) ^ vp) | eq;
+    uint64_t hp = vn | ~(xh | vp);
+    uint64_t hn = vp & xh;
+
+    int hout = (hp & highBit) ? 1 : ((hn & highBit) ? -1 : 0);
+
+    hp <<= 1;
+    hn <<= 1;
+    if (hin < 0)
+        hn |= 1;
+    else if (hin > 0)
+        hp |= 1;
+
+    vp = hn | ~(xv | hp);
+    vn = hp & xv;
+    return hout;
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersCellValue()
+// ----------------------------------------------------------------------------
+
+// Returns the value of the cell in row i and column j, or a value larger than any edit distance if the cell lies
+// outside of the computed blocks.
+inline int
+_myersCellValue(MyersBlockTrace_ const & trace, unsigned i, unsigned j)
+{
+    typedef MyersBlockTrace_::TWord TWord;
+
+    if (j == 0)
+        return i;
+    if (i == 0)
+        return j;
+
+    unsigned block = (i - 1) / MyersBlockTrace_::BLOCK_SIZE;
+    if (block < trace.firstBlock[j] ||
+        block - trace.firstBlock[j] >= trace.columnBegin[j + 1] - trace.columnBegin[j])
+        return std::numeric_limits<int>::max() / 2;
+
+    // Subtract the vertical deltas of the rows below row i in the block from the value of the last row.
+    size_t idx = trace.columnBegin[j] + (block - trace.firstBlock[j]);
+    unsigned bit = (i - 1) % MyersBlockTrace_::BLOCK_SIZE;
+    TWord below = (bit + 1 == MyersBlockTrace_::BLOCK_SIZE) ? 0 : (~static_cast<TWord>(0) << (bit + 1));
+    return trace.score[idx] - static_cast<int>(popCount(trace.vp[idx] & below)) +
+           static_cast<int>(popCount(trace.vn[idx] & below));
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersBandedEditDistance()
+// ----------------------------------------------------------------------------
+
+// Computes the edit distance of the text (columns) and the pattern (rows), which must not be longer than the text,
+// with the blocks of the pattern restricted to the diagonals that an alignment of distance at most maxDistance can
+// use (Ukkonen's cut-off).  Returns the edit distance if it is at most maxDistance and a larger value otherwise.
+// The bit-vectors of all computed blocks are kept in trace.
+template <typename TText, typename TPattern>
+int
+_myersBandedEditDistance(MyersBlockTrace_ & trace,
+                         TText const & text,
+                         TPattern const & pattern,
+                         unsigned maxDistance)
+{
+    typedef MyersBlockTrace_::TWord TWord;
+    typedef typename Value<TPattern>::Type TPatternAlphabet;
+
+    unsigned const BLOCK_SIZE = MyersBlockTrace_::BLOCK_SIZE;
+    unsigned const n = length(text);
+    unsigned const m = length(pattern);
+    unsigned const alphabetSize = ValueSize<TPatternAlphabet>::VALUE;
+    unsigned const blockCount = (m + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    SEQAN_ASSERT_GEQ(n, m);
+    SEQAN_ASSERT_GT(m, 0u);
+
+    // An alignment on the diagonal d = j - i needs at least |d| + |n - m - d| indels.
+    int const slack = (static_cast<int>(_max(maxDistance, n - m)) - static_cast<int>(n - m)) / 2;
+    int const upperDiag = static_cast<int>(n - m) + slack;
+    int const lowerDiag = -slack;
+
+    String<TWord> peq;
+    resize(peq, alphabetSize * blockCount, 0, Exact());
+    for (unsigned i = 0; i < m; ++i)
+        peq[ordValue(pattern[i]) * blockCount + i / BLOCK_SIZE] |= static_cast<TWord>(1) << (i % BLOCK_SIZE);
+
+    // The first column: D(i, 0) = i.
+    String<TWord> vp;
+    String<TWord> vn;
+    String<int> score;
+    resize(vp, blockCount, ~static_cast<TWord>(0), Exact());
+    resize(vn, blockCount, 0, Exact());
+    resize(score, blockCount, 0, Exact());
+    score[0] = BLOCK_SIZE;
+
+    clear(trace.vp);
+    clear(trace.vn);
+    clear(trace.score);
+    resize(trace.columnBegin, n + 2, 0, Exact());
+    resize(trace.firstBlock, n + 1, 0, Exact());
+
+    unsigned lastBlock = 0;
+    for (unsigned j = 1; j <= n; ++j)
+    {
+        // The blocks of the rows j - upperDiag, ..., j - lowerDiag.
+        int const firstRow = static_cast<int>(j) - upperDiag;
+        unsigned const first = (firstRow <= 1) ? 0 : (firstRow - 1) / BLOCK_SIZE;
+        unsigned const last = _min(blockCount - 1, static_cast<unsigned>(static_cast<int>(j) - lowerDiag - 1) / BLOCK_SIZE);
+
+        TWord const * eq = begin(peq, Standard()) + ordValue(static_cast<TPatternAlphabet>(text[j - 1])) * blockCount;
+
+        // Above the first block lies either the first row or a block left behind by the band, whose values are
+        // over-estimated by letting them grow by one in every column.
+        int hin = 1;
+        int prevScore = 0;
+        for (unsigned b = first; b <= last; ++b)
+        {
+            if (b > lastBlock)
+            {
+                // A block entering the band starts from the over-estimate D(i, j - 1) = D(i - 1, j - 1) + 1.
+                vp[b] = ~static_cast<TWord>(0);
+                vn[b] = 0;
+                score[b] = prevScore + BLOCK_SIZE;
+                lastBlock = b;
+            }
+            prevScore = score[b];
+            hin = _myersAdvanceBlock(vp[b], vn[b], eq[b], hin);
+            score[b] += hin;
+
+            appendValue(trace.vp, vp[b]);
+            appendValue(trace.vn, vn[b]);
+            appendValue(trace.score, score[b]);
+        }
+        trace.firstBlock[j] = first;
+        trace.columnBegin[j + 1] = length(trace.vp);
+    }
+
+    return _myersCellValue(trace, m, n);
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignmentMyersBanded()
+// ----------------------------------------------------------------------------
+
+// Runs the banded algorithm with a growing band until the edit distance fits into it.
+template <typename TText, typename TPattern>
+int
+_globalAlignmentMyersBanded(MyersBlockTrace_ & trace, TText const & text, TPattern const & pattern)
+{
+    unsigned const n = length(text);
+    unsigned const m = length(pattern);
+    if (m == 0)
+        return n;
+
+    // The edit distance is at most n, for which the band covers the whole matrix.
+    unsigned maxDistance = _max(n - m, MyersBlockTrace_::BLOCK_SIZE);
+    while (true)
+    {
+        int distance = _myersBandedEditDistance(trace, text, pattern, maxDistance);
+        if (distance <= static_cast<int>(maxDistance) || maxDistance >= n + m)
+            return distance;
+        maxDistance *= 2;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersRecordSegment()
+// ----------------------------------------------------------------------------
+
+// Records a segment given in text and pattern coordinates, which are the horizontal and vertical ones unless the
+// sequences have been swapped.
+template <typename TTraceSegments>
+inline void
+_myersRecordSegment(TTraceSegments & traceSegments, unsigned textPos, unsigned patternPos, unsigned len,
+                    uint8_t traceValue, bool swapped)
+{
+    if (!swapped)
+    {
+        _recordSegment(traceSegments, textPos, patternPos, len, traceValue);
+        return;
+    }
+
+    if (traceValue == TraceBitMap_<>::HORIZONTAL)
+        traceValue = TraceBitMap_<>::VERTICAL;
+    else if (traceValue == TraceBitMap_<>::VERTICAL)
+        traceValue = TraceBitMap_<>::HORIZONTAL;
+    _recordSegment(traceSegments, patternPos, textPos, len, traceValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersTraceback()
+// ----------------------------------------------------------------------------
+
+// Follows the cells of an optimal alignment from the last cell back to the first one.
+template <typename TTraceSegments, typename TText, typename TPattern>
+void
+_myersTraceback(TTraceSegments & traceSegments,
+                MyersBlockTrace_ const & trace,
+                TText const & text,
+                TPattern const & pattern,
+                bool swapped)
+{
+    typedef typename Value<TPattern>::Type TPatternAlphabet;
+
+    unsigned i = length(pattern);
+    unsigned j = length(text);
+    int value = (i == 0) ? static_cast<int>(j) : _myersCellValue(trace, i, j);
+
+    uint8_t runValue = TraceBitMap_<>::NONE;
+    unsigned runLength = 0;
+    while (i > 0 || j > 0)
+    {
+        uint8_t traceValue;
+        if (i == 0)
+        {
+            traceValue = TraceBitMap_<>::HORIZONTAL;
+        }
+        else if (j == 0)
+        {
+            traceValue = TraceBitMap_<>::VERTICAL;
+        }
+        else
+        {
+            int diagValue = _myersCellValue(trace, i - 1, j - 1);
+            if (static_cast<TPatternAlphabet>(text[j - 1]) != pattern[i - 1])
+                ++diagValue;
+
+            if (diagValue == value)
+                traceValue = TraceBitMap_<>::DIAGONAL;
+            else if (_myersCellValue(trace, i - 1, j) + 1 == value)
+                traceValue = TraceBitMap_<>::VERTICAL;
+            else
+                traceValue = TraceBitMap_<>::HORIZONTAL;
+        }
+
+        if (traceValue != runValue)
+        {
+            _myersRecordSegment(traceSegments, j, i, runLength, runValue, swapped);
+            runValue = traceValue;
+            runLength = 0;
+        }
+        ++runLength;
+
+        if (traceValue != TraceBitMap_<>::HORIZONTAL)
+            --i;
+        if (traceValue != TraceBitMap_<>::VERTICAL)
+            --j;
+        if (i > 0 && j > 0)
+            value = _myersCellValue(trace, i, j);
+    }
+    _myersRecordSegment(traceSegments, j, i, runLength, runValue, swapped);
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignment()                                 [MyersBitVector]
+// ----------------------------------------------------------------------------
+
+// Computes an optimal edit distance alignment with the banded block-based algorithm.  The band starts with the
+// diagonals needed for the length difference and is doubled until it contains an optimal alignment, so that the
+// running time is O(n * max(d, w) / w) for an edit distance d and the word size w.  Returns the negative edit
+// distance.
+template <typename TSequenceH, typename TGapsSpecH, typename TSequenceV, typename TGapsSpecV>
+int
+_globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                 Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                 MyersBitVector const & /*algorithmTag*/)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    String<TraceSegment_<TPosition, TSize> > traceSegments;
+    MyersBlockTrace_ trace;
+    int distance;
+
+    // The pattern is the shorter sequence, so that it fits into less blocks.
+    if (length(source(gapsH)) >= length(source(gapsV)))
+    {
+        distance = _globalAlignmentMyersBanded(trace, source(gapsH), source(gapsV));
+        _myersTraceback(traceSegments, trace, source(gapsH), source(gapsV), false);
+    }
+    else
+    {
+        distance = _globalAlignmentMyersBanded(trace, source(gapsV), source(gapsH));
+        _myersTraceback(traceSegments, trace, source(gapsV), source(gapsH), true);
+    }
+
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return -distance;
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_MYERS_IMPL_H_
@@ -0,0 +1,409 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Affine gap alignment in linear space (Myers and Miller, 1988).  The
+// vertical sequence is split at its middle row.  A forward pass over the
+// upper half and a backward pass over the lower half give, for every column,
+// the best scores of the prefix and the suffix alignments, both for arbitrary
+// ends and for ends in a vertical gap.  The optimal alignment either passes
+// the middle row in a cell or has a vertical gap spanning the two middle
+// characters, in which case the two halves are aligned with the open score
+// of the adjoining vertical gap waived.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_MYERS_MILLER_IMPL_H_
+#define INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_MYERS_MILLER_IMPL_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class MyersMillerConfig_
+// ----------------------------------------------------------------------------
+
+struct MyersMillerConfig_
+{
+    // Sub-problems with at most this many cells are solved with a full matrix.
+    static const unsigned BASE_CASE_CELLS = 1024;
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _myersMillerRecordSegment()
+// ----------------------------------------------------------------------------
+
+// Appends a segment to the segments recorded from the begin to the end of the alignment, merging it with the last
+// one if possible.
+template <typename TTraceSegments, typename TPosition, typename TSize>
+inline void
+_myersMillerRecordSegment(TTraceSegments & traceSegments, TPosition hBegin, TPosition vBegin, TSize len,
+                          uint8_t traceValue)
+{
+    if (len == 0)
+        return;
+
+    if (!empty(traceSegments))
+    {
+        typename Value<TTraceSegments>::Type & last = back(traceSegments);
+        if (last._traceValue == traceValue && _getEndHorizontal(last) == hBegin && _getEndVertical(last) == vBegin)
+        {
+            last._length += len;
+            return;
+        }
+    }
+    _recordSegment(traceSegments, hBegin, vBegin, len, traceValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersMillerLastRow()
+// ----------------------------------------------------------------------------
+
+// Aligns seqV to seqH and stores the scores of the last row in hRow, and the scores of the alignments ending with a
+// vertical gap in vGapRow.  If waiveBeginGap is true a vertical gap at the begin of the alignment does not pay the
+// additional gap open score.
+template <typename TScoreValue, typename TSequenceH, typename TSequenceV, typename TScoreSpec>
+void
+_myersMillerLastRow(String<TScoreValue> & hRow,
+                    String<TScoreValue> & vGapRow,
+                    TSequenceH const & seqH,
+                    TSequenceV const & seqV,
+                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                    bool waiveBeginGap)
+{
+    TScoreValue const minusInf = std::numeric_limits<TScoreValue>::min() / 2;
+    TScoreValue const gapOpen = scoreGapOpen(scoringScheme);
+    TScoreValue const gapExtend = scoreGapExtend(scoringScheme);
+    size_t const n = length(seqH);
+    size_t const m = length(seqV);
+
+    resize(hRow, n + 1, Exact());
+    resize(vGapRow, n + 1, Exact());
+
+    hRow[0] = 0;
+    vGapRow[0] = waiveBeginGap ? 0 : minusInf;
+    for (size_t j = 1; j <= n; ++j)
+    {
+        hRow[j] = gapOpen + static_cast<TScoreValue>(j - 1) * gapExtend;
+        vGapRow[j] = minusInf;
+    }
+
+    for (size_t i = 1; i <= m; ++i)
+    {
+        auto const valueV = seqV[i - 1];
+        TScoreValue diag = hRow[0];
+        vGapRow[0] = _max(vGapRow[0] + gapExtend, hRow[0] + gapOpen);
+        hRow[0] = vGapRow[0];
+
+        TScoreValue hGap = minusInf;
+        for (size_t j = 1; j <= n; ++j)
+        {
+            TScoreValue vGap = _max(vGapRow[j] + gapExtend, hRow[j] + gapOpen);
+            hGap = _max(hGap + gapExtend, hRow[j - 1] + gapOpen);
+            TScoreValue h = _max(diag + score(scoringScheme, seqH[j - 1], valueV), _max(vGap, hGap));
+            diag = hRow[j];
+            hRow[j] = h;
+            vGapRow[j] = vGap;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersMillerBaseCase()
+// ----------------------------------------------------------------------------
+
+// Aligns the infixes [hBegin, hEnd) and [vBegin, vEnd) with a full matrix.  If waiveBeginGap or waiveEndGap is true
+// a vertical gap at the begin or the end of the alignment does not pay the additional gap open score.
+template <typename TTraceSegments, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpec>
+void
+_myersMillerBaseCase(TTraceSegments & traceSegments,
+                     TSequenceH const & seqH,
+                     TSequenceV const & seqV,
+                     Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                     size_t hBegin, size_t hEnd,
+                     size_t vBegin, size_t vEnd,
+                     bool waiveBeginGap,
+                     bool waiveEndGap)
+{
+    TScoreValue const minusInf = std::numeric_limits<TScoreValue>::min() / 2;
+    TScoreValue const gapOpen = scoreGapOpen(scoringScheme);
+    TScoreValue const gapExtend = scoreGapExtend(scoringScheme);
+    size_t const n = hEnd - hBegin;
+    size_t const m = vEnd - vBegin;
+    size_t const cols = n + 1;
+
+    // The best scores of all alignments, of those ending with a vertical and of those ending with a horizontal gap.
+    String<TScoreValue> h;
+    String<TScoreValue> vGap;
+    String<TScoreValue> hGap;
+    resize(h, (m + 1) * cols, minusInf, Exact());
+    resize(vGap, (m + 1) * cols, minusInf, Exact());
+    resize(hGap, (m + 1) * cols, minusInf, Exact());
+
+    h[0] = 0;
+    if (waiveBeginGap)
+        vGap[0] = 0;
+    for (size_t i = 0; i <= m; ++i)
+    {
+        for (size_t j = 0; j <= n; ++j)
+        {
+            size_t const cell = i * cols + j;
+            if (i > 0)
+                vGap[cell] = _max(vGap[cell - cols] + gapExtend, h[cell - cols] + gapOpen);
+            if (j > 0)
+                hGap[cell] = _max(hGap[cell - 1] + gapExtend, h[cell - 1] + gapOpen);
+            if (i > 0 && j > 0)
+                h[cell] = h[cell - cols - 1] + score(scoringScheme, seqH[hBegin + j - 1], seqV[vBegin + i - 1]);
+            if (cell > 0)
+                h[cell] = _max(h[cell], _max(vGap[cell], hGap[cell]));
+        }
+    }
+
+    // Trace back from the last cell, recording the segments from the end to the begin.
+    String<typename Value<TTraceSegments>::Type> segments;
+    size_t i = m;
+    size_t j = n;
+    // 0: any, 1: vertical gap, 2: horizontal gap
+    unsigned state = (waiveEndGap && m > 0 && vGap[m * cols + n] - (gapOpen - gapExtend) > h[m * cols + n]) ? 1 : 0;
+    uint8_t runValue = TraceBitMap_<>::NONE;
+    size_t runLength = 0;
+    while (i > 0 || j > 0)
+    {
+        size_t const cell = i * cols + j;
+        if (state == 0)
+        {
+            if (i > 0 && j > 0 &&
+                h[cell] == h[cell - cols - 1] + score(scoringScheme, seqH[hBegin + j - 1], seqV[vBegin + i - 1]))
+                state = 3;
+            else if (i > 0 && h[cell] == vGap[cell])
+                state = 1;
+            else
+                state = 2;
+        }
+
+        uint8_t traceValue = (state == 3) ? TraceBitMap_<>::DIAGONAL :
+                             ((state == 1) ? TraceBitMap_<>::VERTICAL : TraceBitMap_<>::HORIZONTAL);
+        if (traceValue != runValue)
+        {
+            _recordSegment(segments, hBegin + j, vBegin + i, runLength, runValue);
+            runValue = traceValue;
+            runLength = 0;
+        }
+        ++runLength;
+
+        if (state == 3)
+        {
+            --i;
+            --j;
+            state = 0;
+        }
+        else if (state == 1)
+        {
+            // Continue the gap if it extends the one above, or if it reaches the waived gap at the begin.
+            bool extend = vGap[cell] == vGap[cell - cols] + gapExtend;
+            --i;
+            if (!extend || (i == 0 && j == 0))
+                state = 0;
+        }
+        else
+        {
+            bool extend = hGap[cell] == hGap[cell - 1] + gapExtend;
+            --j;
+            if (!extend)
+                state = 0;
+        }
+    }
+    _recordSegment(segments, hBegin + j, vBegin + i, runLength, runValue);
+
+    for (size_t k = length(segments); k > 0; --k)
+        _myersMillerRecordSegment(traceSegments, segments[k - 1]._horizontalBeginPos,
+                                  segments[k - 1]._verticalBeginPos, segments[k - 1]._length,
+                                  segments[k - 1]._traceValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _myersMillerAlign()
+// ----------------------------------------------------------------------------
+
+// Aligns the infixes [hBegin, hEnd) and [vBegin, vEnd) and appends the segments of the alignment to traceSegments.
+template <typename TTraceSegments, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpec>
+void
+_myersMillerAlign(TTraceSegments & traceSegments,
+                  TSequenceH const & seqH,
+                  TSequenceV const & seqV,
+                  Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                  size_t hBegin, size_t hEnd,
+                  size_t vBegin, size_t vEnd,
+                  bool waiveBeginGap,
+                  bool waiveEndGap,
+                  String<TScoreValue> (& buffers)[4])
+{
+    typedef typename Infix<TSequenceH const>::Type TInfixH;
+    typedef typename Infix<TSequenceV const>::Type TInfixV;
+
+    size_t const n = hEnd - hBegin;
+    size_t const m = vEnd - vBegin;
+    if (m <= 1 || n == 0 || (m + 1) * (n + 1) <= MyersMillerConfig_::BASE_CASE_CELLS)
+    {
+        _myersMillerBaseCase(traceSegments, seqH, seqV, scoringScheme, hBegin, hEnd, vBegin, vEnd, waiveBeginGap,
+                             waiveEndGap);
+        return;
+    }
+
+    // Forward pass over the upper half and backward pass over the lower half.
+    size_t const vMid = vBegin + m / 2;
+    TInfixH infixH = infix(seqH, hBegin, hEnd);
+    _myersMillerLastRow(buffers[0], buffers[1], infixH, infix(seqV, vBegin, vMid), scoringScheme, waiveBeginGap);
+
+    TInfixV infixLowerV = infix(seqV, vMid, vEnd);
+    ModifiedString<TInfixH, ModReverse> reverseH(infixH);
+    ModifiedString<TInfixV, ModReverse> reverseLowerV(infixLowerV);
+    _myersMillerLastRow(buffers[2], buffers[3], reverseH, reverseLowerV, scoringScheme, waiveEndGap);
+
+    // The optimal alignment passes the middle row in a cell, or with a vertical gap spanning the two middle
+    // characters, which opens only once.
+    TScoreValue const gapOpenExtra = scoreGapOpen(scoringScheme) - scoreGapExtend(scoringScheme);
+    size_t bestJ = 0;
+    bool bestInGap = false;
+    TScoreValue best = std::numeric_limits<TScoreValue>::min();
+    for (size_t j = 0; j <= n; ++j)
+    {
+        TScoreValue throughCell = buffers[0][j] + buffers[2][n - j];
+        TScoreValue throughGap = buffers[1][j] + buffers[3][n - j] - gapOpenExtra;
+        if (throughCell > best)
+        {
+            best = throughCell;
+            bestJ = j;
+            bestInGap = false;
+        }
+        if (throughGap > best)
+        {
+            best = throughGap;
+            bestJ = j;
+            bestInGap = true;
+        }
+    }
+
+    size_t const hMid = hBegin + bestJ;
+    if (bestInGap)
+    {
+        _myersMillerAlign(traceSegments, seqH, seqV, scoringScheme, hBegin, hMid, vBegin, vMid - 1, waiveBeginGap,
+                          true, buffers);
+        _myersMillerRecordSegment(traceSegments, hMid, vMid - 1, static_cast<size_t>(2), TraceBitMap_<>::VERTICAL);
+        _myersMillerAlign(traceSegments, seqH, seqV, scoringScheme, hMid, hEnd, vMid + 1, vEnd, true, waiveEndGap,
+                          buffers);
+    }
+    else
+    {
+        _myersMillerAlign(traceSegments, seqH, seqV, scoringScheme, hBegin, hMid, vBegin, vMid, waiveBeginGap, false,
+                          buffers);
+        _myersMillerAlign(traceSegments, seqH, seqV, scoringScheme, hMid, hEnd, vMid, vEnd, false, waiveEndGap,
+                          buffers);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignmentMyersMiller()
+// ----------------------------------------------------------------------------
+
+// Computes an optimal global alignment with affine gap costs in O(n + m) memory.  The segments are recorded from the
+// end to the begin of the alignment, like the traceback of the dynamic programming does.
+template <typename TTraceSegments, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpec>
+TScoreValue
+_globalAlignmentMyersMiller(TTraceSegments & traceSegments,
+                            TSequenceH const & seqH,
+                            TSequenceV const & seqV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    String<TScoreValue> buffers[4];
+    _myersMillerAlign(traceSegments, seqH, seqV, scoringScheme, 0, length(seqH), 0, length(seqV), false, false,
+                      buffers);
+    reverse(traceSegments);
+
+    // Score the alignment from its segments.
+    TScoreValue res = 0;
+    for (size_t k = 0; k < length(traceSegments); ++k)
+    {
+        typename Value<TTraceSegments>::Type const & segment = traceSegments[k];
+        if (segment._traceValue == TraceBitMap_<>::DIAGONAL)
+        {
+            for (size_t l = 0; l < segment._length; ++l)
+                res += score(scoringScheme, seqH[segment._horizontalBeginPos + l], seqV[segment._verticalBeginPos + l]);
+        }
+        else
+        {
+            res += scoreGapOpen(scoringScheme) +
+                   static_cast<TScoreValue>(segment._length - 1) * scoreGapExtend(scoringScheme);
+        }
+    }
+    return res;
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignmentMyersMiller()                               [Gaps]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH, typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue
+_globalAlignmentMyersMiller(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    String<TraceSegment_<TPosition, TSize> > traceSegments;
+    TScoreValue res = _globalAlignmentMyersMiller(traceSegments, source(gapsH), source(gapsV), scoringScheme);
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_MYERS_MILLER_IMPL_H_
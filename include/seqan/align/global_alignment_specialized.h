@@ -32,7 +32,8 @@
 // Author: Manuel Holtgrewe <manuel.holtgrewe@fu-berlin.de>
 // ==========================================================================
 // Test for globalAlignmentScore() implementations that use Hirschberg and
-// MyersBitVector, MyersHirschberg.
+// MyersBitVector, MyersHirschberg, Striped, Wfa, BiWfa and
+// DifferenceRecurrence.
 // ==========================================================================
 
 #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_SPECIALIZED_H_
@@ -68,14 +69,28 @@ TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
                             Score<TScoreValue, Simple> const & scoringScheme,
                             Hirschberg const & /*algorithmTag*/)
 {
-    SEQAN_ASSERT_EQ(scoreGapOpen(scoringScheme), scoreGapExtend(scoringScheme));
+    // Affine gap costs are handled by the generalization of Myers and Miller.
+    if (scoreGapOpen(scoringScheme) != scoreGapExtend(scoringScheme))
+        return _globalAlignmentMyersMiller(gapsH, gapsV, scoringScheme);
     return _globalAlignment(gapsH, gapsV, scoringScheme, Hirschberg());
 }
 
+// Scoring matrices are handled by the generalization of Myers and Miller.
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            Hirschberg const & /*algorithmTag*/)
+{
+    return _globalAlignmentMyersMiller(gapsH, gapsV, scoringScheme);
+}
+
 template <typename TSequence, typename TAlignSpec,
-typename TScoreValue>
+typename TScoreValue, typename TScoreSpec>
 TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
-                            Score<TScoreValue, Simple> const & scoringScheme,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
                             Hirschberg const & /*algorithmTag*/)
 {
     SEQAN_ASSERT_EQ(length(rows(align)), 2u);
@@ -131,10 +146,10 @@ int globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
 
 template <typename TAlphabetH, typename TSpecH,
           typename TAlphabetV, typename TSpecV,
-          typename TScoreValue>
+          typename TScoreValue, typename TScoreSpec>
 TScoreValue globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
                                  String<TAlphabetV, TSpecV> const & seqV,
-                                 Score<TScoreValue, Simple> const & scoringScheme,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
                                  Hirschberg const & algorithmTag)
 {
     Gaps<String<TAlphabetH, TSpecH> const, ArrayGaps> gapsH(seqH);
@@ -196,6 +211,228 @@ int globalAlignmentScore(StringSet<TString, TSpec> const & strings,
     return _globalAlignmentScore(strings[0], strings[1], algorithmTag);
 }
 
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                                         [Striped]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            Striped const & /*algorithmTag*/)
+{
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    String<TraceSegment_<TPosition, TSize> > traceSegments;
+    TScoreValue res = _alignStriped(traceSegments, source(gapsH), source(gapsV), scoringScheme, DPGlobal(),
+                                    TracebackOn<>());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+#else
+    return globalAlignment(gapsH, gapsV, scoringScheme);
+#endif
+}
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            Striped const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    return globalAlignment(row(align, 0), row(align, 1), scoringScheme, algorithmTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()                                    [Striped]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TSequenceV,
+          typename TScoreValue, typename TScoreSpec>
+SEQAN_FUNC_DISABLE_IF(And<And<Is<ContainerConcept<TSequenceH>>, Is<ContainerConcept<typename Value<TSequenceH>::Type>>>,
+                          And<Is<ContainerConcept<TSequenceV>>, Is<ContainerConcept<typename Value<TSequenceV>::Type>>>
+                         >,
+                      TScoreValue)
+globalAlignmentScore(TSequenceH const & seqH,
+                     TSequenceV const & seqV,
+                     Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                     Striped const & /*algorithmTag*/)
+{
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _alignStriped(traceSegments, seqH, seqV, scoringScheme, DPGlobal(), TracebackOff());
+#else
+    return globalAlignmentScore(seqH, seqV, scoringScheme);
+#endif
+}
+
+template <typename TString, typename TSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignmentScore(StringSet<TString, TSpec> const & strings,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 Striped const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(strings), 2u);
+    return globalAlignmentScore(strings[0], strings[1], scoringScheme, algorithmTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                                     [Wfa, BiWfa]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TAlgorithmSpec>
+SEQAN_FUNC_ENABLE_IF(Or<IsSameType<Tag<TAlgorithmSpec>, Wfa>, IsSameType<Tag<TAlgorithmSpec>, BiWfa> >, TScoreValue)
+globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                Score<TScoreValue, Simple> const & scoringScheme,
+                Tag<TAlgorithmSpec> const & algorithmTag)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    // Fall back to dynamic programming, in linear memory for BiWfa.
+    if (!_isWfaApplicable(scoringScheme))
+    {
+        if (IsSameType<Tag<TAlgorithmSpec>, BiWfa>::VALUE)
+            return globalAlignment(gapsH, gapsV, scoringScheme, Hirschberg());
+        return globalAlignment(gapsH, gapsV, scoringScheme);
+    }
+
+    String<TraceSegment_<TPosition, TSize> > traceSegments;
+    TScoreValue res = _globalAlignmentWfa(traceSegments, source(gapsH), source(gapsV), scoringScheme, algorithmTag,
+                                          TracebackOn<>());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+}
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TAlgorithmSpec>
+SEQAN_FUNC_ENABLE_IF(Or<IsSameType<Tag<TAlgorithmSpec>, Wfa>, IsSameType<Tag<TAlgorithmSpec>, BiWfa> >, TScoreValue)
+globalAlignment(Align<TSequence, TAlignSpec> & align,
+                Score<TScoreValue, Simple> const & scoringScheme,
+                Tag<TAlgorithmSpec> const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    return globalAlignment(row(align, 0), row(align, 1), scoringScheme, algorithmTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()                                [Wfa, BiWfa]
+// ----------------------------------------------------------------------------
+
+template <typename TAlphabetH, typename TSpecH,
+          typename TAlphabetV, typename TSpecV,
+          typename TScoreValue, typename TAlgorithmSpec>
+SEQAN_FUNC_ENABLE_IF(Or<IsSameType<Tag<TAlgorithmSpec>, Wfa>, IsSameType<Tag<TAlgorithmSpec>, BiWfa> >, TScoreValue)
+globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
+                     String<TAlphabetV, TSpecV> const & seqV,
+                     Score<TScoreValue, Simple> const & scoringScheme,
+                     Tag<TAlgorithmSpec> const & algorithmTag)
+{
+    if (!_isWfaApplicable(scoringScheme))
+        return globalAlignmentScore(seqH, seqV, scoringScheme);
+
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _globalAlignmentWfa(traceSegments, seqH, seqV, scoringScheme, algorithmTag, TracebackOff());
+}
+
+template <typename TString, typename TSpec,
+          typename TScoreValue, typename TAlgorithmSpec>
+SEQAN_FUNC_ENABLE_IF(Or<IsSameType<Tag<TAlgorithmSpec>, Wfa>, IsSameType<Tag<TAlgorithmSpec>, BiWfa> >, TScoreValue)
+globalAlignmentScore(StringSet<TString, TSpec> const & strings,
+                     Score<TScoreValue, Simple> const & scoringScheme,
+                     Tag<TAlgorithmSpec> const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(strings), 2u);
+    return globalAlignmentScore(strings[0], strings[1], scoringScheme, algorithmTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                            [DifferenceRecurrence]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            int lowerDiag,
+                            int upperDiag,
+                            DifferenceRecurrence const & /*algorithmTag*/)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    int const diagEnd = static_cast<int>(length(source(gapsH))) - static_cast<int>(length(source(gapsV)));
+    if (!_isDifferenceRecurrenceApplicable(scoringScheme) || lowerDiag > 0 || upperDiag < 0 ||
+        lowerDiag > diagEnd || upperDiag < diagEnd)
+        return globalAlignment(gapsH, gapsV, scoringScheme, lowerDiag, upperDiag);
+
+    String<TraceSegment_<TPosition, TSize> > traceSegments;
+    TScoreValue res = _alignDifferenceRecurrence(traceSegments, source(gapsH), source(gapsV), scoringScheme,
+                                                 lowerDiag, upperDiag, false, -1, TracebackOn<>());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+}
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            int lowerDiag,
+                            int upperDiag,
+                            DifferenceRecurrence const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    return globalAlignment(row(align, 0), row(align, 1), scoringScheme, lowerDiag, upperDiag, algorithmTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()                       [DifferenceRecurrence]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TSequenceV,
+          typename TScoreValue, typename TScoreSpec>
+SEQAN_FUNC_DISABLE_IF(And<And<Is<ContainerConcept<TSequenceH>>, Is<ContainerConcept<typename Value<TSequenceH>::Type>>>,
+                          And<Is<ContainerConcept<TSequenceV>>, Is<ContainerConcept<typename Value<TSequenceV>::Type>>>
+                         >,
+                      TScoreValue)
+globalAlignmentScore(TSequenceH const & seqH,
+                     TSequenceV const & seqV,
+                     Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                     int lowerDiag,
+                     int upperDiag,
+                     DifferenceRecurrence const & /*algorithmTag*/)
+{
+    int const diagEnd = static_cast<int>(length(seqH)) - static_cast<int>(length(seqV));
+    if (!_isDifferenceRecurrenceApplicable(scoringScheme) || lowerDiag > 0 || upperDiag < 0 ||
+        lowerDiag > diagEnd || upperDiag < diagEnd)
+        return globalAlignmentScore(seqH, seqV, scoringScheme, lowerDiag, upperDiag);
+
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _alignDifferenceRecurrence(traceSegments, seqH, seqV, scoringScheme, lowerDiag, upperDiag, false, -1,
+                                      TracebackOff());
+}
+
+template <typename TString, typename TSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignmentScore(StringSet<TString, TSpec> const & strings,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 int lowerDiag,
+                                 int upperDiag,
+                                 DifferenceRecurrence const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(strings), 2u);
+    return globalAlignmentScore(strings[0], strings[1], scoringScheme, lowerDiag, upperDiag, algorithmTag);
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_SPECIALIZED_H_
@@ -130,13 +130,16 @@ class Fragment;
  * Fourth, you can select the algorithm to use with <tt>algorithmTag</tt>.  This can be one of @link
  * AlignmentAlgorithmTags#NeedlemanWunsch @endlink and @link AlignmentAlgorithmTags#Gotoh @endlink.  The
  * Needleman-Wunsch algorithm supports scoring schemes with linear gap costs only while Gotoh's algorithm also allows
- * affine gap costs.
+ * affine gap costs.  Wrapping either tag into @link AlignmentAlgorithmTags#PackedTrace @endlink, e.g.
+ * <tt>PackedTrace&lt;Gotoh&gt;()</tt>, stores the trace matrix with 2 or 4 bits per cell for long sequences.
  *
  * The available alignment algorithms all have some restrictions.  Gotoh's algorithm can handle arbitrary substitution
  * and affine gap scores.  Needleman-Wunsch is limited to linear gap scores.  The implementation of Hirschberg's
- * algorithm is further limited that it does not support <tt>alignConfig</tt> objects or banding.  The implementation of
- * the Myers-Hirschberg algorithm further limits this to only support edit distance (as scores, matches are scored with
- * 0, mismatches are scored with -1).
+ * algorithm does not support <tt>alignConfig</tt> objects or banding; affine gap scores are aligned in linear memory
+ * with the algorithm of Myers and Miller.  The implementation of the Myers-Hirschberg algorithm only supports edit
+ * distance (as scores, matches are scored with 0, mismatches are scored with -1).  The same holds for Myers'
+ * bit-vector algorithm, which computes the alignment with a block-based variant restricted to Ukkonen's band, so that
+ * time and memory grow with the edit distance.
  *
  * The examples below show some common use cases.
  *
@@ -533,8 +536,7 @@ TScoreValue globalAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec>
  *                          (Metafunction: @link Score#Value @endlink of the type of <tt>scoringScheme</tt>).
  *
  * This function does not perform the (linear time) traceback step after the (mostly quadratic time) dynamic programming
- * step.  Note that Myers' bit-vector algorithm does not compute an alignment (only in the Myers-Hirschberg variant) but
- * scores can be computed using <tt>globalAlignmentScore</tt>.
+ * step.
  * Global alignment score can be either used with two sequences or two sets of sequences of equal size.
  *
  * The same limitations to algorithms as in @link globalAlignment @endlink apply.  Furthermore, the
@@ -553,6 +555,9 @@ TScoreValue globalAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec>
  * can compute in parallel. This depends on the architecture's supported SIMD vector width (128 bit, 256 bit or 512 bit)
  * and the selected score type, e.g. <tt>int16_t</tt>. For example on a CPU architecture that supports SSE4 and a score
  * type of <tt>int16_t</tt>, <tt>128/16 = 8</tt> alignments can be computed in parallel on a single core.
+ * Without a band, the score type only bounds the vector element type: pairs whose scores do not overflow a
+ * narrower type are computed in 8 bit or 16 bit elements, e.g. 32 instead of 8 alignments with AVX2 for a
+ * score type of <tt>int</tt>.
  *
  * In addition, the execution policy can be configured for multi-threaded execution, such that either chunks of sequence
  * pairs from the initial collection are spawned and executed on different threads or an intra-sequence parallelization
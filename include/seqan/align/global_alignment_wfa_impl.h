@@ -0,0 +1,753 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Gap-affine wavefront alignment (WFA, Marco-Sola et al. 2021) and its
+// bidirectional linear-memory variant (BiWFA, Marco-Sola et al. 2023).
+//
+// The WFA computes, for increasing penalty s, the furthest reaching offset on
+// every diagonal k = h - v that can be reached with penalty s, separately for
+// the states M (match/mismatch), I (gap in the vertical sequence) and D (gap
+// in the horizontal sequence).  Runs of matches are skipped by extending the
+// M offsets along their diagonals, so the run time is O(n s) for a penalty s.
+//
+// The WFA works on penalties with a free match.  A Simple scoring scheme with
+// match score M, mismatch score X, gap open score GO and gap extend score GE
+// is transformed into the penalties 2(M - X) per mismatch, M - 2 GE per gap
+// character and 2(GE - GO) per gap, which changes the score of every global
+// alignment of the two sequences by the same amount (Eizenga and Paten 2022).
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_WFA_IMPL_H_
+#define SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_WFA_IMPL_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Enum WfaComponent_
+// ----------------------------------------------------------------------------
+
+enum WfaComponent_
+{
+    WFA_M = 0,
+    WFA_I = 1,  // Horizontal gap, consumes a character of the horizontal sequence.
+    WFA_D = 2   // Vertical gap, consumes a character of the vertical sequence.
+};
+
+// ----------------------------------------------------------------------------
+// Class WfaConfig_
+// ----------------------------------------------------------------------------
+
+struct WfaConfig_
+{
+    // Offset of diagonals that cannot be reached with the current penalty.
+    static const int NONE = -(1 << 30);
+
+    // BiWFA sub-problems up to this penalty or size are aligned with the full WFA.
+    static const int BIWFA_BASE_PENALTY = 250;
+    static const int BIWFA_BASE_LENGTH = 1000;
+};
+
+// ----------------------------------------------------------------------------
+// Class WfaPenalties_
+// ----------------------------------------------------------------------------
+
+struct WfaPenalties_
+{
+    int mismatch;
+    int gapOpen;    // Charged once per gap.
+    int gapExtend;  // Charged for every gap character.
+    int factor;     // The common divisor that was removed from the penalties.
+};
+
+// ----------------------------------------------------------------------------
+// Class WfaWavefront_
+// ----------------------------------------------------------------------------
+
+// Furthest reaching offsets of all three components on the diagonals [lo, hi] for one penalty.
+struct WfaWavefront_
+{
+    int lo;
+    int hi;
+    String<int> offsets[3];
+
+    WfaWavefront_() : lo(1), hi(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class WfaWavefronts_
+// ----------------------------------------------------------------------------
+
+// The wavefronts of penalties [0, score].  If window is not 0 only the last window wavefronts are kept.
+struct WfaWavefronts_
+{
+    String<WfaWavefront_> wavefronts;
+    int window;
+    int score;
+
+    WfaWavefronts_() : window(0), score(-1)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class WfaSequences_
+// ----------------------------------------------------------------------------
+
+// The infixes [begH, endH) and [begV, endV) of the two sequences, read from the back if TReverse is True.
+template <typename TSequenceH, typename TSequenceV, typename TReverse>
+struct WfaSequences_
+{
+    TSequenceH const & seqH;
+    TSequenceV const & seqV;
+    int begH;
+    int endH;
+    int begV;
+    int endV;
+
+    WfaSequences_(TSequenceH const & _seqH, TSequenceV const & _seqV, int _begH, int _endH, int _begV, int _endV) :
+        seqH(_seqH), seqV(_seqV), begH(_begH), endH(_endH), begV(_begV), endV(_endV)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Class WfaBreakpoint_
+// ----------------------------------------------------------------------------
+
+struct WfaBreakpoint_
+{
+    int diagonal;
+    int offset;
+    int component;
+    int scoreForward;
+    int scoreReverse;
+    int score;
+
+    WfaBreakpoint_() : diagonal(0), offset(0), component(WFA_M), scoreForward(0), scoreReverse(0), score(-1)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _wfaPenalties()
+// ----------------------------------------------------------------------------
+
+// Transforms the scores into the penalties mismatch x = 2(M - X), gap open o = 2(E - O) and gap extension
+// e = M - 2E, which are divided by their greatest common divisor afterwards.
+template <typename TScoreValue>
+inline WfaPenalties_
+_wfaPenaltiesUnscaled(Score<TScoreValue, Simple> const & scoringScheme)
+{
+    static_assert(std::is_integral<TScoreValue>::value, "The WFA requires integral scores.");
+
+    int match = scoreMatch(scoringScheme);
+    int gapExtend = scoreGapExtend(scoringScheme);
+
+    WfaPenalties_ penalties;
+    penalties.mismatch = 2 * (match - static_cast<int>(scoreMismatch(scoringScheme)));
+    penalties.gapOpen = 2 * (gapExtend - static_cast<int>(scoreGapOpen(scoringScheme)));
+    penalties.gapExtend = match - 2 * gapExtend;
+    penalties.factor = 1;
+    return penalties;
+}
+
+template <typename TScoreValue>
+inline WfaPenalties_
+_wfaPenalties(Score<TScoreValue, Simple> const & scoringScheme)
+{
+    WfaPenalties_ penalties = _wfaPenaltiesUnscaled(scoringScheme);
+
+    SEQAN_ASSERT_GT_MSG(penalties.mismatch, 0, "The WFA requires a mismatch score lower than the match score.");
+    SEQAN_ASSERT_GT_MSG(penalties.gapExtend, 0, "The WFA requires a gap extension score lower than half the match score.");
+    SEQAN_ASSERT_GEQ_MSG(penalties.gapOpen, 0, "The WFA requires a gap open score not higher than the gap extension score.");
+
+    penalties.factor = std::gcd(std::gcd(penalties.mismatch, penalties.gapExtend), penalties.gapOpen);
+    penalties.mismatch /= penalties.factor;
+    penalties.gapOpen /= penalties.factor;
+    penalties.gapExtend /= penalties.factor;
+    return penalties;
+}
+
+// ----------------------------------------------------------------------------
+// Function _isWfaApplicable()
+// ----------------------------------------------------------------------------
+
+// The wavefronts only advance if mismatches and gap extensions have a positive penalty.
+template <typename TScoreValue>
+inline bool
+_isWfaApplicable(Score<TScoreValue, Simple> const & scoringScheme)
+{
+    WfaPenalties_ penalties = _wfaPenaltiesUnscaled(scoringScheme);
+    return penalties.mismatch > 0 && penalties.gapExtend > 0 && penalties.gapOpen >= 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaScore()
+// ----------------------------------------------------------------------------
+
+// Transforms the penalty of a global alignment back into the score of the scoring scheme.
+template <typename TScoreValue>
+inline TScoreValue
+_wfaScore(Score<TScoreValue, Simple> const & scoringScheme, WfaPenalties_ const & penalties,
+          int64_t lengthH, int64_t lengthV, int penalty)
+{
+    return static_cast<TScoreValue>((scoreMatch(scoringScheme) * (lengthH + lengthV) -
+                                     static_cast<int64_t>(penalty) * penalties.factor) / 2);
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaLengthH(), _wfaLengthV(), _wfaEqual()
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TSequenceV, typename TReverse>
+inline int
+_wfaLengthH(WfaSequences_<TSequenceH, TSequenceV, TReverse> const & seqs)
+{
+    return seqs.endH - seqs.begH;
+}
+
+template <typename TSequenceH, typename TSequenceV, typename TReverse>
+inline int
+_wfaLengthV(WfaSequences_<TSequenceH, TSequenceV, TReverse> const & seqs)
+{
+    return seqs.endV - seqs.begV;
+}
+
+template <typename TSequenceH, typename TSequenceV>
+inline bool
+_wfaEqual(WfaSequences_<TSequenceH, TSequenceV, False> const & seqs, int h, int v)
+{
+    return seqs.seqH[seqs.begH + h] == seqs.seqV[seqs.begV + v];
+}
+
+template <typename TSequenceH, typename TSequenceV>
+inline bool
+_wfaEqual(WfaSequences_<TSequenceH, TSequenceV, True> const & seqs, int h, int v)
+{
+    return seqs.seqH[seqs.endH - 1 - h] == seqs.seqV[seqs.endV - 1 - v];
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaWavefront()
+// ----------------------------------------------------------------------------
+
+// Returns the wavefront of the given penalty or 0 if it is not available.
+inline WfaWavefront_ const *
+_wfaWavefront(WfaWavefronts_ const & wfs, int score)
+{
+    if (score < 0 || score > wfs.score || (wfs.window != 0 && score <= wfs.score - wfs.window))
+        return 0;
+    return &wfs.wavefronts[(wfs.window == 0) ? score : score % wfs.window];
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaOffset()
+// ----------------------------------------------------------------------------
+
+inline int
+_wfaOffset(WfaWavefront_ const * wf, int component, int k)
+{
+    if (wf == 0 || k < wf->lo || k > wf->hi)
+        return WfaConfig_::NONE;
+    return wf->offsets[component][k - wf->lo];
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaClip()
+// ----------------------------------------------------------------------------
+
+// Invalidates offsets that leave the DP matrix.
+inline int
+_wfaClip(int offset, int k, int lengthH, int lengthV)
+{
+    return (offset < 0 || offset > lengthH || offset - k > lengthV) ? WfaConfig_::NONE : offset;
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaNextWavefront()
+// ----------------------------------------------------------------------------
+
+// Appends the wavefront of the next penalty.
+inline WfaWavefront_ &
+_wfaNextWavefront(WfaWavefronts_ & wfs)
+{
+    ++wfs.score;
+    if (wfs.window == 0)
+    {
+        resize(wfs.wavefronts, wfs.score + 1);
+        return back(wfs.wavefronts);
+    }
+    if (static_cast<int>(length(wfs.wavefronts)) < wfs.window)
+        resize(wfs.wavefronts, wfs.window);
+    return wfs.wavefronts[wfs.score % wfs.window];
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaExtend()
+// ----------------------------------------------------------------------------
+
+template <typename TSequences>
+inline void
+_wfaExtend(WfaWavefront_ & wf, TSequences const & seqs)
+{
+    int const lengthH = _wfaLengthH(seqs);
+    int const lengthV = _wfaLengthV(seqs);
+
+    for (int k = wf.lo; k <= wf.hi; ++k)
+    {
+        int & h = wf.offsets[WFA_M][k - wf.lo];
+        if (h < 0)
+            continue;
+        int v = h - k;
+        while (h < lengthH && v < lengthV && _wfaEqual(seqs, h, v))
+        {
+            ++h;
+            ++v;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaInit()
+// ----------------------------------------------------------------------------
+
+// Computes the wavefront of penalty 0 for an alignment starting in the given component.  The gap of a gap component
+// is already opened.  It may be left immediately if emptyGap is true and must be extended at least once otherwise.
+template <typename TSequences>
+inline void
+_wfaInit(WfaWavefronts_ & wfs, TSequences const & seqs, int startComponent, bool emptyGap = true)
+{
+    wfs.score = -1;
+    WfaWavefront_ & wf = _wfaNextWavefront(wfs);
+    wf.lo = wf.hi = 0;
+    for (unsigned c = 0; c < 3; ++c)
+    {
+        resize(wf.offsets[c], 1, Exact());
+        bool reachable = static_cast<int>(c) == startComponent || (c == WFA_M && emptyGap);
+        wf.offsets[c][0] = reachable ? 0 : WfaConfig_::NONE;
+    }
+    _wfaExtend(wf, seqs);
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaCompute()
+// ----------------------------------------------------------------------------
+
+// Computes the wavefront of the next penalty from its predecessors and extends it.
+template <typename TSequences>
+inline void
+_wfaCompute(WfaWavefronts_ & wfs, TSequences const & seqs, WfaPenalties_ const & penalties)
+{
+    int const lengthH = _wfaLengthH(seqs);
+    int const lengthV = _wfaLengthV(seqs);
+    // The new wavefront is allocated first, since this can move the others.  In windowed mode its slot is not
+    // used by any of its sources.
+    WfaWavefront_ & wf = _wfaNextWavefront(wfs);
+    int const s = wfs.score;
+
+    WfaWavefront_ const * wfMismatch = _wfaWavefront(wfs, s - penalties.mismatch);
+    WfaWavefront_ const * wfOpen = _wfaWavefront(wfs, s - penalties.gapOpen - penalties.gapExtend);
+    WfaWavefront_ const * wfExtend = _wfaWavefront(wfs, s - penalties.gapExtend);
+
+    int lo = lengthH + 1;
+    int hi = -lengthV - 1;
+    WfaWavefront_ const * sources[3] = {wfMismatch, wfOpen, wfExtend};
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        if (sources[i] != 0 && sources[i]->lo <= sources[i]->hi)
+        {
+            lo = _min(lo, sources[i]->lo - 1);
+            hi = _max(hi, sources[i]->hi + 1);
+        }
+    }
+    lo = _max(lo, -lengthV);
+    hi = _min(hi, lengthH);
+
+    wf.lo = lo;
+    wf.hi = hi;
+    if (lo > hi)
+        return;
+
+    for (unsigned c = 0; c < 3; ++c)
+        resize(wf.offsets[c], hi - lo + 1, Exact());
+
+    for (int k = lo; k <= hi; ++k)
+    {
+        int i = _max(_wfaOffset(wfOpen, WFA_M, k - 1), _wfaOffset(wfExtend, WFA_I, k - 1)) + 1;
+        int d = _max(_wfaOffset(wfOpen, WFA_M, k + 1), _wfaOffset(wfExtend, WFA_D, k + 1));
+        i = _wfaClip(i, k, lengthH, lengthV);
+        d = _wfaClip(d, k, lengthH, lengthV);
+        int m = _wfaClip(_wfaOffset(wfMismatch, WFA_M, k) + 1, k, lengthH, lengthV);
+
+        wf.offsets[WFA_I][k - lo] = i;
+        wf.offsets[WFA_D][k - lo] = d;
+        wf.offsets[WFA_M][k - lo] = _max(m, _max(i, d));
+    }
+    _wfaExtend(wf, seqs);
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaReachedEnd()
+// ----------------------------------------------------------------------------
+
+template <typename TSequences>
+inline bool
+_wfaReachedEnd(WfaWavefronts_ const & wfs, TSequences const & seqs, int endComponent)
+{
+    int const lengthH = _wfaLengthH(seqs);
+    return _wfaOffset(_wfaWavefront(wfs, wfs.score), endComponent, lengthH - _wfaLengthV(seqs)) == lengthH;
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaRecordSegment()
+// ----------------------------------------------------------------------------
+
+// Records a segment and merges it with the previously recorded one if they form a single run.
+template <typename TTraceSegments, typename TTraceValue>
+inline void
+_wfaRecordSegment(TTraceSegments & traceSegments, int hBegin, int vBegin, int len, TTraceValue traceValue)
+{
+    if (len == 0)
+        return;
+
+    if (!empty(traceSegments))
+    {
+        typename Value<TTraceSegments>::Type & last = back(traceSegments);
+        int dh = (traceValue == TraceBitMap_<>::VERTICAL) ? 0 : len;
+        int dv = (traceValue == TraceBitMap_<>::HORIZONTAL) ? 0 : len;
+        if (last._traceValue == traceValue &&
+            static_cast<int>(last._horizontalBeginPos) == hBegin + dh &&
+            static_cast<int>(last._verticalBeginPos) == vBegin + dv)
+        {
+            last._horizontalBeginPos = hBegin;
+            last._verticalBeginPos = vBegin;
+            last._length += len;
+            return;
+        }
+    }
+    _recordSegment(traceSegments, hBegin, vBegin, len, traceValue);
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaTraceback()
+// ----------------------------------------------------------------------------
+
+// Records the trace segments from the end of the alignment back to its begin.  All wavefronts must be kept.
+template <typename TTraceSegments, typename TSequences>
+inline void
+_wfaTraceback(TTraceSegments & traceSegments,
+              WfaWavefronts_ const & wfs,
+              TSequences const & seqs,
+              WfaPenalties_ const & penalties,
+              int endComponent)
+{
+    SEQAN_ASSERT_EQ(wfs.window, 0);
+
+    int const lengthH = _wfaLengthH(seqs);
+    int const lengthV = _wfaLengthV(seqs);
+    int const offH = seqs.begH;
+    int const offV = seqs.begV;
+
+    int s = wfs.score;
+    int k = lengthH - lengthV;
+    int h = lengthH;
+    int component = endComponent;
+
+    while (true)
+    {
+        WfaWavefront_ const * wf = _wfaWavefront(wfs, s);
+        if (component == WFA_M)
+        {
+            int mismatch = WfaConfig_::NONE;
+            int i = WfaConfig_::NONE;
+            int d = WfaConfig_::NONE;
+            int origin = 0;
+            if (s > 0)
+            {
+                mismatch = _wfaClip(_wfaOffset(_wfaWavefront(wfs, s - penalties.mismatch), WFA_M, k) + 1, k,
+                                    lengthH, lengthV);
+                i = _wfaOffset(wf, WFA_I, k);
+                d = _wfaOffset(wf, WFA_D, k);
+                origin = _max(mismatch, _max(i, d));
+            }
+            SEQAN_ASSERT_GEQ(origin, 0);
+            _wfaRecordSegment(traceSegments, offH + origin, offV + origin - k, h - origin, TraceBitMap_<>::DIAGONAL);
+            h = origin;
+            if (s == 0)
+                break;
+
+            if (origin == i)
+            {
+                component = WFA_I;
+            }
+            else if (origin == d)
+            {
+                component = WFA_D;
+            }
+            else
+            {
+                --h;
+                _wfaRecordSegment(traceSegments, offH + h, offV + h - k, 1, TraceBitMap_<>::DIAGONAL);
+                s -= penalties.mismatch;
+            }
+        }
+        else if (component == WFA_I)
+        {
+            if (s == 0)
+                break;
+            --h;
+            _wfaRecordSegment(traceSegments, offH + h, offV + h + 1 - k, 1, TraceBitMap_<>::HORIZONTAL);
+            --k;
+            if (_wfaOffset(_wfaWavefront(wfs, s - penalties.gapExtend), WFA_I, k) == h)
+            {
+                s -= penalties.gapExtend;
+            }
+            else
+            {
+                s -= penalties.gapOpen + penalties.gapExtend;
+                component = WFA_M;
+            }
+        }
+        else
+        {
+            if (s == 0)
+                break;
+            _wfaRecordSegment(traceSegments, offH + h, offV + h - k - 1, 1, TraceBitMap_<>::VERTICAL);
+            ++k;
+            if (_wfaOffset(_wfaWavefront(wfs, s - penalties.gapExtend), WFA_D, k) == h)
+            {
+                s -= penalties.gapExtend;
+            }
+            else
+            {
+                s -= penalties.gapOpen + penalties.gapExtend;
+                component = WFA_M;
+            }
+        }
+    }
+    SEQAN_ASSERT_EQ(h, 0);
+    SEQAN_ASSERT_EQ(k, 0);
+}
+
+// ----------------------------------------------------------------------------
+// Function _wfaAlign()
+// ----------------------------------------------------------------------------
+
+// Computes the minimal penalty of the alignment of the infixes that starts and ends in the given components.
+// Keeps all wavefronts if the traceback is enabled and only the ones that are still needed otherwise.
+template <typename TTraceSegments, typename TSequences, typename TTracebackConfig>
+inline int
+_wfaAlign(TTraceSegments & traceSegments,
+          TSequences const & seqs,
+          WfaPenalties_ const & penalties,
+          int startComponent,
+          int endComponent,
+          TTracebackConfig const & /*tag*/)
+{
+    WfaWavefronts_ wfs;
+    if (!IsTracebackEnabled_<TTracebackConfig>::VALUE)
+        wfs.window = _max(penalties.mismatch, penalties.gapOpen + penalties.gapExtend) + 1;
+
+    _wfaInit(wfs, seqs, startComponent);
+    while (!_wfaReachedEnd(wfs, seqs, endComponent))
+        _wfaCompute(wfs, seqs, penalties);
+
+    if (IsTracebackEnabled_<TTracebackConfig>::VALUE)
+        _wfaTraceback(traceSegments, wfs, seqs, penalties, endComponent);
+    return wfs.score;
+}
+
+// ----------------------------------------------------------------------------
+// Function _biwfaOverlap()
+// ----------------------------------------------------------------------------
+
+// Checks whether a forward and a reverse wavefront meet and keeps the best breakpoint.
+inline void
+_biwfaOverlap(WfaBreakpoint_ & breakpoint,
+              WfaWavefront_ const * wfForward, int scoreForward,
+              WfaWavefront_ const * wfReverse, int scoreReverse,
+              int lengthH, int lengthV,
+              WfaPenalties_ const & penalties)
+{
+    if (wfForward == 0 || wfReverse == 0)
+        return;
+
+    int const kEnd = lengthH - lengthV;
+    // The diagonal k of the forward wavefront is the diagonal kEnd - k of the reverse wavefront.
+    int lo = _max(wfForward->lo, kEnd - wfReverse->hi);
+    int hi = _min(wfForward->hi, kEnd - wfReverse->lo);
+    for (int k = lo; k <= hi; ++k)
+    {
+        for (int c = WFA_M; c <= WFA_D; ++c)
+        {
+            int f = _wfaOffset(wfForward, c, k);
+            int r = _wfaOffset(wfReverse, c, kEnd - k);
+            if (f < 0 || r < 0 || f + r < lengthH)
+                continue;
+
+            // The gap open of a gap that spans the breakpoint is charged in both directions.
+            int score = scoreForward + scoreReverse - ((c == WFA_M) ? 0 : penalties.gapOpen);
+            if (breakpoint.score < 0 || score < breakpoint.score)
+            {
+                breakpoint.diagonal = k;
+                breakpoint.offset = f;
+                breakpoint.component = c;
+                breakpoint.scoreForward = scoreForward;
+                breakpoint.scoreReverse = scoreReverse;
+                breakpoint.score = score;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _biwfaBreakpoint()
+// ----------------------------------------------------------------------------
+
+// Runs the WFA from both ends of the infixes until the wavefronts meet on an optimal alignment.
+template <typename TSequenceH, typename TSequenceV>
+inline WfaBreakpoint_
+_biwfaBreakpoint(WfaSequences_<TSequenceH, TSequenceV, False> const & seqs,
+                 WfaPenalties_ const & penalties,
+                 int startComponent,
+                 int endComponent)
+{
+    WfaSequences_<TSequenceH, TSequenceV, True> revSeqs(seqs.seqH, seqs.seqV, seqs.begH, seqs.endH,
+                                                       seqs.begV, seqs.endV);
+    int const lengthH = _wfaLengthH(seqs);
+    int const lengthV = _wfaLengthV(seqs);
+
+    // Along an alignment the penalties of the two directions differ by at most this much at some position.
+    int const window = _max(penalties.mismatch, penalties.gapOpen + penalties.gapExtend) + 2 * penalties.gapOpen + 1;
+    // An alignment that ends in a gap pays its gap open, which the reverse direction has not charged.
+    int const reverseShift = (endComponent == WFA_M) ? 0 : penalties.gapOpen;
+
+    WfaWavefronts_ forward;
+    WfaWavefronts_ reverse;
+    forward.window = reverse.window = window;
+    _wfaInit(forward, seqs, startComponent);
+    _wfaInit(reverse, revSeqs, endComponent, false);
+
+    WfaBreakpoint_ breakpoint;
+    _biwfaOverlap(breakpoint, _wfaWavefront(forward, 0), 0, _wfaWavefront(reverse, 0), reverseShift, lengthH, lengthV,
+                  penalties);
+
+    while (breakpoint.score < 0 || forward.score + reverse.score + reverseShift < breakpoint.score + window)
+    {
+        _wfaCompute(forward, seqs, penalties);
+        for (int s = _max(0, reverse.score - window + 1); s <= reverse.score; ++s)
+            _biwfaOverlap(breakpoint, _wfaWavefront(forward, forward.score), forward.score,
+                          _wfaWavefront(reverse, s), s + reverseShift, lengthH, lengthV, penalties);
+
+        _wfaCompute(reverse, revSeqs, penalties);
+        for (int s = _max(0, forward.score - window + 1); s <= forward.score; ++s)
+            _biwfaOverlap(breakpoint, _wfaWavefront(forward, s), s,
+                          _wfaWavefront(reverse, reverse.score), reverse.score + reverseShift, lengthH, lengthV, penalties);
+    }
+    return breakpoint;
+}
+
+// ----------------------------------------------------------------------------
+// Function _biwfaAlign()
+// ----------------------------------------------------------------------------
+
+// Splits the alignment at a breakpoint on an optimal alignment and aligns both halves recursively, such that
+// the memory is linear in the penalty.  The trace segments of the second half are recorded first.
+template <typename TTraceSegments, typename TSequenceH, typename TSequenceV>
+inline int
+_biwfaAlign(TTraceSegments & traceSegments,
+            WfaSequences_<TSequenceH, TSequenceV, False> const & seqs,
+            WfaPenalties_ const & penalties,
+            int startComponent,
+            int endComponent,
+            int penaltyBound)
+{
+    if ((penaltyBound >= 0 && penaltyBound <= WfaConfig_::BIWFA_BASE_PENALTY) ||
+        _wfaLengthH(seqs) + _wfaLengthV(seqs) <= WfaConfig_::BIWFA_BASE_LENGTH)
+        return _wfaAlign(traceSegments, seqs, penalties, startComponent, endComponent, TracebackOn<>());
+
+    WfaBreakpoint_ bp = _biwfaBreakpoint(seqs, penalties, startComponent, endComponent);
+    int const splitH = seqs.begH + bp.offset;
+    int const splitV = seqs.begV + bp.offset - bp.diagonal;
+    int const gapOpen = (bp.component == WFA_M) ? 0 : penalties.gapOpen;
+
+    WfaSequences_<TSequenceH, TSequenceV, False> suffixSeqs(seqs.seqH, seqs.seqV, splitH, seqs.endH, splitV, seqs.endV);
+    WfaSequences_<TSequenceH, TSequenceV, False> prefixSeqs(seqs.seqH, seqs.seqV, seqs.begH, splitH, seqs.begV, splitV);
+    int score = _biwfaAlign(traceSegments, suffixSeqs, penalties, bp.component, endComponent,
+                            bp.scoreReverse - gapOpen);
+    score += _biwfaAlign(traceSegments, prefixSeqs, penalties, startComponent, bp.component, bp.scoreForward);
+    SEQAN_ASSERT_EQ(score, bp.score);
+    return score;
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignmentWfa()
+// ----------------------------------------------------------------------------
+
+template <typename TTraceSegments, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TAlgorithmTag, typename TTracebackConfig>
+inline TScoreValue
+_globalAlignmentWfa(TTraceSegments & traceSegments,
+                    TSequenceH const & seqH,
+                    TSequenceV const & seqV,
+                    Score<TScoreValue, Simple> const & scoringScheme,
+                    TAlgorithmTag const & /*algorithmTag*/,
+                    TTracebackConfig const & /*tag*/)
+{
+    WfaPenalties_ penalties = _wfaPenalties(scoringScheme);
+    WfaSequences_<TSequenceH, TSequenceV, False> seqs(seqH, seqV, 0, length(seqH), 0, length(seqV));
+
+    int penalty;
+    if (IsSameType<TAlgorithmTag, BiWfa>::VALUE && IsTracebackEnabled_<TTracebackConfig>::VALUE)
+        penalty = _biwfaAlign(traceSegments, seqs, penalties, WFA_M, WFA_M, -1);
+    else
+        penalty = _wfaAlign(traceSegments, seqs, penalties, WFA_M, WFA_M, TTracebackConfig());
+
+    return _wfaScore(scoringScheme, penalties, length(seqH), length(seqV), penalty);
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_WFA_IMPL_H_
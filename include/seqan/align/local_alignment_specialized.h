@@ -0,0 +1,116 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Interface functions for local alignment with specialized algorithms.
+// ==========================================================================
+
+#ifndef SEQAN_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_SPECIALIZED_H_
+#define SEQAN_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_SPECIALIZED_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function localAlignment()                                          [Striped]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue localAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                           Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           Striped const & /*algorithmTag*/)
+{
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    String<TraceSegment_<TPosition, TSize> > traceSegments;
+    TScoreValue res = _alignStriped(traceSegments, source(gapsH), source(gapsV), scoringScheme, DPLocal(),
+                                    TracebackOn<>());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+#else
+    return localAlignment(gapsH, gapsV, scoringScheme);
+#endif
+}
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue localAlignment(Align<TSequence, TAlignSpec> & align,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           Striped const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    return localAlignment(row(align, 0), row(align, 1), scoringScheme, algorithmTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignmentScore()                                     [Striped]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TSequenceV,
+          typename TScoreValue, typename TScoreSpec>
+SEQAN_FUNC_DISABLE_IF(And<And<Is<ContainerConcept<TSequenceH>>, Is<ContainerConcept<typename Value<TSequenceH>::Type>>>,
+                          And<Is<ContainerConcept<TSequenceV>>, Is<ContainerConcept<typename Value<TSequenceV>::Type>>>
+                         >, TScoreValue)
+localAlignmentScore(TSequenceH const & seqH,
+                    TSequenceV const & seqV,
+                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                    Striped const & /*algorithmTag*/)
+{
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+    String<TraceSegment_<unsigned, unsigned> > traceSegments;  // Dummy segments.
+    return _alignStriped(traceSegments, seqH, seqV, scoringScheme, DPLocal(), TracebackOff());
+#else
+    return localAlignmentScore(seqH, seqV, scoringScheme);
+#endif
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_SPECIALIZED_H_
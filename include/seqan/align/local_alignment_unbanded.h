@@ -487,6 +487,9 @@ String<TScoreValue> localAlignment(StringSet<Align<TSequence, TAlignSpec> > & al
  * can compute in parallel. This depends on the architecture's supported SIMD vector width (128 bit, 256 bit or 512 bit)
  * and the selected score type, e.g. <tt>int16_t</tt>. For example on a CPU architecture that supports SSE4 and a score
  * type of <tt>int16_t</tt>, <tt>128/16 = 8</tt> alignments can be computed in parallel on a single core.
+ * Without a band, the score type only bounds the vector element type: pairs whose scores do not overflow a
+ * narrower type are computed in 8 bit or 16 bit elements, e.g. 32 instead of 8 alignments with AVX2 for a
+ * score type of <tt>int</tt>.
  *
  * In addition, the execution policy can be configured for multi-threaded execution, such that either chunks of sequence
  * pairs from the initial collection are spawned and executed on different threads or an intra-sequence parallelization
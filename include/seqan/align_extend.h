@@ -43,6 +43,9 @@
 
 #include <seqan/align_extend/align_extend_base.h>
 #include <seqan/align_extend/dp_scout_xdrop.h>
+#ifdef SEQAN_SIMD_ENABLED
+#include <seqan/align_extend/dp_scout_xdrop_simd.h>
+#endif  // SEQAN_SIMD_ENABLED
 #include <seqan/align_extend/align_extend.h>
 
 #endif
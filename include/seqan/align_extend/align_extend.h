@@ -204,6 +204,30 @@ _setUpAndRunAlignImpl(TAliExtContext_ & alignContext,
                                  TAlignConfig(lowerDiag, upperDiag));
 }
 
+// The difference recurrence stops with the Z-drop criterion instead of the X-drop one and falls back to the banded
+// X-drop extension if the scoring scheme does not fit into its 8 bit differences.
+template <typename TAliExtContext_, typename TString0, typename TString1, typename TScoreValue,
+          typename TScoreSpec, typename TTracebackConfig>
+inline TScoreValue
+_setUpAndRunAlignImpl(TAliExtContext_ & alignContext,
+                      TString0 const & str0,
+                      TString1 const & str1,
+                      Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                      int const lowerDiag,
+                      int const upperDiag,
+                      TScoreValue const zDrop,
+                      TTracebackConfig const & gapOrientation,
+                      True const & /*TBoolBanded*/,
+                      DifferenceRecurrence const & /*TBoolXDrop*/)
+{
+    if (!_isDifferenceRecurrenceApplicable(scoreScheme) || lowerDiag > 0 || upperDiag < 0)
+        return _setUpAndRunAlignImpl(alignContext, str0, str1, scoreScheme, lowerDiag, upperDiag, zDrop,
+                                     gapOrientation, True(), True());
+
+    return _alignDifferenceRecurrence(alignContext.traceSegment, str0, str1, scoreScheme, lowerDiag, upperDiag, true,
+                                      static_cast<int>(zDrop), TracebackOn<>());
+}
+
 // ----------------------------------------------------------------------------
 // Function _extendAlignmentImpl()
 // ----------------------------------------------------------------------------
@@ -436,6 +460,130 @@ _extendAlignmentImpl(Align<TStringInfix, TAlignSpec> & align,
     }
 }
 
+// ----------------------------------------------------------------------------
+// Function _extendAlignmentXDropSequential()
+// ----------------------------------------------------------------------------
+
+// Extends the pairs one after another.  The first trace segment ends in the maximum.
+template <typename TPosition, typename TSetH, typename TSetV, typename TScoreValue, typename TScoreSpec>
+inline void
+_extendAlignmentXDropSequential(String<TScoreValue> & scores,
+                                String<Pair<TPosition> > & endPositions,
+                                String<unsigned> const & positions,
+                                TSetH const & seqsH,
+                                TSetV const & seqsV,
+                                TScoreValue const xDrop,
+                                Score<TScoreValue, TScoreSpec> const & scoreScheme)
+{
+    typedef FreeEndGaps_<False, False, True, True> TFreeEndGaps;
+    typedef AlignConfig2<AlignExtend_<XDrop_<TScoreValue> >, DPBandConfig<BandOff>, TFreeEndGaps,
+                         TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > > TAlignConfig;
+
+    String<TraceSegment_<size_t, size_t> > traceSegments;
+    for (unsigned i = 0; i < length(positions); ++i)
+    {
+        unsigned const id = positions[i];
+        DPScoutState_<Terminator_<XDrop_<TScoreValue> > > scoutState(xDrop);
+        clear(traceSegments);
+        scores[id] = _setUpAndRunAlignment(traceSegments, scoutState, seqsH[id], seqsV[id], scoreScheme,
+                                           TAlignConfig());
+        if (!empty(traceSegments))
+            endPositions[id] = Pair<TPosition>(_getEndHorizontal(front(traceSegments)),
+                                               _getEndVertical(front(traceSegments)));
+    }
+}
+
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+// ----------------------------------------------------------------------------
+// Function _extendAlignmentXDropSimd()
+// ----------------------------------------------------------------------------
+
+// Extends the pairs at the given positions in batches of TSimdAlign lanes.  Every lane stops on its own X-drop
+// criterion, the batch stops as soon as all of its lanes stopped.
+template <typename TSimdAlign, typename TPosition, typename TSetH, typename TSetV, typename TScoreValue,
+          typename TScoreSpec, typename TGapModel>
+inline void
+_extendAlignmentXDropSimd(String<TScoreValue> & scores,
+                          String<Pair<TPosition> > & endPositions,
+                          String<unsigned> const & positions,
+                          TSetH const & seqsH,
+                          TSetV const & seqsV,
+                          TScoreValue const xDrop,
+                          Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                          TGapModel const & /*gaps*/)
+{
+    typedef StringSet<std::remove_const_t<typename Value<TSetH>::Type>, Dependent<> >   TDepSetH;
+    typedef StringSet<std::remove_const_t<typename Value<TSetV>::Type>, Dependent<> >   TDepSetV;
+    typedef DPProfile_<AlignExtend_<XDrop_<TSimdAlign> >, TGapModel, TracebackOff>      TDPProfile;
+    typedef SimdAlignXDropTraits_<TSimdAlign, TDepSetH, TDepSetV, TDPProfile>           TTraits;
+    typedef DPCell_<TSimdAlign, TGapModel>                                              TDPCell;
+    typedef typename TraceBitMap_<TSimdAlign>::Type                                     TTraceValue;
+    typedef DPContext<TDPCell, TTraceValue, String<TDPCell, Alloc<OverAligned> >,
+                      String<TTraceValue, Alloc<OverAligned> > >                        TDPContext;
+
+    unsigned const numAlignments = length(positions);
+    unsigned const sizeBatch = LENGTH<TSimdAlign>::VALUE;
+    unsigned const fullSize = sizeBatch * ((numAlignments + sizeBatch - 1) / sizeBatch);
+
+    // Create a SIMD scoring scheme.
+    Score<TSimdAlign, ScoreSimdWrapper<Score<TScoreValue, TScoreSpec> > > simdScoringScheme(scoreScheme);
+
+    TDPContext dpContext;
+    String<Nothing> traceSegments;  // We need to declare it, but it will not be used.
+    String<TSimdAlign, Alloc<OverAligned> > stringSimdH;
+    String<TSimdAlign, Alloc<OverAligned> > stringSimdV;
+    String<size_t> lengthsH;
+    String<size_t> lengthsV;
+
+    for (auto pos = 0u; pos < fullSize; pos += sizeBatch)
+    {
+        // Fill the last batch with the last pair.
+        TDepSetH depSetH;
+        TDepSetV depSetV;
+        for (unsigned i = pos; i < pos + sizeBatch; ++i)
+        {
+            auto const id = positions[std::min(i, numAlignments - 1)];
+            appendValue(depSetH, seqsH[id]);
+            appendValue(depSetV, seqsV[id]);
+        }
+
+        DPScoutState_<SimdAlignVariableLength<TTraits> > state(xDrop);
+        _prepareSimdAlignment(stringSimdH, stringSimdV, depSetH, depSetV, lengthsH, lengthsV, state);
+        TSimdAlign resultsBatch = _computeAlignment(dpContext, traceSegments, state, stringSimdH, stringSimdV,
+                                                    simdScoringScheme, DPBandConfig<BandOff>(), TDPProfile());
+
+        for (auto x = pos; x < pos + sizeBatch && x < numAlignments; ++x)
+        {
+            scores[positions[x]] = resultsBatch[x - pos];
+            endPositions[positions[x]] = Pair<TPosition>(state.maxPosH[x - pos], state.maxPosV[x - pos]);
+        }
+    }
+}
+
+template <typename TPosition, typename TSetH, typename TSetV, typename TScoreValue, typename TScoreSpec>
+inline void
+_extendAlignmentXDropSimd(String<TScoreValue> & scores,
+                          String<Pair<TPosition> > & endPositions,
+                          String<unsigned> & positions,
+                          TSetH const & seqsH,
+                          TSetV const & seqsV,
+                          TScoreValue const xDrop,
+                          Score<TScoreValue, TScoreSpec> const & scoreScheme)
+{
+    typedef typename SimdVector<TScoreValue>::Type TSimdAlign;
+
+    // Batches of pairs with similar lengths waste less lanes.
+    _sortSimdBatchPositions(positions, seqsH, seqsV);
+
+    if (scoreGapOpen(scoreScheme) == scoreGapExtend(scoreScheme))
+        _extendAlignmentXDropSimd<TSimdAlign>(scores, endPositions, positions, seqsH, seqsV, xDrop, scoreScheme,
+                                              LinearGaps());
+    else
+        _extendAlignmentXDropSimd<TSimdAlign>(scores, endPositions, positions, seqsH, seqsV, xDrop, scoreScheme,
+                                              AffineGaps());
+}
+#endif  // defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+
 // ----------------------------------------------------------------------------
 // Function extendAlignment()
 // ----------------------------------------------------------------------------
@@ -446,6 +594,9 @@ _extendAlignmentImpl(Align<TStringInfix, TAlignSpec> & align,
  * @brief X-Drop extension for alignment objects.
  * @signature TScoreValue extendAlignment(align, [origScore,] hSeq, vSeq, positions, extensionDirection,
  *                                        [lowerDiag, upperDiag,] [xDrop,] scoreScheme);
+ * @signature TScoreValue extendAlignment(align, [origScore,] hSeq, vSeq, positions, extensionDirection,
+ *                                        lowerDiag, upperDiag, zDrop, scoreScheme, algoTag);
+ * @signature String<TScoreValue> extendAlignment(endPositions, hSeqs, vSeqs, xDrop, scoreScheme);
  *
  * @param[in,out]  align     The @link Align @endlink object to work on.  Must be an alignment over the
  *                           @link InfixSegment infix @endlink of the <i>const</i> type of <tt>hSeq</tt>
@@ -461,8 +612,19 @@ _extendAlignmentImpl(Align<TStringInfix, TAlignSpec> & align,
  * @param[in]      upperDiag Upper alignment diagonal to use (<tt>int</tt>).
  * @param[in]      xDrop     The X-drop value to use (integral value). It only limits computation of new
  * columns in the DP-Matrix and has no influence on the diagonals (but can be combined with them).
+ * @param[in]      zDrop     The Z-drop value to use (integral value).  The extension stops as soon as the best score
+ *                           of an anti-diagonal falls more than zDrop below the best score so far, where the gap
+ *                           extensions between the diagonals of the two cells are not counted.
  * @param[in]      scoringScheme
  *                           The @link Score @endlink to use.
+ * @param[in]      algoTag   @link AlignmentAlgorithmTags#DifferenceRecurrence @endlink to run the banded extension on
+ *                           8 bit score differences with a Z-drop instead of the X-drop.  Falls back to the banded
+ *                           X-drop extension if the scoring scheme does not fit into 8 bit.
+ * @param[out]     endPositions
+ *                           A @link String @endlink of @link Pair @endlink objects that receives the end
+ *                           positions of the extensions in <tt>hSeqs</tt> and <tt>vSeqs</tt>.
+ * @param[in]      hSeqs     @link StringSet @endlink of horizontal sequences that start at the seed ends.
+ * @param[in]      vSeqs     @link StringSet @endlink of vertical sequences that start at the seed ends.
  *
  * @return          TScoreValue
  *                           The score of the new alignment.  <tt>TScoreValue</tt> is the value type of
@@ -481,6 +643,15 @@ _extendAlignmentImpl(Align<TStringInfix, TAlignSpec> & align,
  *
  * @include demos/dox/align_extend/extend_alignment.cpp.stdout
  *
+ * @section Batched Extension
+ *
+ * The overload on two @link StringSet StringSets @endlink extends many seeds at once with the X-drop criterion.
+ * The i-th pair holds the sequences following the i-th seed end, e.g. suffixes of the full sequences or, for
+ * extensions to the left, reversed prefixes.  If SIMD is available, the pairs are extended in parallel lanes and
+ * each lane stops on its own X-drop criterion.  The function returns the best score of each extension and stores
+ * its end position, i.e. the lengths of the extended parts of both sequences, in <tt>endPositions</tt>.  No
+ * alignments are computed.
+ *
  * @section Remarks
  *
  * It is necessary to explicitly pass hSeq, vSeq and the positions, because the
@@ -622,6 +793,44 @@ extendAlignment(Align<TStringInfix, TAlignSpec> & align,
                                 scoreScheme, True(), True());
 }
 
+// BAND, ZDROP
+template <typename TStringInfix, typename TAlignSpec, typename TString,
+          typename TPos, typename TScoreValue, typename TScoreSpec>
+inline TScoreValue
+extendAlignment(Align<TStringInfix, TAlignSpec> & align,
+                TString const & hSeq,
+                TString const & vSeq,
+                Tuple<TPos, 4> const & positions,
+                ExtensionDirection const & direction,
+                int const lowerDiag,
+                int const upperDiag,
+                TScoreValue const & zDrop,
+                Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                DifferenceRecurrence const & algorithmTag)
+{
+    return _extendAlignmentImpl(align, std::numeric_limits<TScoreValue>::min(), hSeq, vSeq, positions, direction, lowerDiag, upperDiag,
+                                zDrop, scoreScheme, True(), algorithmTag);
+}
+
+template <typename TStringInfix, typename TAlignSpec, typename TString,
+          typename TPos, typename TScoreValue, typename TScoreSpec>
+inline TScoreValue
+extendAlignment(Align<TStringInfix, TAlignSpec> & align,
+                TScoreValue const & origScore,
+                TString const & hSeq,
+                TString const & vSeq,
+                Tuple<TPos, 4> const & positions,
+                ExtensionDirection const & direction,
+                int const lowerDiag,
+                int const upperDiag,
+                TScoreValue const & zDrop,
+                Score<TScoreValue, TScoreSpec> const & scoreScheme,
+                DifferenceRecurrence const & algorithmTag)
+{
+    return _extendAlignmentImpl(align, origScore, hSeq, vSeq, positions, direction, lowerDiag, upperDiag, zDrop,
+                                scoreScheme, True(), algorithmTag);
+}
+
 template <typename TStringInfix, typename TAlignSpec, typename TString,
           typename TPos, typename TScoreValue, typename TScoreSpec,
           typename TAliExtContext>
@@ -642,6 +851,40 @@ extendAlignment(Align<TStringInfix, TAlignSpec> & align,
                                 scoreScheme, True(), True(), alignContext);
 }
 
+
+// BATCH, XDROP
+template <typename TPosition, typename TSequenceH, typename TSpecH, typename TSequenceV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec>
+inline String<TScoreValue>
+extendAlignment(String<Pair<TPosition> > & endPositions,
+                StringSet<TSequenceH, TSpecH> const & hSeqs,
+                StringSet<TSequenceV, TSpecV> const & vSeqs,
+                TScoreValue const & xDrop,
+                Score<TScoreValue, TScoreSpec> const & scoreScheme)
+{
+    SEQAN_ASSERT_EQ(length(hSeqs), length(vSeqs));
+
+    String<TScoreValue> scores;
+    resize(scores, length(hSeqs), 0, Exact());
+    clear(endPositions);
+    resize(endPositions, length(hSeqs), Pair<TPosition>(0, 0), Exact());
+
+    // Extensions of empty sequences end in the seed.
+    String<unsigned> positions;
+    for (unsigned i = 0; i < length(hSeqs); ++i)
+        if (!empty(hSeqs[i]) && !empty(vSeqs[i]))
+            appendValue(positions, i);
+    if (empty(positions))
+        return scores;
+
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+    _extendAlignmentXDropSimd(scores, endPositions, positions, hSeqs, vSeqs, xDrop, scoreScheme);
+#else
+    _extendAlignmentXDropSequential(scores, endPositions, positions, hSeqs, vSeqs, xDrop, scoreScheme);
+#endif
+    return scores;
+}
+
 }
 
 #endif  // INCLUDE_ALIGN_ALIGN_EXTEND_H
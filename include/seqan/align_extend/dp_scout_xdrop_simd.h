@@ -0,0 +1,186 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// This file contains the SIMD X-drop scout that extends many seeds at once.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_ALIGN_EXTEND_DP_SCOUT_XDROP_SIMD_H_
+#define INCLUDE_SEQAN_ALIGN_EXTEND_DP_SCOUT_XDROP_SIMD_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class SimdAlignXDropTraits_
+// ----------------------------------------------------------------------------
+
+// Traits of the variable length SIMD alignment that select the X-drop scout state below.
+template <typename TSimdVector_, typename TSeqH_, typename TSeqV_, typename TDPProfile_>
+struct SimdAlignXDropTraits_
+{
+    using TSimdVector   = TSimdVector_;
+    using TSeqH         = TSeqH_;
+    using TSeqV         = TSeqV_;
+    using TDPProfile    = TDPProfile_;
+};
+
+// ----------------------------------------------------------------------------
+// Class DPScoutState_
+// ----------------------------------------------------------------------------
+
+// Extends the state of the variable length SIMD alignment by the X-drop criterion of every lane.  A lane whose
+// extension stopped is marked in terminated and does not update its maximum anymore.  As the scout only lives
+// during the DP, the positions of the maxima are kept in the state.
+template <typename TSimdVector, typename TSeqH, typename TSeqV, typename TDPProfile>
+class DPScoutState_<SimdAlignVariableLength<SimdAlignXDropTraits_<TSimdVector, TSeqH, TSeqV, TDPProfile> > >
+{
+public:
+    using TIterator = typename Iterator<String<size_t>, Rooted>::Type;
+    using TValue    = typename Value<TSimdVector>::Type;
+
+    TSimdVector endPosVecH;
+    TSimdVector endPosVecV;
+
+    size_t posH = 0;
+    size_t posV = 0;
+
+    TIterator nextEndsH;
+    TIterator nextEndsV;
+
+    TSimdVector terminationThreshold;
+    TSimdVector columnMax;
+    TSimdVector terminated;
+    TSimdVector maxPosH;
+    TSimdVector maxPosV;
+
+    DPScoutState_() :
+        DPScoutState_(std::numeric_limits<TValue>::max())
+    {}
+
+    DPScoutState_(TValue const _terminationThreshold) :
+        terminationThreshold(createVector<TSimdVector>(_terminationThreshold)),
+        columnMax(createVector<TSimdVector>(std::numeric_limits<TValue>::min())),
+        terminated(createVector<TSimdVector>(0)),
+        maxPosH(createVector<TSimdVector>(0)),
+        maxPosV(createVector<TSimdVector>(0))
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// Resolves the ambiguity between the X-drop scout and the SIMD scout in favour of the latter.
+template <typename TScoreValue, typename TTraits>
+struct ScoutSpecForAlignmentAlgorithm_<AlignExtend_<XDrop_<TScoreValue> >,
+                                       DPScoutState_<SimdAlignVariableLength<TTraits> > >
+{
+    typedef SimdAlignmentScout<SimdAlignVariableLength<TTraits> > Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _scoutBestScore()                       [SimdAlignXDropTraits_]
+// ----------------------------------------------------------------------------
+
+// Only tracks cells of running lanes that lie within the lane's own matrix.  The X-drop criterion of a lane is
+// checked in the last cell of its column, i.e. in the lane's last row, which the variable length DP computes as
+// LastCell.  A lane also stops after its last column.
+template <typename TDPCell, typename TSimdVector, typename TSeqH, typename TSeqV, typename TDPProfile,
+          typename TTraceMatrixNavigator, typename TIsLastColumn, typename TIsLastRow>
+inline void
+_scoutBestScore(DPScout_<TDPCell, SimdAlignmentScout<SimdAlignVariableLength<
+                    SimdAlignXDropTraits_<TSimdVector, TSeqH, TSeqV, TDPProfile> > > > & dpScout,
+                TDPCell const & activeCell,
+                TTraceMatrixNavigator const & /*navigator*/,
+                TIsLastColumn const & /**/,
+                TIsLastRow const & /**/)
+{
+    using TValue = typename Value<TSimdVector>::Type;
+
+    auto & state = *dpScout.state;
+    TSimdVector const posH = createVector<TSimdVector>(state.posH);
+    TSimdVector const posV = createVector<TSimdVector>(state.posV);
+
+    auto inside = cmpEq(state.terminated, createVector<TSimdVector>(0)) &
+                  (posH <= state.endPosVecH) & (posV <= state.endPosVecV);
+
+    // global maximum
+    auto cmp = cmpGt(_scoreOfCell(activeCell), _scoreOfCell(dpScout._maxScore)) & inside;
+    dpScout._maxScore._score = blend(dpScout._maxScore._score, _scoreOfCell(activeCell), cmp);
+    state.maxPosH = blend(state.maxPosH, posH, cmp);
+    state.maxPosV = blend(state.maxPosV, posV, cmp);
+
+    // column maximum
+    state.columnMax = blend(state.columnMax, max(state.columnMax, _scoreOfCell(activeCell)), inside);
+
+    if (!TIsLastRow::VALUE)
+        return;
+
+    // check termination condition, i.e. maximum - columnMax >= terminationThreshold
+    auto lastRow = inside & cmpEq(posV, state.endPosVecV);
+    auto stop = cmpGt(_scoreOfCell(dpScout._maxScore) - state.columnMax,
+                      state.terminationThreshold - createVector<TSimdVector>(1)) |
+                cmpEq(posH, state.endPosVecH);
+    state.terminated = blend(state.terminated, createVector<TSimdVector>(1), lastRow & stop);
+    // reset columMax at end of column
+    state.columnMax = blend(state.columnMax, createVector<TSimdVector>(std::numeric_limits<TValue>::min()), lastRow);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeAlignmentHelperCheckTerminate()
+// ----------------------------------------------------------------------------
+
+// The DP stops as soon as the extensions of all lanes stopped.
+template <typename TDPCell, typename TSimdVector, typename TSeqH, typename TSeqV, typename TDPProfile>
+inline bool
+_computeAlignmentHelperCheckTerminate(DPScout_<TDPCell, SimdAlignmentScout<SimdAlignVariableLength<
+                                          SimdAlignXDropTraits_<TSimdVector, TSeqH, TSeqV, TDPProfile> > > > const & s)
+{
+    for (unsigned lane = 0; lane < LENGTH<TSimdVector>::VALUE; ++lane)
+        if (s.state->terminated[lane] == 0)
+            return false;
+    return true;
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_ALIGN_EXTEND_DP_SCOUT_XDROP_SIMD_H_
@@ -47,6 +47,8 @@ namespace seqan2
 // ============================================================================
 
 // Scheduler for wavefront tasks.
+// The tasks are executed by a WorkStealingScheduler.  Tasks scheduled from within a running task are pushed to the
+// deque of the executing worker, such that dependent wavefront tasks are likely executed by the same thread.
 class WavefrontTaskScheduler
 {
 public:
@@ -55,64 +57,33 @@ public:
     // Memeber Types
 
     using TWrapper = std::function<void()>;
-    using TTaskQueue = ConcurrentQueue<TWrapper>;
 
     //-------------------------------------------------------------------------
     // Member Variables
 
-    ThreadPool  _threadPool;
-    TTaskQueue  _taskQueue;
+    WorkStealingScheduler   _scheduler;
+    TaskGroup               _group;
 
-    unsigned    _writerCount;
+    unsigned                _writerCount;
+    std::atomic<unsigned>   _activeWriterCount{0};
+
+    // Tasks scheduled before all writers are set up are executed once waitForWriters() was called.
+    std::mutex              _mutexPending;
+    std::vector<TWrapper>   _pendingTasks;
+    std::atomic<bool>       _isRunning{false};
 
     std::mutex                      _mutexPushException;
     std::vector<std::exception_ptr> _exceptionPointers;
     std::atomic<bool>               _isValid{true};
 
-    std::function<void()> job = [this] ()
-    {
-        lockReading(_taskQueue);
-        waitForFirstValue(_taskQueue);  // Wait for all writers to be setup.
-
-        std::function<void()> _dummy = [] ()
-        {  // TODO(rrahn): Could throw exception to signal something went terribly wrong.
-            SEQAN_ASSERT_FAIL("Trying to exceute empty wavefront task in a thread");
-        };
-        TWrapper task{_dummy};
-
-        while (true)
-        {
-            if (!popFront(task, _taskQueue))
-                break;  // Empty queue and no writer registered.
-
-            try
-            {
-                task();  // Execute the task;
-            }
-            catch (...)
-            {  // Catch exception, and signal failure. Continue running until queue is empty.
-                {
-                    std::lock_guard<std::mutex> lck(_mutexPushException);
-                    _exceptionPointers.push_back(std::current_exception());
-                }
-                _isValid.store(false, std::memory_order_release);
-            }
-        }
-        unlockReading(_taskQueue);
-    };
-
     //-------------------------------------------------------------------------
     // Constructor
 
     WavefrontTaskScheduler(size_t const threadCount, size_t const writerCount) :
+        _scheduler(threadCount),
         _writerCount(writerCount)
     {
-
-        for (unsigned i = 0; i < threadCount; ++i)
-        {
-            spawn(_threadPool, job);
-        }
-        setCpuAffinity(_threadPool, 0, 1);
+        setCpuAffinity(_scheduler._threadPool, 0, 1);
     }
 
     WavefrontTaskScheduler(size_t const threadCount) : WavefrontTaskScheduler(threadCount, 0)
@@ -130,11 +101,9 @@ public:
     //-------------------------------------------------------------------------
     // Destructor
 
-    ~WavefrontTaskScheduler()
-    {}
-    // In destructor of thread pool we wait for the outstanding alignments to be finished
-    // and then continue destruction of the remaining members and cleaning up the stack.
-    // Note the number of writers must be set to 0, for the queue to stop spinning.
+    ~WavefrontTaskScheduler();
+    // Executes the outstanding tasks and waits until they are finished.
+    // Note the number of writers must be set to 0, for the scheduler to stop.
 };
 
 // ============================================================================
@@ -155,6 +124,50 @@ struct SchedulerTraits<WavefrontTaskScheduler>
 // Functions
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Function _spawnWavefrontTask()
+// ----------------------------------------------------------------------------
+
+inline void
+_spawnWavefrontTask(WavefrontTaskScheduler & me, typename WavefrontTaskScheduler::TWrapper task)
+{
+    spawn(me._scheduler, me._group, [&me, task = std::move(task)] ()
+    {
+        try
+        {
+            task();  // Execute the task;
+        }
+        catch (...)
+        {  // Catch exception, and signal failure. Continue running until all tasks are finished.
+            {
+                std::lock_guard<std::mutex> lck(me._mutexPushException);
+                me._exceptionPointers.push_back(std::current_exception());
+            }
+            me._isValid.store(false, std::memory_order_release);
+        }
+    });
+}
+
+// ----------------------------------------------------------------------------
+// Function _startExecution()
+// ----------------------------------------------------------------------------
+
+inline void
+_startExecution(WavefrontTaskScheduler & me)
+{
+    std::vector<typename WavefrontTaskScheduler::TWrapper> pending;
+    {
+        std::lock_guard<std::mutex> lck(me._mutexPending);
+        if (me._isRunning.load(std::memory_order_relaxed))
+            return;
+        me._isRunning.store(true, std::memory_order_release);
+        std::swap(pending, me._pendingTasks);
+    }
+
+    for (auto & task : pending)
+        _spawnWavefrontTask(me, std::move(task));
+}
+
 inline void
 setWriterCount(WavefrontTaskScheduler & me, size_t const count) noexcept
 {
@@ -164,19 +177,24 @@ setWriterCount(WavefrontTaskScheduler & me, size_t const count) noexcept
 inline void
 lockWriting(WavefrontTaskScheduler & me) noexcept
 {
-    lockWriting(me._taskQueue);
+    me._activeWriterCount.fetch_add(1, std::memory_order_acq_rel);
 }
 
 inline void
 unlockWriting(WavefrontTaskScheduler & me) noexcept
 {
-    unlockWriting(me._taskQueue);
+    me._activeWriterCount.fetch_sub(1, std::memory_order_acq_rel);
 }
 
 inline void
 waitForWriters(WavefrontTaskScheduler & me) noexcept
 {
-    waitForWriters(me._taskQueue, me._writerCount);
+    SpinDelay spinDelay;
+    while (me._activeWriterCount.load(std::memory_order_acquire) < me._writerCount)
+    {
+        waitFor(spinDelay);
+    }
+    _startExecution(me);
 }
 
 inline bool
@@ -193,18 +211,28 @@ scheduleTask(WavefrontTaskScheduler & me,
     {  // TODO(rrahn): Improve error handling.
         throw std::runtime_error("Invalid Task Scheduler");
     }
-    appendValue(me._taskQueue, std::move(task));
+
+    if (!me._isRunning.load(std::memory_order_acquire))
+    {
+        std::unique_lock<std::mutex> lck(me._mutexPending);
+        if (!me._isRunning.load(std::memory_order_relaxed))
+        {
+            me._pendingTasks.push_back(std::move(task));
+            return;
+        }
+    }
+    _spawnWavefrontTask(me, std::move(task));
 }
 
 inline void
 wait(WavefrontTaskScheduler & me)
 {
-    SEQAN_ASSERT(me._taskQueue.writerCount == 0);
+    SEQAN_ASSERT(me._activeWriterCount.load() == 0);
 
-    join(me._threadPool);
+    _startExecution(me);
+    wait(me._scheduler, me._group);
 
-    SEQAN_ASSERT(empty(me._taskQueue));
-    SEQAN_ASSERT(me._taskQueue.readerCount == 0);
+    SEQAN_ASSERT(me._pendingTasks.empty());
 }
 
 inline auto
@@ -214,6 +242,13 @@ getExceptions(WavefrontTaskScheduler & me)
     return me._exceptionPointers;
 }
 
+inline
+WavefrontTaskScheduler::~WavefrontTaskScheduler()
+{
+    _startExecution(*this);
+    wait(_scheduler, _group);
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef INCLUDE_SEQAN_ALIGN_PARALLEL_WAVEFRONT_TASK_SCHEDULER_H_
@@ -531,6 +531,239 @@ auto _splitAlignmentImpl(Gaps<TContigSeqL> & gapsContigL,
                                    scoringScheme, config, lowerDiagonal, upperDiagonal, LinearGaps());
 }
 
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentBestSplit()
+// ----------------------------------------------------------------------------
+
+// Returns the leftmost position in the contig with the best sum of the left and the reversed right split scores.
+template <typename TSplitScoresL, typename TSplitScoresR, typename TGetScore>
+inline size_t
+_splitAlignmentBestSplit(TSplitScoresL const & splitScoreL,
+                         TSplitScoresR const & splitScoreR,
+                         size_t const contigLength,
+                         TGetScore && getScore)
+{
+    size_t bestPrefixLength = 0;
+    for (size_t i = 1; i <= contigLength; ++i)
+        if (getScore(splitScoreL[i]) + getScore(splitScoreR[contigLength - i]) >
+            getScore(splitScoreL[bestPrefixLength]) + getScore(splitScoreR[contigLength - bestPrefixLength]))
+            bestPrefixLength = i;
+    return bestPrefixLength;
+}
+
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentSequential()
+// ----------------------------------------------------------------------------
+
+// Computes the split positions and scores of the pairs one after another.  The rows of the split positions are
+// taken from the positions in the column-wise trace matrix.
+template <typename TPosition, typename TScoreValue, typename TContigsL, typename TReadsL, typename TContigsR,
+          typename TReadsR, typename TScoreSpec, typename TAlignConfig, typename TGapModel>
+inline void
+_splitAlignmentSequential(String<TScoreValue> & scores,
+                          String<Triple<TPosition, TPosition, TPosition> > & splitPositions,
+                          TContigsL const & contigsL,
+                          TReadsL const & readsL,
+                          TContigsR const & contigsR,
+                          TReadsR const & readsR,
+                          Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                          TAlignConfig const & alignConfig,
+                          TGapModel const & /*gapModel*/)
+{
+    typedef typename Value<TContigsR const>::Type                       TContigR;
+    typedef typename Value<TReadsR const>::Type                         TReadR;
+    typedef TraceSegment_<size_t, size_t>                               TTraceSegment;
+
+    typedef DPContext<DPCell_<TScoreValue, TGapModel>, typename TraceBitMap_<TScoreValue>::Type> TDPContext;
+
+    String<TTraceSegment> trace;
+    for (unsigned i = 0; i < length(contigsL); ++i)
+    {
+        SEQAN_ASSERT_EQ(length(contigsL[i]), length(contigsR[i]));
+        size_t const contigLength = length(contigsL[i]);
+
+        TDPContext dpContextL;
+        DPScoutState_<SplitAlignmentScout> scoutStateL;
+        resize(scoutStateL.splitScore, contigLength + 1, std::numeric_limits<TScoreValue>::min() / 2);
+        resize(scoutStateL.splitPos, length(scoutStateL.splitScore));
+        _setUpAndRunAlignment(dpContextL, trace, scoutStateL, contigsL[i], readsL[i], scoringScheme, alignConfig);
+
+        ModifiedString<TContigR const, ModReverse> revContig(contigsR[i]);
+        ModifiedString<TReadR const, ModReverse> revReadR(readsR[i]);
+
+        TDPContext dpContextR;
+        DPScoutState_<SplitAlignmentScout> scoutStateR;
+        resize(scoutStateR.splitScore, contigLength + 1, std::numeric_limits<TScoreValue>::min() / 2);
+        resize(scoutStateR.splitPos, length(scoutStateR.splitScore));
+        _setUpAndRunAlignment(dpContextR, trace, scoutStateR, revContig, revReadR, scoringScheme, alignConfig);
+
+        size_t const best = _splitAlignmentBestSplit(scoutStateL.splitScore, scoutStateR.splitScore, contigLength,
+                                                     [] (TScoreValue const score) { return score; });
+        scores[i] = scoutStateL.splitScore[best] + scoutStateR.splitScore[contigLength - best];
+        splitPositions[i].i1 = best;
+        splitPositions[i].i2 = scoutStateL.splitPos[best] % (length(readsL[i]) + 1);
+        splitPositions[i].i3 = length(readsR[i]) -
+                               scoutStateR.splitPos[contigLength - best] % (length(readsR[i]) + 1);
+    }
+}
+
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentSimdScores()
+// ----------------------------------------------------------------------------
+
+// Runs one pass of a batch and returns the best score of each column and its row for all lanes.
+template <typename TSimdAlign, typename TSetH, typename TSetV, typename TSimdScore, typename TDPProfile>
+inline void
+_splitAlignmentSimdScores(String<TSimdAlign, Alloc<OverAligned> > & splitScore,
+                          String<TSimdAlign, Alloc<OverAligned> > & splitRow,
+                          TSetH const & setH,
+                          TSetV const & setV,
+                          TSimdScore const & simdScoringScheme,
+                          TDPProfile const & /*dpProfile*/)
+{
+    typedef typename Value<TSimdAlign>::Type                                        TValue;
+    typedef typename GapTraits<TDPProfile>::Type                                    TGapModel;
+    typedef DPCell_<TSimdAlign, TGapModel>                                          TDPCell;
+    typedef typename TraceBitMap_<TSimdAlign>::Type                                 TTraceValue;
+    typedef DPContext<TDPCell, TTraceValue, String<TDPCell, Alloc<OverAligned> >,
+                      String<TTraceValue, Alloc<OverAligned> > >                    TDPContext;
+
+    DPScoutState_<SimdAlignVariableLength<SimdAlignSplitTraits_<TSimdAlign, TSetH, TSetV, TDPProfile> > > state;
+    String<TSimdAlign, Alloc<OverAligned> > stringSimdH;
+    String<TSimdAlign, Alloc<OverAligned> > stringSimdV;
+    String<size_t> lengthsH;
+    String<size_t> lengthsV;
+    _prepareSimdAlignment(stringSimdH, stringSimdV, setH, setV, lengthsH, lengthsV, state);
+
+    resize(state.splitScore, length(stringSimdH) + 1,
+           createVector<TSimdAlign>(std::numeric_limits<TValue>::min() / 2), Exact());
+    resize(state.splitRow, length(stringSimdH) + 1, createVector<TSimdAlign>(0), Exact());
+
+    TDPContext dpContext;
+    String<Nothing> traceSegments;  // We need to declare it, but it will not be used.
+    _computeAlignment(dpContext, traceSegments, state, stringSimdH, stringSimdV, simdScoringScheme,
+                      DPBandConfig<BandOff>(), TDPProfile());
+
+    swap(splitScore, state.splitScore);
+    swap(splitRow, state.splitRow);
+}
+
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentSimd()
+// ----------------------------------------------------------------------------
+
+// Computes the split positions and scores in batches of TSimdAlign lanes.  The forward pass aligns the left contigs
+// with the left reads, the reverse pass the reversed right contigs with the reversed right reads.
+template <typename TSimdAlign, typename TPosition, typename TScoreValue, typename TContigsL, typename TReadsL,
+          typename TContigsR, typename TReadsR, typename TScoreSpec, typename TFreeEndGaps, typename TGapModel>
+inline void
+_splitAlignmentSimd(String<TScoreValue> & scores,
+                    String<Triple<TPosition, TPosition, TPosition> > & splitPositions,
+                    String<unsigned> const & positions,
+                    TContigsL const & contigsL,
+                    TReadsL const & readsL,
+                    TContigsR const & contigsR,
+                    TReadsR const & readsR,
+                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                    TFreeEndGaps const & /*freeEndGaps*/,
+                    TGapModel const & /*gapModel*/)
+{
+    typedef StringSet<std::remove_const_t<typename Value<TContigsL>::Type>, Dependent<> >   TDepSetContig;
+    typedef StringSet<std::remove_const_t<typename Value<TReadsL>::Type>, Dependent<> >     TDepSetReadL;
+    typedef StringSet<String<typename Value<typename Value<TContigsR>::Type>::Type> >       TRevSetContig;
+    typedef StringSet<String<typename Value<typename Value<TReadsR>::Type>::Type> >         TRevSetReadR;
+    typedef DPProfile_<SplitAlignment_<TFreeEndGaps>, TGapModel, TracebackOff>              TDPProfile;
+
+    unsigned const numAlignments = length(positions);
+    unsigned const sizeBatch = LENGTH<TSimdAlign>::VALUE;
+    unsigned const fullSize = sizeBatch * ((numAlignments + sizeBatch - 1) / sizeBatch);
+
+    // Create a SIMD scoring scheme.
+    Score<TSimdAlign, ScoreSimdWrapper<Score<TScoreValue, TScoreSpec> > > simdScoringScheme(scoringScheme);
+
+    String<TSimdAlign, Alloc<OverAligned> > splitScoreL;
+    String<TSimdAlign, Alloc<OverAligned> > splitRowL;
+    String<TSimdAlign, Alloc<OverAligned> > splitScoreR;
+    String<TSimdAlign, Alloc<OverAligned> > splitRowR;
+
+    for (auto pos = 0u; pos < fullSize; pos += sizeBatch)
+    {
+        // Fill the last batch with the last pair.
+        TDepSetContig depSetContig;
+        TDepSetReadL depSetReadL;
+        TRevSetContig revSetContig;
+        TRevSetReadR revSetReadR;
+        resize(revSetContig, sizeBatch);
+        resize(revSetReadR, sizeBatch);
+        for (unsigned i = pos; i < pos + sizeBatch; ++i)
+        {
+            auto const id = positions[std::min(i, numAlignments - 1)];
+            appendValue(depSetContig, contigsL[id]);
+            appendValue(depSetReadL, readsL[id]);
+            assign(revSetContig[i - pos], contigsR[id]);
+            reverse(revSetContig[i - pos]);
+            assign(revSetReadR[i - pos], readsR[id]);
+            reverse(revSetReadR[i - pos]);
+        }
+
+        _splitAlignmentSimdScores(splitScoreL, splitRowL, depSetContig, depSetReadL, simdScoringScheme,
+                                  TDPProfile());
+        _splitAlignmentSimdScores(splitScoreR, splitRowR, revSetContig, revSetReadR, simdScoringScheme,
+                                  TDPProfile());
+
+        for (auto x = pos; x < pos + sizeBatch && x < numAlignments; ++x)
+        {
+            unsigned const id = positions[x];
+            unsigned const lane = x - pos;
+            size_t const contigLength = length(contigsL[id]);
+
+            size_t const best = _splitAlignmentBestSplit(splitScoreL, splitScoreR, contigLength,
+                                                         [lane] (TSimdAlign const & score) { return score[lane]; });
+            scores[id] = splitScoreL[best][lane] + splitScoreR[contigLength - best][lane];
+            splitPositions[id].i1 = best;
+            splitPositions[id].i2 = splitRowL[best][lane];
+            splitPositions[id].i3 = length(readsR[id]) - splitRowR[contigLength - best][lane];
+        }
+    }
+}
+#endif  // defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentBatch()
+// ----------------------------------------------------------------------------
+
+template <typename TPosition, typename TScoreValue, typename TContigsL, typename TReadsL, typename TContigsR,
+          typename TReadsR, typename TScoreSpec, typename TFreeEndGaps, typename TGapModel>
+inline void
+_splitAlignmentBatch(String<TScoreValue> & scores,
+                     String<Triple<TPosition, TPosition, TPosition> > & splitPositions,
+                     TContigsL const & contigsL,
+                     TReadsL const & readsL,
+                     TContigsR const & contigsR,
+                     TReadsR const & readsR,
+                     Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                     TFreeEndGaps const & /*freeEndGaps*/,
+                     TGapModel const & /*gapModel*/)
+{
+#if defined(SEQAN_SIMD_ENABLED) && !defined(SEQAN_UMESIMD_ENABLED)
+    String<unsigned> positions;
+    resize(positions, length(contigsL), Exact());
+    std::iota(begin(positions, Standard()), end(positions, Standard()), 0u);
+    // Batches of pairs with similar lengths waste less lanes.
+    _sortSimdBatchPositions(positions, contigsL, readsL);
+
+    _splitAlignmentSimd<typename SimdVector<TScoreValue>::Type>(scores, splitPositions, positions, contigsL, readsL,
+                                                                contigsR, readsR, scoringScheme, TFreeEndGaps(),
+                                                                TGapModel());
+#else
+    typedef AlignConfig2<SplitAlignmentAlgo, DPBandConfig<BandOff>, TFreeEndGaps,
+                         TracebackOn<TracebackConfig_<CompleteTrace, GapsLeft> > > TAlignConfig;
+    _splitAlignmentSequential(scores, splitPositions, contigsL, readsL, contigsR, readsR, scoringScheme,
+                              TAlignConfig(), TGapModel());
+#endif
+}
+
 // ----------------------------------------------------------------------------
 // Function splitAlignment()
 // ----------------------------------------------------------------------------
@@ -542,6 +775,7 @@ auto _splitAlignmentImpl(Gaps<TContigSeqL> & gapsContigL,
  *
  * @signature TScoreValue splitAlignment(alignL,         alignR,         scoringScheme[, config][, lowerDiag, upperDiag]);
  * @signature TScoreValue splitAlignment(gapsHL, gapsVL, gapsHR, gapsVR, scoringScheme[, config][, lowerDiag, upperDiag]);
+ * @signature String<TScoreValue> splitAlignment(splitPositions, contigsL, readsL, contigsR, readsR, scoringScheme[, config]);
  *
  * @param[in,out] alignL @link Align @endlink object with two rows for the left alignment.
  * @param[in,out] alignR @link Align @endlink object with two rows for the right alignment.
@@ -555,6 +789,14 @@ auto _splitAlignmentImpl(Gaps<TContigSeqL> & gapsContigL,
  *                          alignment.  For the right alignment, the corresponding diagonals are chosen for the
  *                          lower right part of the DP matrix, <tt>int</tt>.
  * @param[in]     upperDiag The lower diagonal.  Also see remark for <tt>lowerDiag</tt>, <tt>int</tt>.
+ * @param[out]    splitPositions A @link String @endlink of @link Triple @endlink objects that receives for each
+ *                          pair the split position in the contig, the end of the left alignment in the left read and
+ *                          the begin of the right alignment in the right read.
+ * @param[in]     contigsL  @link StringSet @endlink of the contigs of the left alignments.
+ * @param[in]     readsL    @link StringSet @endlink of the reads of the left alignments.
+ * @param[in]     contigsR  @link StringSet @endlink of the contigs of the right alignments.  Each must have the same
+ *                          length as the corresponding left contig.
+ * @param[in]     readsR    @link StringSet @endlink of the reads of the right alignments.
  *
  * @return TScoreValue The sum of the alignment scores of both alignments (Metafunction: @link Score#Value @endlink
  *                     of the type of <tt>scoringScheme</tt>).
@@ -616,6 +858,10 @@ auto _splitAlignmentImpl(Gaps<TContigSeqL> & gapsContigL,
  *
  * The DP algorithm is chosen automatically depending on whether the gap open and extension costs are equal.
  *
+ * The overload on @link StringSet StringSets @endlink computes only the split positions and the summed scores of many
+ * unbanded split alignments, e.g. for the candidate breakpoints of a sample.  If SIMD is available, the forward and
+ * the reverse passes of the pairs are computed in parallel lanes.  All sequences must not be empty.
+ *
  * @section Example
  *
  * The following example demonstrates the usage of <tt>splitAlignment</tt> in the first case.  The second case
@@ -753,6 +999,56 @@ int splitAlignment(Gaps<TSeqHL, TGapSpecHL> & gapsHL,
                           lowerDiagonal, upperDiagonal);
 }
 
+// Variant: unbanded, batch of StringSets.
+template <typename TPosition,
+          typename TContigL, typename TContigSpecL, typename TReadL, typename TReadSpecL,
+          typename TContigR, typename TContigSpecR, typename TReadR, typename TReadSpecR,
+          typename TScoreVal, typename TScoreSpec,
+          bool TTop, bool TRight, bool TLeft, bool TBottom, typename TConfigSpec>
+String<TScoreVal> splitAlignment(String<Triple<TPosition, TPosition, TPosition> > & splitPositions,
+                                 StringSet<TContigL, TContigSpecL> const & contigsL,
+                                 StringSet<TReadL, TReadSpecL> const & readsL,
+                                 StringSet<TContigR, TContigSpecR> const & contigsR,
+                                 StringSet<TReadR, TReadSpecR> const & readsR,
+                                 Score<TScoreVal, TScoreSpec> const & scoringScheme,
+                                 AlignConfig<TTop, TRight, TLeft, TBottom, TConfigSpec> const & /*config*/)
+{
+    typedef typename SubstituteAlignConfig_<AlignConfig<TTop, TRight, TLeft, TBottom> >::Type TFreeEndGaps;
+
+    SEQAN_ASSERT_EQ(length(contigsL), length(readsL));
+    SEQAN_ASSERT_EQ(length(contigsL), length(contigsR));
+    SEQAN_ASSERT_EQ(length(contigsL), length(readsR));
+
+    String<TScoreVal> scores;
+    resize(scores, length(contigsL), Exact());
+    resize(splitPositions, length(contigsL), Exact());
+    if (empty(contigsL))
+        return scores;
+
+    if (_usesAffineGaps(scoringScheme, contigsL[0], readsL[0]))
+        _splitAlignmentBatch(scores, splitPositions, contigsL, readsL, contigsR, readsR, scoringScheme,
+                             TFreeEndGaps(), AffineGaps());
+    else
+        _splitAlignmentBatch(scores, splitPositions, contigsL, readsL, contigsR, readsR, scoringScheme,
+                             TFreeEndGaps(), LinearGaps());
+    return scores;
+}
+
+template <typename TPosition,
+          typename TContigL, typename TContigSpecL, typename TReadL, typename TReadSpecL,
+          typename TContigR, typename TContigSpecR, typename TReadR, typename TReadSpecR,
+          typename TScoreVal, typename TScoreSpec>
+String<TScoreVal> splitAlignment(String<Triple<TPosition, TPosition, TPosition> > & splitPositions,
+                                 StringSet<TContigL, TContigSpecL> const & contigsL,
+                                 StringSet<TReadL, TReadSpecL> const & readsL,
+                                 StringSet<TContigR, TContigSpecR> const & contigsR,
+                                 StringSet<TReadR, TReadSpecR> const & readsR,
+                                 Score<TScoreVal, TScoreSpec> const & scoringScheme)
+{
+    return splitAlignment(splitPositions, contigsL, readsL, contigsR, readsR, scoringScheme,
+                          AlignConfig<false, false, true, true>());
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_SPLIT_ALIGN_SPLIT_INTERFACE_H_
@@ -89,6 +89,48 @@ public:
     {}
 };
 
+#ifdef SEQAN_SIMD_ENABLED
+// ----------------------------------------------------------------------------
+// Class SimdAlignSplitTraits_
+// ----------------------------------------------------------------------------
+
+// Traits of the variable length SIMD alignment that select the split scout state below.
+template <typename TSimdVector_, typename TSeqH_, typename TSeqV_, typename TDPProfile_>
+struct SimdAlignSplitTraits_
+{
+    using TSimdVector   = TSimdVector_;
+    using TSeqH         = TSeqH_;
+    using TSeqV         = TSeqV_;
+    using TDPProfile    = TDPProfile_;
+};
+
+// ----------------------------------------------------------------------------
+// Class DPScoutState_
+// ----------------------------------------------------------------------------
+
+// Extends the state of the variable length SIMD alignment by the best score of each column and the row it was
+// found in, for every lane.
+template <typename TSimdVector, typename TSeqH, typename TSeqV, typename TDPProfile>
+class DPScoutState_<SimdAlignVariableLength<SimdAlignSplitTraits_<TSimdVector, TSeqH, TSeqV, TDPProfile> > >
+{
+public:
+    using TIterator = typename Iterator<String<size_t>, Rooted>::Type;
+
+    TSimdVector endPosVecH;
+    TSimdVector endPosVecV;
+
+    size_t posH = 0;
+    size_t posV = 0;
+
+    TIterator nextEndsH;
+    TIterator nextEndsV;
+
+    // The best score for each column.  Initialized with 0.5*minValue<TScoreVal>().
+    String<TSimdVector, Alloc<OverAligned> > splitScore;
+    String<TSimdVector, Alloc<OverAligned> > splitRow;
+};
+#endif  // SEQAN_SIMD_ENABLED
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -132,6 +174,32 @@ _scoutBestScore(DPScout_<TDPCell, SplitAlignmentScout> & dpScout,
     }
 }
 
+#ifdef SEQAN_SIMD_ENABLED
+// ----------------------------------------------------------------------------
+// Function _scoutBestScore()                       [SimdAlignSplitTraits_]
+// ----------------------------------------------------------------------------
+
+// Only cells within the lane's own read are tracked.  The padded columns behind the contig of a lane are never read.
+template <typename TDPCell, typename TSimdVector, typename TSeqH, typename TSeqV, typename TDPProfile,
+          typename TTraceMatrixNavigator, typename TIsLastColumn, typename TIsLastRow>
+inline void
+_scoutBestScore(DPScout_<TDPCell, SimdAlignmentScout<SimdAlignVariableLength<
+                    SimdAlignSplitTraits_<TSimdVector, TSeqH, TSeqV, TDPProfile> > > > & dpScout,
+                TDPCell const & activeCell,
+                TTraceMatrixNavigator const & /*navigator*/,
+                TIsLastColumn const & /*isLastColumn*/,
+                TIsLastRow const & /*isLastRow*/)
+{
+    auto & state = *dpScout.state;
+    TSimdVector const posV = createVector<TSimdVector>(state.posV);
+
+    TSimdVector & score = state.splitScore[state.posH];
+    auto cmp = cmpGt(_scoreOfCell(activeCell), score) & (posV <= state.endPosVecV);
+    score = blend(score, _scoreOfCell(activeCell), cmp);
+    state.splitRow[state.posH] = blend(state.splitRow[state.posH], posV, cmp);
+}
+#endif  // SEQAN_SIMD_ENABLED
+
 }  // namespace seqan2
 
 #endif  // #ifndef SEQAN_INCLUDE_SEQAN_ALIGN_SPLIT_DP_SCOUT_SPLIT_H_
@@ -47,6 +47,7 @@
 #include <seqan/file.h>
 #include <seqan/sequence.h>
 #include <seqan/stream.h>
+#include <seqan/parallel.h>
 #include <seqan/align.h>
 #include <seqan/misc/name_store_cache.h>
 
@@ -92,6 +93,7 @@
 // BAM indices are only available when ZLIB is available.
 #if SEQAN_HAS_ZLIB
 #include <seqan/bam_io/bam_index_bai.h>
+#include <seqan/bam_io/bam_index_csi.h>
 #endif  // #if SEQAN_HAS_ZLIB
 
 #endif  // INCLUDE_SEQAN_BAM_IO_H_
@@ -188,21 +188,13 @@ public:
 
 //! See SAM specifications https://samtools.github.io/hts-specs/SAMv1.pdf page 16.
 //! This function expects 0-based coordinates and includes the positions beg and end.
-static inline void
-_baiReg2bins(std::vector<uint16_t> & list, uint32_t const beg, uint32_t const end)
+inline void
+_bamIndexReg2bins(std::vector<uint32_t> & list, BamIndex<Bai> const &, uint32_t const beg, uint32_t const end)
 {
     SEQAN_ASSERT_LEQ(beg, end);
     SEQAN_ASSERT_LT(end, 536870912u); // BAM format only allows reference of size < 2^29
 
-    list.clear();
-
-    unsigned k;
-    list.push_back(0);
-    for (k =    1 + (beg>>26); k <=    1 + (end>>26); ++k) list.push_back(k);
-    for (k =    9 + (beg>>23); k <=    9 + (end>>23); ++k) list.push_back(k);
-    for (k =   73 + (beg>>20); k <=   73 + (end>>20); ++k) list.push_back(k);
-    for (k =  585 + (beg>>17); k <=  585 + (end>>17); ++k) list.push_back(k);
-    for (k = 4681 + (beg>>14); k <= 4681 + (end>>14); ++k) list.push_back(k);
+    _binningReg2bins(list, beg, static_cast<int64_t>(end) + 1, BamIndex<Bai>::BAM_LIDX_SHIFT, 5);
 }
 
 inline bool
@@ -221,18 +213,18 @@ _getMinFileOffset(uint64_t & minFileOffset,
     return true;
 }
 
-template <typename TContainer, typename TSpec>
+template <typename TContainer, typename TSpec, typename TIndexSpec>
 inline
 SEQAN_FUNC_ENABLE_IF(And<IsSameType<typename Value<TContainer>::Type, BamAlignmentRecord>,
                      Not<IsSameType<typename Value<TContainer>::Type, TContainer>>>, void)
 viewRecords(TContainer & resultContainer,
             FormattedFile<Bam, Input, TSpec> & bamFile,
-            BamIndex<Bai> const & bamIndex,
+            BamIndex<TIndexSpec> const & bamIndex,
             int32_t const refId,
             uint32_t regionStart,
             uint32_t regionEnd)
 {
-    typedef typename std::map<uint32_t, BaiBamIndexBinData_>::const_iterator TMapIter;
+    typedef typename BamIndex<TIndexSpec>::TBinIndex_::const_iterator        TMapIter;
     typedef String<Pair<uint64_t, uint64_t>>                                 TChunk;
     typedef Iterator<TChunk const, Rooted>::Type                             TChunkIter;
 
@@ -269,8 +261,8 @@ viewRecords(TContainer & resultContainer,
 
     // Retrieve the candidate bin identifiers for [regionStart, regionEnd).
     // -------------------------------------------------------------------------
-    std::vector<uint16_t> candidateBins;
-    _baiReg2bins(candidateBins, regionStart, regionEnd); // 0-based, closed interval
+    std::vector<uint32_t> candidateBins;
+    _bamIndexReg2bins(candidateBins, bamIndex, regionStart, regionEnd); // 0-based, closed interval
 
     // Retrieve the smallest required offset from the linear index.
     // -------------------------------------------------------------------------
@@ -281,7 +273,7 @@ viewRecords(TContainer & resultContainer,
     // Iterate over chunks in candidate bins and extract records
     // -------------------------------------------------------------------------
     BamAlignmentRecord record;
-    for (uint16_t bin : candidateBins)
+    for (uint32_t bin : candidateBins)
     {
         TMapIter mIt = bamIndex._binIndices[refId].find(bin);
 
@@ -350,14 +342,14 @@ viewRecords(TContainer & resultContainer,
  * This function fails if <tt>refID</tt>/<tt>regionStart</tt> are invalid.
  */
 
-template <typename TSpec>
+template <typename TSpec, typename TIndexSpec>
 inline bool
 jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
              bool & hasAlignments,
              int32_t const refId,
              uint32_t regionStart,
              uint32_t regionEnd,
-             BamIndex<Bai> const & index)
+             BamIndex<TIndexSpec> const & index)
 {
     hasAlignments = false;
 
@@ -411,7 +403,8 @@ jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
 
         readRecord(record, bamFile);
 
-        if (record.beginPos == -1 /*invalid pos*/ || static_cast<uint32_t>(record.beginPos) > regionEnd)
+        if (record.rID != refId || record.beginPos == -1 /*invalid pos*/ ||
+            static_cast<uint32_t>(record.beginPos) > regionEnd)
             break; // no records can be found anymore in coordinate sorted file
 
         if (static_cast<uint32_t>(record.beginPos) >= regionStart) // we do not support overlap but the start position of a record
@@ -440,25 +433,31 @@ jumpToRegion(FormattedFile<Bam, Input, TSpec> & bamFile,
  * @param[in]     index          The @link BamIndex @endlink to use for jumping.
  */
 
-template <typename TSpec>
+inline bool
+_getOrphansFileOffset(uint64_t & aliOffset, BamIndex<Bai> const & index)
+{
+    // Search linear indices for the largest entry of all references.
+    for (int i = length(index._linearIndices) - 1; i >= 0; --i)
+        if (!empty(index._linearIndices[i]))
+        {
+            aliOffset = back(index._linearIndices[i]);
+            return true;
+        }
+    return false;
+}
+
+template <typename TSpec, typename TIndexSpec>
 bool jumpToOrphans(FormattedFile<Bam, Input, TSpec> & bamFile,
                    bool & hasAlignments,
-                   BamIndex<Bai> const & index)
+                   BamIndex<TIndexSpec> const & index)
 {
     if (!isEqual(format(bamFile), Bam()))
         return false;
 
     hasAlignments = false;
 
-    // Search linear indices for the largest entry of all references.
-    uint64_t aliOffset = std::numeric_limits<uint64_t>::max();
-    for (int i = length(index._linearIndices) - 1; i >= 0; --i)
-        if (!empty(index._linearIndices[i]))
-        {
-            aliOffset = back(index._linearIndices[i]);
-            break;
-        }
-    if (aliOffset == std::numeric_limits<uint64_t>::max())
+    uint64_t aliOffset = 0;
+    if (!_getOrphansFileOffset(aliOffset, index))
         return false;  // No offset found.
 
     // Get index of the first orphan alignment by seeking from linear index bucket.
@@ -505,8 +504,9 @@ bool jumpToOrphans(FormattedFile<Bam, Input, TSpec> & bamFile,
  * @return    uint64_t  The number of unaligned reads.
  */
 
+template <typename TIndexSpec>
 inline uint64_t
-getUnalignedCount(BamIndex<Bai> const & index)
+getUnalignedCount(BamIndex<TIndexSpec> const & index)
 {
     return index._unalignedCount;
 }
@@ -730,197 +730,206 @@ inline bool save(BamIndex<Bai> const & index, char const * baiFilename)
 }
 
 
-inline void _baiAddAlignmentChunkToBin(BamIndex<Bai> & index,
-                                       uint32_t currBin,
-                                       uint32_t currOffset,
-                                       uint64_t prevOffset)
-{
-    // If this is not the first reference sequence then add previous reference data.
-    Pair<uint64_t> newChunk(currOffset, prevOffset);
-
-    // If no interest exists yet for this bin, create one and store alignment chunk.
-    BamIndex<Bai>::TBinIndex_::iterator binIter = back(index._binIndices).find(currBin);
-    if (binIter == back(index._binIndices).end())
-    {
-        BaiBamIndexBinData_ binData;
-        appendValue(binData.chunkBegEnds, newChunk);
-        back(index._binIndices).insert(std::make_pair(currBin, binData));
-    }
-    else
-    {
-        // Otherwise, just append alignment chunk.
-        appendValue(binIter->second.chunkBegEnds, newChunk);
-    }
-}
-
 // ---------------------------------------------------------------------------
-// Function build()
+// Function _bamIndexScanRecords()
 // ---------------------------------------------------------------------------
-// TODO(dadi): uncomment when BamIndex.build index is fixed. DOX commented out
-/*
- * @fn BamIndex#build
- * @brief Create a BamIndex from BAM file.
- *
- * @signature bool build(baiIndex, bamFileName);
- *
- * @param[out] baiIndex    The BamIndex to build into.
- * @param[in]  bamFileName Path to the BAM file to build an index for.  Type: <tt>char const *</tt>.
- *
- * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
- */
-inline bool build(BamIndex<Bai> & index, char const * bamFilename)
-{
-    // SEQAN_FAIL("This does not work yet!");
-
-    index._unalignedCount = 0;
-    clear(index._binIndices);
-    clear(index._linearIndices);
 
-    // Open BAM file for reading.
-    BamFileIn bamFile;
-    if (!open(bamFile, bamFilename))
-        return false;  // Could not open BAM file.
-
-    // Read BAM header.
-    BamHeader header;
-    readHeader(header, bamFile);
-
-    uint32_t numRefSeqs = length(contigNames(context(bamFile)));
-
-    // Scan over BAM file and create index.
-    BamAlignmentRecord record;
-    uint32_t currBin    = std::numeric_limits<uint32_t>::max();
-    uint32_t prevBin    = std::numeric_limits<uint32_t>::max();
-    int32_t currRefId   = BamAlignmentRecord::INVALID_REFID;
-    int32_t prevRefId   = BamAlignmentRecord::INVALID_REFID;
-    uint64_t currOffset = position(bamFile);
-    uint64_t prevOffset = currOffset;
-    int32_t prevPos     = std::numeric_limits<int32_t>::min();
-
-    while (!atEnd(bamFile))
+// Add the BAM records starting at recordBegins[from, to) to an index part.
+// recordBegins holds one more entry, the end of the last record.
+
+inline void
+_bamIndexScanRecords(BinningIndexPart_ & part,
+                     BgzfBatchReader_ const & reader,
+                     String<size_t> const & recordBegins,
+                     size_t from,
+                     size_t to,
+                     int minShift,
+                     int depth)
+{
+    for (size_t i = from; i < to; ++i)
     {
-        // Load next record.
-        readRecord(record, bamFile);
+        char const * record = &reader.buffer[recordBegins[i]];
+        size_t recordLen = recordBegins[i + 1] - recordBegins[i];
 
-        // Check ordering.
-        if (prevRefId == record.rID && prevPos > record.beginPos)
-            return false;
+        int32_t rID = _bgzfUnpack32(record + 4);
+        int32_t beginPos = _bgzfUnpack32(record + 8);
+        uint32_t readNameLen = static_cast<uint8_t>(record[12]);
+        uint32_t numCigarOps = _bgzfUnpack16(record + 16);
+        uint32_t flag = _bgzfUnpack16(record + 18);
 
-        // The reference sequence changed, close bins for previous reference.
-        if (prevRefId != record.rID)
+        if (36 + readNameLen + 4 * numCigarOps > recordLen)
         {
-            if (prevRefId != BamAlignmentRecord::INVALID_REFID)
-            {
-                _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-                // Add an index for all empty references between prevRefId (excluded) and record.rID (included).
-                for (int i = prevRefId + 1; i < record.rID; ++i)
-                {
-                    BamIndex<Bai>::TBinIndex_ binIndex;
-                    appendValue(index._binIndices, binIndex);
-                    BamIndex<Bai>::TLinearIndex_ linearIndex;
-                    appendValue(index._linearIndices, linearIndex);
-                }
+            part.ok = false;
+            return;
+        }
 
-                // Update bin book keeping.
-                currOffset = prevOffset;
-                currBin    = record.bin;
-                prevBin    = record.bin;
-                currRefId  = record.rID;
-            }
-            else
+        // Compute the end position like bam_endpos() of htslib.
+        bool isMapped = !(flag & BAM_FLAG_UNMAPPED);
+        int64_t refLen = 0;
+        if (isMapped)
+        {
+            char const * cigar = record + 36 + readNameLen;
+            for (uint32_t j = 0; j < numCigarOps; ++j)
             {
-                // Otherwise, this is the first pass.  Create an index for all empty references up to and including
-                // current refId.
-                for (int i = 0; i < record.rID; ++i)
+                uint32_t op = _bgzfUnpack32(cigar + 4 * j);
+                switch (op & 15)
                 {
-                    BamIndex<Bai>::TBinIndex_ binIndex;
-                    appendValue(index._binIndices, binIndex);
-                    BamIndex<Bai>::TLinearIndex_ linearIndex;
-                    appendValue(index._linearIndices, linearIndex);
+                    case 0: case 2: case 3: case 7: case 8:     // M, D, N, =, X
+                        refLen += op >> 4;
                 }
             }
-
-            // Update reference book keeping.
-            prevRefId = record.rID;
-            prevBin = std::numeric_limits<int32_t>::min();
         }
+        if (refLen == 0)
+            refLen = 1;
+
+        _binningIndexAddRecord(part, rID, beginPos, beginPos + refLen, isMapped,
+                               _bgzfVirtualOffset(reader, recordBegins[i]),
+                               _bgzfVirtualOffset(reader, recordBegins[i + 1]),
+                               minShift, depth);
+    }
+}
 
-        // If the alignment's reference id is valid and its bin is not a leaf.
-        if (record.rID >= 0 && record.bin < 4681)
+// ---------------------------------------------------------------------------
+// Function _bamIndexBuild()
+// ---------------------------------------------------------------------------
+
+// The BGZF blocks are read in batches of threads * blocksPerThread blocks.
+// Every thread decompresses blocks and bins a contiguous range of the
+// batch's records; the parts are then merged in file order.
+
+template <typename TBinIndex>
+inline bool _bamIndexBuild(BinningIndexBuilder_<TBinIndex> & builder,
+                           char const * bamFilename,
+                           uint64_t recordsOffset,
+                           size_t threads,
+                           size_t blocksPerThread)
+{
+    BgzfBatchReader_ reader;
+    if (!open(reader, bamFilename, recordsOffset))
+        return false;
+
+    String<BinningIndexPart_> parts;
+    resize(parts, threads);
+    String<size_t> recordBegins;
+
+    while (_readBlocks(reader, threads * blocksPerThread, threads))
+    {
+        // Find the complete records in the buffer, the rest is carried over.
+        clear(recordBegins);
+        size_t pos = 0;
+        while (pos + 4 <= length(reader.buffer))
         {
-            int32_t beginOffset = record.beginPos >> BamIndex<Bai>::BAM_LIDX_SHIFT;
-            int32_t endPos      = getAlignmentLengthInRef(record);
-            int32_t endOffset   = (endPos - 1) >> BamIndex<Bai>::BAM_LIDX_SHIFT;
-
-            // Resize linear index if necessary.
-            unsigned oldSize = length(index._linearIndices);
-            unsigned newSize = endOffset + 1;
-            if (oldSize < newSize)
-                resize(back(index._linearIndices), newSize, 0);
-
-            // Store offset.
-            for (int i = beginOffset + 1; i <= endOffset; ++i)
-                if (back(index._linearIndices)[i] == 0u)
-                    back(index._linearIndices)[i] = prevOffset;
+            int32_t blockSize = _bgzfUnpack32(&reader.buffer[pos]);
+            if (blockSize < 32)
+                return false;  // Corrupt record.
+            if (pos + 4 + blockSize > length(reader.buffer))
+                break;
+            appendValue(recordBegins, pos);
+            pos += 4 + blockSize;
         }
+        appendValue(recordBegins, pos);
 
-        // Handle the case if we changed to a new BAI bin.
-        if (record.bin != prevBin)
+        // Bin the records of each part independently and merge the parts in file order.
+        size_t numRecords = length(recordBegins) - 1;
+        SEQAN_OMP_PRAGMA(parallel for num_threads(threads) schedule(static, 1))
+        for (int64_t t = 0; t < static_cast<int64_t>(threads); ++t)
         {
-            // If not first bin of reference, save previous bin data.
-            if (currBin != std::numeric_limits<uint32_t>::max())
-                _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-            // Update markers.
-            currOffset = prevOffset;
-            currBin    = record.bin;
-            prevBin    = record.bin;
-            currRefId  = record.rID;
-
-            // If the reference id is invalid then break out.
-            if (currRefId < 0)
-                break;
+            clear(parts[t].runs);
+            clear(parts[t].linear);
+            parts[t].ok = true;
+            _bamIndexScanRecords(parts[t], reader, recordBegins, numRecords * t / threads,
+                                 numRecords * (t + 1) / threads, builder.minShift, builder.depth);
         }
+        for (size_t t = 0; t < threads; ++t)
+            _binningIndexMerge(builder, parts[t]);
 
-        // Make sure that the current file pointer is beyond prevOffset.
-        if (position(bamFile) <= static_cast<int64_t>(prevOffset))
-            return false;  // Calculating offsets failed.
+        if (!builder.ok)
+            return false;
 
-        // Update prevOffset and prevPos.
-        prevOffset = position(bamFile);
-        prevPos    = record.beginPos;
+        _consumeBuffer(reader, pos);
     }
 
-    // Count remaining unaligned records.
-    while (!atEnd(bamFile))
-    {
-        SEQAN_ASSERT_GT(index._unalignedCount, 0u);
+    // A truncated record or a broken block is an error.
+    if (!reader.ok || !empty(reader.buffer))
+        return false;
 
-        readRecord(record, bamFile);
-        if (record.rID >= 0)
-            return false;  // Could not read record.
+    return _binningIndexFinish(builder);
+}
 
-        index._unalignedCount += 1;
-    }
+// ---------------------------------------------------------------------------
+// Function _baiBuild()
+// ---------------------------------------------------------------------------
 
-    // After loading all alignments, if any data was read, perform checks.
-    if (currRefId >= 0)
-    {
-        // Store last alignment chunk to its bin and then write last reference entry with data.
-        _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
+inline bool _baiBuild(BamIndex<Bai> & index,
+                      char const * bamFilename,
+                      size_t threads,
+                      size_t blocksPerThread)
+{
+    index._unalignedCount = 0;
+    clear(index._binIndices);
+    clear(index._linearIndices);
 
-        // Finally, write any empty references remaining at end of file.
-        SEQAN_ASSERT_GEQ(numRefSeqs, length(index._binIndices));
-        BamIndex<Bai>::TBinIndex_ binIndex;
-        resize(index._binIndices, numRefSeqs, binIndex);  // TODO(holtgrew): binIndex is unnecessary if resize used T() as default value as vector.resize() does.
+    // Read the BAM header to learn the references and where the records start.
+    uint64_t recordsOffset = 0;
+    uint32_t numRefSeqs = 0;
+    {
+        BamFileIn bamFile;
+        if (!open(bamFile, bamFilename))
+            return false;  // Could not open BAM file.
+
+        BamHeader header;
+        readHeader(header, bamFile);
+        numRefSeqs = length(contigNames(context(bamFile)));
+        recordsOffset = position(bamFile);
     }
 
-    // Merge small bins if possible.
-    // SEQAN_FAIL("TODO: Merge bins!");
+    BinningIndexBuilder_<BamIndex<Bai>::TBinIndex_> builder(numRefSeqs, BamIndex<Bai>::BAM_LIDX_SHIFT, 5);
+    if (!_bamIndexBuild(builder, bamFilename, recordsOffset, threads, blocksPerThread))
+        return false;
+
+    swap(index._binIndices, builder.binIndices);
+    swap(index._linearIndices, builder.linearIndices);
+    index._unalignedCount = builder.unalignedCount;
     return true;
 }
 
+// ---------------------------------------------------------------------------
+// Function build()
+// ---------------------------------------------------------------------------
+
+/*!
+ * @fn BamIndex#build
+ * @brief Create a BamIndex from BAM file.
+ *
+ * @signature bool build(baiIndex, bamFileName[, execPolicy]);
+ *
+ * @param[out] baiIndex    The BamIndex to build into.
+ * @param[in]  bamFileName Path to the BAM file to build an index for.  Type: <tt>char const *</tt>.
+ * @param[in]  execPolicy  The @link ExecutionPolicy @endlink to use.  With a parallel policy the BGZF blocks
+ *                         are decompressed and binned by <tt>numThreads(execPolicy)</tt> threads.  Defaults to
+ *                         @link ExecutionPolicy#Sequential @endlink.
+ *
+ * The BAM file must be sorted by coordinate.  The resulting index is the same for every number of threads and
+ * has the same bins, chunks, and linear index as the one created by <tt>samtools index</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
+ */
+
+template <typename TParallel, typename TVectorization>
+inline bool build(BamIndex<Bai> & index,
+                  char const * bamFilename,
+                  ExecutionPolicy<TParallel, TVectorization> const & execPolicy)
+{
+    // Each thread decompresses and bins 64 BGZF blocks per batch.
+    size_t threads = IsParallel<TParallel>::VALUE ? std::max(numThreads(execPolicy), static_cast<size_t>(1)) : 1;
+    return _baiBuild(index, bamFilename, threads, 64);
+}
+
+inline bool build(BamIndex<Bai> & index, char const * bamFilename)
+{
+    return build(index, bamFilename, Sequential());
+}
+
 
 }  // namespace seqan2
 
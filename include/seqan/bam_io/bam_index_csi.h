@@ -0,0 +1,414 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// CSI index for BAM files.  CSI generalizes the binning scheme of BAI to a
+// configurable size of the smallest bin (min_shift) and number of levels
+// (depth) and thus supports references longer than 2^29 bases.  Instead of a
+// linear index every bin stores the smallest virtual offset of the records
+// overlapping its first window.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
+#define INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag Csi
+// ----------------------------------------------------------------------------
+
+struct Csi_;
+typedef Tag<Csi_> Csi;
+
+// ----------------------------------------------------------------------------
+// Helper Class CsiBamIndexBinData_
+// ----------------------------------------------------------------------------
+
+// Store the information of a bin.
+
+struct CsiBamIndexBinData_
+{
+    uint64_t loff;
+    String<Pair<uint64_t, uint64_t> > chunkBegEnds;
+
+    CsiBamIndexBinData_() : loff(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Spec CSI BamIndex
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class CsiBamIndex
+ * @headerfile <seqan/bam_io.h>
+ * @extends BamIndex
+ * @brief Access to CSI (coordinate-sorted index, samtools-style).
+ *
+ * @signature template <>
+ *            class BamIndex<Csi>;
+ *
+ * In contrast to @link BaiBamIndex @endlink, a CSI index can be used for references longer than 2^29 bases.  The
+ * size of the smallest bin is <tt>2^minShift</tt>, each of the <tt>depth</tt> levels above has bins that are 8
+ * times larger.  Both are read from the index file by @link BamIndex#open @endlink and are used by
+ * @link BamIndex#build @endlink.  With a <tt>depth</tt> of 0, @link BamIndex#build @endlink chooses the smallest
+ * depth that covers the longest reference like <tt>samtools index -c</tt>.
+ */
+
+/*!
+ * @fn CsiBamIndex::BamIndex
+ * @brief Constructor.
+ *
+ * @signature BamIndex::BamIndex();
+ *
+ * @section Remarks
+ *
+ * Only the default constructor is provided.  It sets <tt>minShift</tt> to 14 and <tt>depth</tt> to 0.
+ */
+
+/*!
+ * @var int32_t CsiBamIndex::minShift
+ * @brief The size of the smallest bin is <tt>2^minShift</tt>, defaults to 14.
+ *
+ * @var int32_t CsiBamIndex::depth
+ * @brief The number of levels below the root bin, defaults to 0 (computed on building).
+ */
+
+template <>
+class BamIndex<Csi>
+{
+public:
+    typedef std::map<uint32_t, CsiBamIndexBinData_> TBinIndex_;
+
+    int32_t minShift;
+    int32_t depth;
+    CharString _aux;                // auxiliary data, e.g. the Tabix configuration
+    uint64_t _unalignedCount;
+
+    String<TBinIndex_> _binIndices;
+
+    BamIndex() : minShift(14), depth(0), _unalignedCount(std::numeric_limits<uint64_t>::max())
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _bamIndexReg2bins()
+// ----------------------------------------------------------------------------
+
+// This function expects 0-based coordinates and includes the positions beg and end.
+
+inline void
+_bamIndexReg2bins(std::vector<uint32_t> & list, BamIndex<Csi> const & index, uint32_t const beg, uint32_t const end)
+{
+    SEQAN_ASSERT_LEQ(beg, end);
+
+    _binningReg2bins(list, beg, static_cast<int64_t>(end) + 1, index.minShift, index.depth);
+}
+
+// ----------------------------------------------------------------------------
+// Function _getMinFileOffset()
+// ----------------------------------------------------------------------------
+
+// Use the loff of the first existing bin at or left of the position on the
+// lowest level, or of one of its ancestors, like hts_itr_query() of htslib.
+// The offset is at least the one of the reference's first record.
+
+inline bool
+_getMinFileOffset(uint64_t & minFileOffset,
+                  BamIndex<Csi> const & bamIndex,
+                  int32_t const refId,
+                  uint32_t const position)
+{
+    typedef BamIndex<Csi>::TBinIndex_::const_iterator TBinIter;
+
+    BamIndex<Csi>::TBinIndex_ const & binIndex = bamIndex._binIndices[refId];
+
+    TBinIter metaIt = binIndex.find(_binningNumBins(bamIndex.depth) + 1);
+    if (metaIt == binIndex.end() || empty(metaIt->second.chunkBegEnds))
+        return false;   // No records on this reference.
+
+    uint32_t bin = _binningNumBins(bamIndex.depth - 1) + (position >> bamIndex.minShift);
+    TBinIter it = binIndex.find(bin);
+    while (it == binIndex.end() && bin != 0)
+    {
+        uint32_t first = (((bin - 1) >> 3) << 3) + 1;
+        bin = (bin > first) ? bin - 1 : (bin - 1) >> 3;
+        it = binIndex.find(bin);
+    }
+
+    minFileOffset = front(metaIt->second.chunkBegEnds).i1;
+    if (it != binIndex.end())
+        minFileOffset = std::max(minFileOffset, it->second.loff);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _getOrphansFileOffset()
+// ----------------------------------------------------------------------------
+
+// The records without coordinate follow the last record of the last reference.
+
+inline bool
+_getOrphansFileOffset(uint64_t & aliOffset, BamIndex<Csi> const & index)
+{
+    typedef BamIndex<Csi>::TBinIndex_::const_iterator TBinIter;
+
+    for (int i = length(index._binIndices) - 1; i >= 0; --i)
+    {
+        TBinIter metaIt = index._binIndices[i].find(_binningNumBins(index.depth) + 1);
+        if (metaIt != index._binIndices[i].end() && !empty(metaIt->second.chunkBegEnds))
+        {
+            aliOffset = front(metaIt->second.chunkBegEnds).i2;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+inline bool
+open(BamIndex<Csi> & index, char const * filename)
+{
+    typedef VirtualStream<char, Input> TInStream;
+
+    TInStream csi;
+    if (!open(csi, filename))
+        return false;  // Could not open file.
+
+    DirectionIterator<TInStream, Input>::Type iter = directionIterator(csi, Input());
+
+    // Read magic header.
+    String<char, Array<4> > magic;
+    read(magic, iter, 4);
+    if (magic != "CSI\1")
+        SEQAN_THROW(ParseError("Not in CSI format."));
+
+    // Read parameters and auxiliary data.
+    int32_t lAux = 0;
+    readRawPod(index.minShift, iter);
+    readRawPod(index.depth, iter);
+    readRawPod(lAux, iter);
+    clear(index._aux);
+    read(index._aux, iter, lAux);
+
+    if (index.minShift < 0 || index.depth < 0 || index.depth > 9 || index.minShift + 3 * index.depth > 62)
+        SEQAN_THROW(ParseError("Invalid CSI binning scheme."));
+
+    int32_t nRef = 0;
+    readRawPod(nRef, iter);
+
+    clear(index._binIndices);
+    resize(index._binIndices, nRef);
+
+    CsiBamIndexBinData_ data;
+    for (int i = 0; i < nRef; ++i)  // For each reference.
+    {
+        int32_t nBin = 0;
+        readRawPod(nBin, iter);
+
+        for (int j = 0; j < nBin; ++j)  // For each bin.
+        {
+            uint32_t bin = 0;
+            int32_t nChunk = 0;
+            readRawPod(bin, iter);
+            readRawPod(data.loff, iter);
+            readRawPod(nChunk, iter);
+
+            resize(data.chunkBegEnds, nChunk);
+            for (int k = 0; k < nChunk; ++k)  // For each chunk;
+            {
+                readRawPod(data.chunkBegEnds[k].i1, iter);
+                readRawPod(data.chunkBegEnds[k].i2, iter);
+            }
+
+            // Copy bin data into index.
+            index._binIndices[i][bin] = data;
+        }
+    }
+
+    // Read (optional) number of alignments without coordinate.
+    if (!atEnd(iter))
+        readRawPod(index._unalignedCount, iter);
+    else
+        index._unalignedCount = 0;
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Function save()
+// ---------------------------------------------------------------------------
+
+inline bool save(BamIndex<Csi> const & index, char const * csiFilename)
+{
+    typedef VirtualStream<char, Output>         TOutStream;
+    typedef BamIndex<Csi>::TBinIndex_           TBinIndex;
+    typedef TBinIndex::const_iterator           TBinIndexIter;
+
+    std::ofstream file(csiFilename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;  // Could not open file.
+
+    {
+        TOutStream csi;
+        if (!open(csi, file, BgzfFile()))
+            return false;
+
+        DirectionIterator<TOutStream, Output>::Type iter = directionIterator(csi, Output());
+
+        // Write magic header, binning scheme, and auxiliary data.
+        write(iter, "CSI\1");
+        appendRawPod(iter, index.minShift);
+        appendRawPod(iter, index.depth);
+        appendRawPod(iter, static_cast<int32_t>(length(index._aux)));
+        write(iter, index._aux);
+        appendRawPod(iter, static_cast<int32_t>(length(index._binIndices)));
+
+        for (unsigned i = 0; i < length(index._binIndices); ++i)
+        {
+            TBinIndex const & binIndex = index._binIndices[i];
+
+            appendRawPod(iter, static_cast<int32_t>(binIndex.size()));
+            for (TBinIndexIter itB = binIndex.begin(), itBEnd = binIndex.end(); itB != itBEnd; ++itB)
+            {
+                appendRawPod(iter, itB->first);
+                appendRawPod(iter, itB->second.loff);
+                appendRawPod(iter, static_cast<int32_t>(length(itB->second.chunkBegEnds)));
+                for (size_t k = 0; k < length(itB->second.chunkBegEnds); ++k)
+                {
+                    appendRawPod(iter, itB->second.chunkBegEnds[k].i1);
+                    appendRawPod(iter, itB->second.chunkBegEnds[k].i2);
+                }
+            }
+        }
+
+        // Write the number of unaligned reads if set.
+        if (index._unalignedCount != std::numeric_limits<uint64_t>::max())
+            appendRawPod(iter, index._unalignedCount);
+    }
+
+    return file.good();  // false on error, true on success.
+}
+
+// ---------------------------------------------------------------------------
+// Function _csiBuild()
+// ---------------------------------------------------------------------------
+
+inline bool _csiBuild(BamIndex<Csi> & index,
+                      char const * bamFilename,
+                      size_t threads,
+                      size_t blocksPerThread)
+{
+    typedef BamIndex<Csi>::TBinIndex_::iterator TBinIter;
+
+    index._unalignedCount = 0;
+    clear(index._binIndices);
+    clear(index._aux);
+
+    // Read the BAM header to learn the references and where the records start.
+    uint64_t recordsOffset = 0;
+    uint32_t numRefSeqs = 0;
+    int64_t maxLength = 0;
+    {
+        BamFileIn bamFile;
+        if (!open(bamFile, bamFilename))
+            return false;  // Could not open BAM file.
+
+        BamHeader header;
+        readHeader(header, bamFile);
+        numRefSeqs = length(contigNames(context(bamFile)));
+        for (uint32_t i = 0; i < numRefSeqs; ++i)
+            maxLength = std::max(maxLength, static_cast<int64_t>(contigLengths(context(bamFile))[i]));
+        recordsOffset = position(bamFile);
+    }
+
+    // Choose the number of levels such that the longest reference fits, like samtools.
+    if (index.depth <= 0)
+    {
+        index.depth = 0;
+        for (int64_t s = 1ll << index.minShift; maxLength + 256 > s; s <<= 3)
+            ++index.depth;
+    }
+
+    BinningIndexBuilder_<BamIndex<Csi>::TBinIndex_> builder(numRefSeqs, index.minShift, index.depth);
+    if (!_bamIndexBuild(builder, bamFilename, recordsOffset, threads, blocksPerThread))
+        return false;
+
+    // The linear index is only needed for the smallest offset of each bin.
+    uint32_t const numBins = _binningNumBins(index.depth);
+    for (unsigned i = 0; i < length(builder.binIndices); ++i)
+    {
+        String<uint64_t> const & linear = builder.linearIndices[i];
+        for (TBinIter it = builder.binIndices[i].begin(); it != builder.binIndices[i].end(); ++it)
+        {
+            uint64_t bottom = _binningBinBottom(it->first, index.depth);
+            it->second.loff = (it->first < numBins && bottom < length(linear)) ? linear[bottom] : 0;
+        }
+    }
+
+    swap(index._binIndices, builder.binIndices);
+    index._unalignedCount = builder.unalignedCount;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Function build()
+// ---------------------------------------------------------------------------
+
+template <typename TParallel, typename TVectorization>
+inline bool build(BamIndex<Csi> & index,
+                  char const * bamFilename,
+                  ExecutionPolicy<TParallel, TVectorization> const & execPolicy)
+{
+    // Each thread decompresses and bins 64 BGZF blocks per batch.
+    size_t threads = IsParallel<TParallel>::VALUE ? std::max(numThreads(execPolicy), static_cast<size_t>(1)) : 1;
+    return _csiBuild(index, bamFilename, threads, 64);
+}
+
+inline bool build(BamIndex<Csi> & index, char const * bamFilename)
+{
+    return build(index, bamFilename, Sequential());
+}
+
+}  // namespace seqan2
+
+#endif  // #ifndef INCLUDE_SEQAN_BAM_IO_BAM_INDEX_CSI_H_
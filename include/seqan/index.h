@@ -42,6 +42,7 @@
 #include <seqan/pipe.h>
 #include <seqan/modifier.h>
 #include <seqan/parallel.h>
+#include <seqan/simd.h>
 
 #include <seqan/find.h>
 #include <seqan/misc/set.h>
@@ -100,6 +101,7 @@
 #include <seqan/index/index_sa_lss.h>
 #include <seqan/index/index_sa_mm.h>
 #include <seqan/index/index_sa_qsort.h>
+#include <seqan/index/index_sa_prefix_doubling.h>
 #include <seqan/index/index_sa_bwtwalk.h>
 
 #include <seqan/index/pump_extender3.h>
@@ -119,6 +121,7 @@
 
 #include <seqan/index/pump_lcp_core.h>
 #include <seqan/index/index_lcp.h>
+#include <seqan/index/index_lcp_phi.h>
 #include <seqan/index/index_lcp_tree.h>
 
 #include <seqan/index/index_childtab.h>
@@ -240,5 +243,6 @@
 // ----------------------------------------------------------------------------
 
 #include <seqan/index/find_index_lambda.h>
+#include <seqan/index/find_index_batch.h>
 
 #endif //#ifndef SEQAN_HEADER_...
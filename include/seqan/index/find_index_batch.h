@@ -0,0 +1,215 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Batched exact backward search of many needles in an FM index.  The needles
+// of a batch are advanced in lockstep and the rank blocks of the next
+// LF-mapping are prefetched for all of them before any is computed, so that
+// the cache misses of independent needles overlap.
+// ==========================================================================
+
+#ifndef SEQAN_INDEX_FIND_INDEX_BATCH_H_
+#define SEQAN_INDEX_FIND_INDEX_BATCH_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class FindBatchConfig_
+// ----------------------------------------------------------------------------
+
+struct FindBatchConfig_
+{
+    // Number of needles searched in lockstep.  Enough to cover the memory latency, few enough to keep their rank
+    // blocks in L1 until they are used.
+    static const unsigned BATCH_SIZE = 32;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _findBatchImpl()
+// ----------------------------------------------------------------------------
+// Searches needles [needlesBeg, needlesEnd) and reports the occurrences in the order of the needles.
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TNeedles, typename TPos,
+          typename TThreshold, typename TDelegate>
+inline void
+_findBatchImpl(Index<TText, FMIndex<TOccSpec, TIndexSpec> > & index,
+               TNeedles const & needles,
+               TPos needlesBeg,
+               TPos needlesEnd,
+               TThreshold /* threshold */,
+               TDelegate && delegate)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TIndexSpec> >            TIndex;
+    typedef typename Iterator<TIndex, TopDown<> >::Type             TIndexIt;
+    typedef typename Fibre<TIndex, FibreLF>::Type                   TLF;
+    typedef typename Size<TIndex>::Type                             TSize;
+    typedef Pair<TSize>                                             TRange;
+    typedef typename Iterator<TNeedles const, Rooted>::Type         TNeedlesIt;
+    typedef typename Size<typename Value<TNeedles const>::Type>::Type TNeedleSize;
+
+    static const unsigned BATCH_SIZE = FindBatchConfig_::BATCH_SIZE;
+
+    TIndexIt root(index);
+    TLF const & lf = indexLF(index);
+
+    std::vector<TIndexIt> its(BATCH_SIZE, root);
+    TNeedleSize depth[BATCH_SIZE];
+    bool found[BATCH_SIZE];
+    unsigned active[BATCH_SIZE];
+
+    for (TPos batchBeg = needlesBeg; batchBeg < needlesEnd; batchBeg += BATCH_SIZE)
+    {
+        unsigned batchSize = _min(static_cast<TPos>(BATCH_SIZE), needlesEnd - batchBeg);
+        unsigned activeCount = 0;
+
+        for (unsigned lane = 0; lane < batchSize; ++lane)
+        {
+            its[lane] = root;
+            depth[lane] = 0;
+            found[lane] = empty(needles[batchBeg + lane]);
+            if (!found[lane])
+            {
+                _historyPush(its[lane]);
+                active[activeCount++] = lane;
+            }
+        }
+
+        while (activeCount != 0)
+        {
+            // Prefetch the rank blocks of both range borders of all needles before the first LF-mapping.
+            for (unsigned i = 0; i < activeCount; ++i)
+            {
+                TRange r = range(index, value(its[active[i]]));
+                _prefetchLF(lf, r.i1);
+                _prefetchLF(lf, r.i2);
+            }
+
+            unsigned stillActive = 0;
+            for (unsigned i = 0; i < activeCount; ++i)
+            {
+                unsigned lane = active[i];
+                TIndexIt & it = its[lane];
+                typename Value<TNeedles const>::Type const & needle = needles[batchBeg + lane];
+
+                TRange _range;
+                TSize _smaller = 0;
+                if (isLeaf(it) || !_getNodeByChar(it, value(it), _range, _smaller, needle[depth[lane]]))
+                    continue;
+
+                value(it).range = _range;
+                value(it).smaller = _smaller;
+
+                if (++depth[lane] == length(needle))
+                {
+                    value(it).repLen += depth[lane];
+                    value(it).lastChar = needle[depth[lane] - 1];
+                    found[lane] = true;
+                }
+                else
+                {
+                    active[stillActive++] = lane;
+                }
+            }
+            activeCount = stillActive;
+        }
+
+        for (unsigned lane = 0; lane < batchSize; ++lane)
+        {
+            if (found[lane])
+            {
+                TNeedlesIt needlesIt = begin(needles, Rooted()) + (batchBeg + lane);
+                delegate(its[lane], needlesIt, TThreshold());
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function find(fmIndex, needles, errors, [](...){}, Backtracking<Exact>(), Serial());
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TNeedle, typename TSSetSpec,
+          typename TThreshold, typename TDelegate, typename TSpec>
+inline void find(Index<TText, FMIndex<TOccSpec, TIndexSpec> > & index,
+                 StringSet<TNeedle, TSSetSpec> const & needles,
+                 TThreshold threshold,
+                 TDelegate && delegate,
+                 Backtracking<Exact, TSpec>,
+                 Serial)
+{
+    typedef typename Size<StringSet<TNeedle, TSSetSpec> const>::Type    TSize;
+
+    _findBatchImpl(index, needles, TSize(0), length(needles), threshold, delegate);
+}
+
+// ----------------------------------------------------------------------------
+// Function find(fmIndex, needles, errors, [](...){}, Backtracking<Exact>(), Parallel());
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TNeedle, typename TSSetSpec,
+          typename TThreshold, typename TDelegate, typename TSpec>
+inline void find(Index<TText, FMIndex<TOccSpec, TIndexSpec> > & index,
+                 StringSet<TNeedle, TSSetSpec> const & needles,
+                 TThreshold threshold,
+                 TDelegate && delegate,
+                 Backtracking<Exact, TSpec>,
+                 Parallel)
+{
+    typedef typename Size<StringSet<TNeedle, TSSetSpec> const>::Type    TSize;
+    typedef typename MakeSigned<TSize>::Type                            TSignedSize;
+
+    static const TSize BATCH_SIZE = FindBatchConfig_::BATCH_SIZE;
+
+    // Build the index fibres before the threads share it.
+    typename Iterator<Index<TText, FMIndex<TOccSpec, TIndexSpec> >, TopDown<> >::Type root(index);
+    ignoreUnusedVariableWarning(root);
+
+    TSize needlesCount = length(needles);
+    TSignedSize batchesCount = (needlesCount + BATCH_SIZE - 1) / BATCH_SIZE;
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (TSignedSize batch = 0; batch < batchesCount; ++batch)
+    {
+        TSize batchBeg = batch * BATCH_SIZE;
+        _findBatchImpl(index, needles, batchBeg, _min(needlesCount, batchBeg + BATCH_SIZE), threshold, delegate);
+    }
+}
+
+}
+
+#endif  // SEQAN_INDEX_FIND_INDEX_BATCH_H_
@@ -51,6 +51,7 @@ namespace seqan2
     struct LarssonSadakane;
     struct ManberMyers;
     struct SAQSort;
+    struct ParallelPrefixDoubling;
     struct QGramAlg;
 
     // inverse suffix array construction specs
@@ -60,10 +61,13 @@ namespace seqan2
     // lcp table construction algorithms
     struct Kasai;
     struct KasaiOriginal;    // original, but more space-consuming algorithm
+    struct KarkkainenPhi;
+    struct SemiExternalPhi;
 
     // enhanced suffix array construction algorithms
     struct Childtab;
     struct Bwt;
+    struct SemiExternalBwt;
 
 // ============================================================================
 // Concepts
@@ -43,6 +43,42 @@ namespace seqan2
 
     struct Bwt {};
 
+/*!
+ * @class SemiExternalBwt
+ * @headerfile <seqan/index.h>
+ * @brief Parallel semi-external Burrows-Wheeler table construction.
+ *
+ * @signature struct SemiExternalBwt;
+ *
+ * Only the text is accessed randomly and held in memory.  The suffix array is read and the Burrows-Wheeler table is
+ * written sequentially in batches, the characters of a batch are looked up by all OpenMP threads.  Use it with
+ * <tt>indexCreate(index, FibreBwt(), SemiExternalBwt(memoryLimit))</tt> and @link ExternalString External Strings
+ * @endlink as suffix array and Burrows-Wheeler table.
+ *
+ * <tt>memoryLimit</tt> covers the same arrays as the one of @link SemiExternalPhi @endlink: the text, the suffix
+ * array and the Burrows-Wheeler table (only the page caches of External Strings) and the batch.  The batch holds at
+ * least 1024 entries.
+ */
+
+/*!
+ * @fn SemiExternalBwt::SemiExternalBwt
+ * @brief Constructor.
+ *
+ * @signature SemiExternalBwt::SemiExternalBwt([memoryLimit]);
+ *
+ * @param[in] memoryLimit Maximal number of bytes of all arrays in memory, including the text and the tables.
+ *                        Default: 1 GiB.
+ */
+
+    struct SemiExternalBwt
+    {
+        uint64_t memoryLimit;
+
+        SemiExternalBwt(uint64_t memoryLimit = 1ull << 30) :
+            memoryLimit(memoryLimit)
+        {}
+    };
+
 
     //////////////////////////////////////////////////////////////////////////////
     // external Bwt algorithm
@@ -250,6 +286,14 @@ namespace seqan2
     // internal Bwt algorithm
     //////////////////////////////////////////////////////////////////////////////
 
+    // The in-memory BWT is filled in parallel if the text and both tables are in memory and the BWT values are not
+    // bit-packed, otherwise concurrent accesses could touch the same word or page.
+    template <typename TBWT, typename TText, typename TSA>
+    struct BwtParallelizable_ :
+        And<And<typename AllowsFastRandomAccess<TText>::Type,
+                typename AllowsFastRandomAccess<TSA>::Type>,
+            IsSameType<typename Spec<TBWT>::Type, Alloc<> > > {};
+
 
     template < typename TBWT,
                typename TText,
@@ -262,10 +306,12 @@ namespace seqan2
         typedef typename Value<TBWT>::Type        TValue;
         typedef typename GetValue<TSA>::Type    TSAValue;
         typedef typename Size<TSA>::Type        TSize;
+        typedef typename MakeSigned<TSize>::Type TSignedSize;
 
-        TSize n = length(s);
+        TSignedSize n = length(s);
 
-        for (TSize i = 0; i < n; ++i)
+        SEQAN_OMP_PRAGMA(parallel for if(BwtParallelizable_<TBWT, TText, TSA>::VALUE))
+        for (TSignedSize i = 0; i < n; ++i)
         {
             TSAValue sa = getValue(SA, i);
             if (sa != 0)
@@ -287,12 +333,14 @@ namespace seqan2
     {
         typedef typename Value<TBWT>::Type        TValue;
         typedef typename Size<TSA>::Type        TSize;
+        typedef typename MakeSigned<TSize>::Type TSignedSize;
 
-        TSize n = lengthSum(s);
-        Pair<unsigned, typename Size<TString>::Type> loc;
+        TSignedSize n = lengthSum(s);
 
-        for (TSize i = 0; i < n; ++i)
+        SEQAN_OMP_PRAGMA(parallel for if(BwtParallelizable_<TBWT, StringSet<TString, TSpec>, TSA>::VALUE))
+        for (TSignedSize i = 0; i < n; ++i)
         {
+            Pair<unsigned, typename Size<TString>::Type> loc;
             posLocalize(loc, getValue(SA, i), stringSetLimits(s));
             if (loc.i2 != 0)
                 bwt[i] = s[loc.i1][loc.i2 - 1];
@@ -305,6 +353,72 @@ namespace seqan2
         }
     }
 
+
+    //////////////////////////////////////////////////////////////////////////////
+    // semi-external Bwt algorithm
+    //////////////////////////////////////////////////////////////////////////////
+
+    template < typename TBWT,
+               typename TText,
+               typename TSA >
+    void _createBWTableSemiExternal(
+        TBWT &bwt,
+        TText const &s,
+        TSA const &SA,
+        uint64_t workspace)
+    {
+        typedef typename Value<TBWT>::Type                  TValue;
+        typedef typename Value<TSA>::Type                   TSAValue;
+        typedef typename Size<TSA>::Type                    TSize;
+        typedef typename MakeSigned<TSize>::Type            TSignedSize;
+        typedef typename Iterator<TSA const, Standard>::Type TSAIter;
+        typedef typename Iterator<TBWT, Standard>::Type     TBWTIter;
+
+        TSize n = length(SA);
+        TSize batchSize = _max(static_cast<TSize>(1024),
+                               _min(n, static_cast<TSize>(workspace / (sizeof(TSAValue) + sizeof(TValue)))));
+
+        String<TSAValue> saBatch;
+        String<TValue> bwtBatch;
+        resize(saBatch, batchSize, Exact());
+        resize(bwtBatch, batchSize, Exact());
+
+        TSAIter saIt = begin(SA, Standard());
+        TBWTIter bwtIt = begin(bwt, Standard());
+        for (TSize batchBeg = 0; batchBeg < n; batchBeg += batchSize)
+        {
+            TSignedSize size = _min(batchSize, n - batchBeg);
+            for (TSignedSize i = 0; i < size; ++i, ++saIt)
+                saBatch[i] = *saIt;
+
+            SEQAN_OMP_PRAGMA(parallel for if(AllowsFastRandomAccess<TText>::VALUE))
+            for (TSignedSize i = 0; i < size; ++i)
+            {
+                if (saBatch[i] != 0)
+                    bwtBatch[i] = getValue(s, saBatch[i] - 1);
+                else
+                    bwtBatch[i] = TValue();
+            }
+
+            for (TSignedSize i = 0; i < size; ++i, ++bwtIt)
+                *bwtIt = bwtBatch[i];
+        }
+    }
+
+    template < typename TBWT,
+               typename TText,
+               typename TSA >
+    inline void createBWTable(
+        TBWT &bwt,
+        TText const &s,
+        TSA const &SA,
+        SemiExternalBwt const &alg)
+    {
+        uint64_t resident = _semiExternalResidentBytes(s) + _semiExternalResidentBytes(SA) +
+                            _semiExternalResidentBytes(bwt);
+        _createBWTableSemiExternal(bwt, concat(s), SA, (alg.memoryLimit > resident) ? alg.memoryLimit - resident : 0);
+    }
+
 //}
 
 }
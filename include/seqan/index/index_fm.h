@@ -135,6 +135,103 @@ struct FastFMIndexConfig
     static const unsigned SAMPLING = 10;
 };
 
+// ----------------------------------------------------------------------------
+// Metafunction MMapFMIndexConfig
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class MMapFMIndexConfig
+ * @headerfile <seqan/index.h>
+ * @brief A configuration object that stores all fibres of the @link FMIndex @endlink in memory-mapped files.
+ *
+ * @signature template <[typename TSpec[, typename TLengthSum[, unsigned LEVELS[, unsigned WORDS_PER_BLOCK]]]]>
+ *            struct MMapFMIndexConfig;
+ *
+ * @tparam TSpec The specializating type, defaults to <tt>void</tt>.
+ * @tparam TLengthSum The underlying type to store precomputed rank values, defaults to <tt>size_t</tt>.
+ *         The type must hold a value equal to the length of the bit vector.
+ * @tparam LEVELS The number of levels of the rank dictionary, defaults to <tt>1</tt>.
+ * @tparam WORDS_PER_BLOCK Number of popcount operations per rank query, defaults to <tt>1</tt>.
+ *
+ * The configuration equals @link FMIndexConfig @endlink except that the rank dictionaries are
+ * @link MMapString @endlink based. Together with a memory-mapped text, e.g. <tt>String&lt;Dna, MMap&lt;&gt; &gt;</tt>,
+ * an index saved by an in-memory FM index with the same parameters is opened without reading it: opening it with
+ * <tt>OPEN_RDONLY</tt> maps the files read-only and shared, such that all processes using the index share the
+ * page cache.
+ *
+ * @code{.cpp}
+ * Index<String<Dna, MMap<> >, FMIndex<void, MMapFMIndexConfig<> > > index;
+ * open(index, "genome", OPEN_RDONLY);
+ * @endcode
+ *
+ * @var unsigned MMapFMIndexConfig::SAMPLING;
+ * @brief The sampling rate determines how many suffix array entries are represented with one entry in the
+ *        @link CompressedSA @endlink.
+ *
+ * @typedef MMapFMIndexConfig::Bwt
+ * @signature typedef WaveletTree<TSpec, TConfig> Bwt;
+ * @brief The <tt>Bwt</tt> determines the type of the occurrence table, a memory-mapped @link WaveletTree @endlink.
+ *
+ * @typedef MMapFMIndexConfig::Sentinels
+ * @signature typedef Levels<TSpec, TConfig> Sentinels;
+ * @brief The <tt>Sentinels</tt> determines the type of the sentinels in the @link FMIndex @endlink, a memory-mapped
+ *        one level @link RankDictionary @endlink.
+ */
+
+template <typename TSpec = void, typename TLengthSum = size_t, unsigned LEVELS = 1, unsigned WORDS_PER_BLOCK = 1>
+struct MMapFMIndexConfig
+{
+    typedef TLengthSum                                                                      LengthSum;
+    typedef WaveletTree<TSpec, WTRDConfig<LengthSum, MMap<>, LEVELS, WORDS_PER_BLOCK> >     Bwt;
+    typedef Levels<TSpec, LevelsRDConfig<LengthSum, MMap<>, LEVELS, WORDS_PER_BLOCK> >      Sentinels;
+
+    static const unsigned SAMPLING = 10;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction InterleavedFMIndexConfig
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class InterleavedFMIndexConfig
+ * @headerfile <seqan/index.h>
+ * @brief A configuration object that determines the data types of certain fibres of the @link FMIndex @endlink.
+ *
+ * @signature template <[typename TSpec[, typename TLengthSum[, unsigned LEVELS]]]>
+ *            struct InterleavedFMIndexConfig;
+ *
+ * @tparam TSpec The specializating type, defaults to <tt>void</tt>.
+ * @tparam TLengthSum The underlying type to store precomputed rank values, defaults to <tt>size_t</tt>.
+ *         The type must hold a value equal to the length of the bit vector.
+ * @tparam LEVELS The number of levels of the occurrence table, defaults to <tt>2</tt>.
+ *
+ * @var unsigned InterleavedFMIndexConfig::SAMPLING;
+ * @brief The sampling rate determines how many suffix array entries are represented with one entry in the
+ *        @link CompressedSA @endlink.
+ *
+ * @typedef InterleavedFMIndexConfig::Bwt
+ * @signature typedef Levels<TSpec, TConfig> Bwt;
+ * @brief The <tt>Bwt</tt> determines the type of the occurrence table. In the @link InterleavedFMIndexConfig
+ *        @endlink object the type of <tt>Bwt</tt> is a rank dictionary with one cache line per block
+ *        (@link InterleavedRDConfig @endlink).
+ *
+ * @typedef InterleavedFMIndexConfig::Sentinels
+ * @signature typedef Levels<TSpec, TConfig> Sentinels;
+ * @brief The <tt>Sentinels</tt> determines the type of the sentinels in the @link FMIndex @endlink. In the
+ *        @link InterleavedFMIndexConfig @endlink object the type of <tt>Sentinels</tt> is a one level
+ *        @link RankDictionary @endlink.
+ */
+
+template <typename TSpec = void, typename TLengthSum = size_t, unsigned LEVELS = 2>
+struct InterleavedFMIndexConfig
+{
+    typedef TLengthSum                                                                  LengthSum;
+    typedef Levels<TSpec, InterleavedRDConfig<LengthSum, Alloc<>, LEVELS> >             Bwt;
+    typedef Levels<TSpec, LevelsRDConfig<LengthSum, Alloc<>, 1> >                       Sentinels;
+
+    static const unsigned SAMPLING = 10;
+};
+
 // ============================================================================
 // Forwards
 // ============================================================================
@@ -240,6 +337,13 @@ struct DefaultFinder<Index<TText, FMIndex<TSpec, TConfig> > >
  *
  * The FM index consists of various @link Fibre @endlink of which the most important ones are the compressed
  * suffix array and the LF table, which provides all necessary information for the LF mapping.
+ *
+ * @section Construction
+ *
+ * The index is built from a temporary full suffix array, which is stored on disk and built by the @link
+ * Index#DefaultIndexCreator @endlink of <tt>FibreSA</tt>.  <tt>indexCreate(index, FibreSALF(), algoTag)</tt> selects
+ * another suffix array creator.  With @link IndexCreatorTags#ParallelPrefixDoubling @endlink the temporary suffix
+ * array is kept in memory and built by <tt>omp_get_max_threads()</tt> threads.
  */
 
 template <typename TText, typename TSpec, typename TConfig>
@@ -425,24 +529,20 @@ _findFirstIndex(Finder<Index<TText, FMIndex<TSpec, TConfig> >, TSpecFinder> & fi
 // Function indexCreate()
 // ----------------------------------------------------------------------------
 
-template <typename TText, typename TSpec, typename TConfig>
-inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF)
+template <typename TText, typename TSpec, typename TConfig, typename TTempSA, typename TAlgo>
+inline bool _indexCreateSALF(Index<TText, FMIndex<TSpec, TConfig> > & index, TTempSA & tempSA, TAlgo const & algo)
 {
     typedef Index<TText, FMIndex<TSpec, TConfig> >               TIndex;
-    typedef typename Fibre<TIndex, FibreTempSA>::Type            TTempSA;
     typedef typename Size<TIndex>::Type                          TSize;
-    typedef typename DefaultIndexCreator<TIndex, FibreSA>::Type  TAlgo;
 
     TText const & text = indexText(index);
 
     if (empty(text))
         return false;
 
-    TTempSA tempSA;
-
     // Create the full SA.
     resize(tempSA, lengthSum(text), Exact());
-    createSuffixArray(tempSA, text, TAlgo());
+    createSuffixArray(tempSA, text, algo);
 
     // Create the LF table.
     createLF(indexLF(index), text, tempSA);
@@ -457,6 +557,34 @@ inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSAL
     return true;
 }
 
+template <typename TText, typename TSpec, typename TConfig, typename TAlgo>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF, TAlgo const & algo)
+{
+    typename Fibre<Index<TText, FMIndex<TSpec, TConfig> >, FibreTempSA>::Type tempSA;
+    return _indexCreateSALF(index, tempSA, algo);
+}
+
+// ParallelPrefixDoubling sorts in memory, so the temporary SA is kept in memory as well.
+template <typename TText, typename TSpec, typename TConfig>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF, ParallelPrefixDoubling const & algo)
+{
+    String<typename SAValue<Index<TText, FMIndex<TSpec, TConfig> > >::Type> tempSA;
+    return _indexCreateSALF(index, tempSA, algo);
+}
+
+template <typename TText, typename TSpec, typename TConfig>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSALF)
+{
+    typedef typename DefaultIndexCreator<Index<TText, FMIndex<TSpec, TConfig> >, FibreSA>::Type  TAlgo;
+    return indexCreate(index, FibreSALF(), TAlgo());
+}
+
+template <typename TText, typename TSpec, typename TConfig, typename TAlgo>
+inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSA, TAlgo const & algo)
+{
+    return indexCreate(index, FibreSALF(), algo);
+}
+
 template <typename TText, typename TSpec, typename TConfig>
 inline bool indexCreate(Index<TText, FMIndex<TSpec, TConfig> > & index, FibreSA)
 {
@@ -545,6 +545,67 @@ _getBwtRank(LF<TText, TSpec, TConfig> const & lf, TPos pos, TValue val)
     return rank;
 }
 
+// ----------------------------------------------------------------------------
+// Function _getBwtRanks(pos)
+// ----------------------------------------------------------------------------
+// Computes lf(pos, c) of all characters c in one pass over the rank dictionary and returns the number of sentinels
+// before pos.
+
+template <typename TText, typename TSpec, typename TConfig, typename TPos, typename TRanks>
+inline typename Size<LF<TText, TSpec, TConfig> >::Type
+_getBwtRanks(LF<TText, TSpec, TConfig> const & lf, TPos pos, TRanks & ranks)
+{
+    typedef LF<TText, TSpec, TConfig> const                TLF;
+    typedef typename Value<TLF>::Type                      TValue;
+    typedef typename Size<TLF>::Type                       TSize;
+
+    static const unsigned SIGMA = ValueSize<TValue>::VALUE;
+
+    TSize sentinels = 0;
+
+    if (pos > 0)
+    {
+        getRanks(lf.bwt, pos - 1, ranks);
+        sentinels = _getSentinelsRank(lf, pos - 1);
+        ranks[ordValue(static_cast<TValue>(lf.sentinelSubstitute))] -= sentinels;
+    }
+    else
+    {
+        for (unsigned c = 0; c < SIGMA; ++c)
+            ranks[c] = 0;
+    }
+
+    for (unsigned c = 0; c < SIGMA; ++c)
+        ranks[c] += _getPrefixSum(lf, static_cast<TValue>(c));
+
+    return sentinels;
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefetchLF()
+// ----------------------------------------------------------------------------
+// Prefetches the rank blocks read by lf(pos, c) so that several LF-mappings can overlap their cache misses.
+
+template <typename TText, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchSentinelsRank(LF<TText, TSpec, TConfig> const & /* lf */, TPos /* pos */)
+{}
+
+template <typename TText, typename TSSetSpec, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchSentinelsRank(LF<StringSet<TText, TSSetSpec>, TSpec, TConfig> const & lf, TPos pos)
+{
+    _prefetchRank(lf.sentinels, pos);
+}
+
+template <typename TText, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchLF(LF<TText, TSpec, TConfig> const & lf, TPos pos)
+{
+    if (pos > 0)
+    {
+        _prefetchRank(lf.bwt, pos - 1);
+        _prefetchSentinelsRank(lf, pos - 1);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function _setSentinelSubstitute()
 // ----------------------------------------------------------------------------
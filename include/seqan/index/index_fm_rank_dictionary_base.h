@@ -366,6 +366,42 @@ createRankDictionary(LF<StringSet<TText, TSSetSpec>, TSpec, TConfig> & lf, TOthe
  */
 
 
+// ----------------------------------------------------------------------------
+// Function getRanks()
+// ----------------------------------------------------------------------------
+/*!
+ * @fn RankDictionary#getRanks
+ * @headerfile <seqan/index.h>
+ * @brief Returns the ranks of all characters up to a specified position.
+ *
+ * @signature void getRanks(dictionary, pos, ranks);
+ *
+ * @param[in] dictionary The dictionary.
+ * @param[in] pos The position (which is also included in the rank computation).
+ * @param[out] ranks A random access container with at least <tt>ValueSize&lt;TValue&gt;::VALUE</tt> entries.
+ *                   <tt>ranks[c]</tt> is set to <tt>getRank(dictionary, pos, c)</tt>.
+ *
+ * The @link Levels @endlink rank dictionary computes the ranks of all characters in one pass over the block, using
+ * SIMD instructions if available.
+ */
+
+template <typename TValue, typename TSpec, typename TPos, typename TRanks>
+inline void getRanks(RankDictionary<TValue, TSpec> const & dict, TPos const pos, TRanks & ranks)
+{
+    for (unsigned c = 0; c < ValueSize<TValue>::VALUE; ++c)
+        ranks[c] = getRank(dict, pos, static_cast<TValue>(c));
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+// Issues software prefetches for the memory touched by getRank(dict, pos).
+// Dictionaries without a specialization do not prefetch.
+
+template <typename TValue, typename TSpec, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, TSpec> const & /* dict */, TPos const /* pos */)
+{}
+
 // ----------------------------------------------------------------------------
 // Function getValue()
 // ----------------------------------------------------------------------------
@@ -95,6 +95,13 @@ struct RankDictionaryBitString_;
 template <typename TValue, typename TSpec>
 struct RankDictionaryBlockSize_;
 
+// ----------------------------------------------------------------------------
+// Metafunction RankDictionaryWordsPerBlock_
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+struct RankDictionaryWordsPerBlock_;
+
 // ----------------------------------------------------------------------------
 // Metafunction RankDictionaryTruncBitmaskSize_
 // ----------------------------------------------------------------------------
@@ -159,6 +166,34 @@ struct LevelsRDConfig : RDConfig<TSize, TFibre, LEVELS, WORDS_PER_BLOCK> {};
 template <typename TSize = size_t, typename TFibre = Alloc<>, unsigned LEVELS = 1, unsigned WORDS_PER_BLOCK = 0>
 struct LevelsPrefixRDConfig : RDConfig<TSize, TFibre, LEVELS, WORDS_PER_BLOCK> {};
 
+/*!
+ * @class InterleavedRDConfig
+ * @headerfile <seqan/index.h>
+ *
+ * @brief InterleavedRDConfig configures a @link Levels @endlink RankDictionary whose blocks occupy exactly one
+ *        cache line each.
+ *
+ * @signature template <typename TSize = size_t, typename TFibre = Alloc<>, unsigned LEVELS = 2>
+ *            struct InterleavedRDConfig<TSize, TFibre, LEVELS>;
+ *
+ * @tparam TSize  A data type that can store the length of the input text. Default: <tt>size_t</tt>
+ * @tparam TFibre A tag for specialization purposes of the underlying strings. Default: <tt>Alloc<></tt>
+ * @tparam LEVELS The number of levels (1, 2, or 3). Default: <tt>2</tt>
+ *
+ * The block counts and the bit-packed values of a block are stored side by side in a 64 byte entry that is
+ * aligned to a cache line. The number of words per block is chosen such that the entry is filled, e.g. for
+ * @link Dna @endlink and 2 levels four 32 bit counts and six 64 bit words (192 values) share one line.
+ * The upper levels are small enough to stay in cache, hence a rank query costs a single cache miss.
+ * With 64 bit sizes, alphabets with more than 14 characters require 3 levels such that the block counts are
+ * 16 bit wide.
+ */
+
+template <typename TSize = size_t, typename TFibre = Alloc<>, unsigned LEVELS = 2>
+struct InterleavedRDConfig : RDConfig<TSize, TFibre, LEVELS, 0>
+{
+    static constexpr unsigned CACHE_LINE_SIZE = 64;
+};
+
 // ----------------------------------------------------------------------------
 // Tag Levels
 // ----------------------------------------------------------------------------
@@ -215,6 +250,30 @@ struct RankDictionaryBlockSize_<bool, TPREFIXLEVELS>
     static constexpr TType VALUE = ValueSize<bool>::VALUE;
 };
 
+// ----------------------------------------------------------------------------
+// Metafunction RankDictionaryWordsPerBlock_
+// ----------------------------------------------------------------------------
+// The number of words per block requested by the configuration (0 stands for the alphabet size).
+
+template <typename TValue, typename TSpec, typename TConfig>
+struct RankDictionaryWordsPerBlock_<TValue, Levels<TSpec, TConfig> >
+{
+    static constexpr unsigned VALUE = TConfig::WORDS_PER_BLOCK;
+};
+
+// The interleaved configuration fills the remainder of the cache line with words.
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS>
+struct RankDictionaryWordsPerBlock_<TValue, Levels<TSpec, InterleavedRDConfig<TSize, TFibre, LEVELS> > >
+{
+    typedef InterleavedRDConfig<TSize, TFibre, LEVELS>                                          TConfig_;
+    typedef typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig_> >::Type               TBlock_;
+
+    static_assert(sizeof(TBlock_) + sizeof(uint64_t) <= TConfig_::CACHE_LINE_SIZE,
+                  "The block counts do not fit into a cache line. Use more levels for large alphabets.");
+
+    static constexpr unsigned VALUE = (TConfig_::CACHE_LINE_SIZE - sizeof(TBlock_)) / sizeof(uint64_t);
+};
+
 // ----------------------------------------------------------------------------
 // Metafunction RankDictionaryTruncBitmaskSize_
 // ----------------------------------------------------------------------------
@@ -359,6 +418,17 @@ struct Fibre<RankDictionary<TValue, Levels<TSpec, TConfig> >, FibreRanks>
     typedef String<TEntry_, TFibreSpec_>                            Type;
 };
 
+// Heap allocated interleaved entries must start at a cache line boundary.
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS>
+struct Fibre<RankDictionary<TValue, Levels<TSpec, InterleavedRDConfig<TSize, TFibre, LEVELS> > >, FibreRanks>
+{
+    typedef Levels<TSpec, InterleavedRDConfig<TSize, TFibre, LEVELS> >                      TLevels_;
+    typedef RankDictionaryEntry_<TValue, TLevels_>                                          TEntry_;
+    typedef typename If<IsSameType<TFibre, Alloc<> >, Alloc<OverAligned>, TFibre>::Type     TFibreSpec_;
+
+    typedef String<TEntry_, TFibreSpec_>                                                    Type;
+};
+
 template <typename TValue, typename TSpec, typename TConfig>
 struct Fibre<RankDictionary<TValue, Levels<TSpec, TConfig> >, FibreSuperBlocks>
 {
@@ -404,6 +474,21 @@ struct RankDictionaryEntry_<TValue, Levels<TSpec, TConfig> >
     typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig> >::Type    block;
 };
 
+// ----------------------------------------------------------------------------
+// Struct Interleaved Levels RankDictionaryEntry_
+// ----------------------------------------------------------------------------
+// Counts and values of a block share one cache line.
+
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS>
+struct alignas(InterleavedRDConfig<TSize, TFibre, LEVELS>::CACHE_LINE_SIZE)
+RankDictionaryEntry_<TValue, Levels<TSpec, InterleavedRDConfig<TSize, TFibre, LEVELS> > >
+{
+    typedef Levels<TSpec, InterleavedRDConfig<TSize, TFibre, LEVELS> >  TLevels_;
+
+    typename RankDictionaryBlock_<TValue, TLevels_>::Type               block;
+    typename RankDictionaryValues_<TValue, TLevels_>::Type              values;
+};
+
 // ----------------------------------------------------------------------------
 // Metafunction RankDictionaryBitMask_
 // ----------------------------------------------------------------------------
@@ -482,7 +567,7 @@ struct RankDictionary<TValue, Levels<TSpec, TConfig> >
     // ------------------------------------------------------------------------
 
     static constexpr unsigned _BITS_PER_VALUE   = BitsPerValue<TValue>::VALUE;
-    static constexpr unsigned _BITS_PER_BLOCK   = (TConfig::WORDS_PER_BLOCK == 0 ? BitsPerValue<typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig> >::Type>::VALUE : RankDictionaryWordSize_<TValue, Levels<TSpec, TConfig> >::VALUE * TConfig::WORDS_PER_BLOCK);
+    static constexpr unsigned _BITS_PER_BLOCK   = (RankDictionaryWordsPerBlock_<TValue, Levels<TSpec, TConfig> >::VALUE == 0 ? BitsPerValue<typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig> >::Type>::VALUE : RankDictionaryWordSize_<TValue, Levels<TSpec, TConfig> >::VALUE * RankDictionaryWordsPerBlock_<TValue, Levels<TSpec, TConfig> >::VALUE);
     static constexpr unsigned _BITS_PER_WORD    = Min<RankDictionaryWordSize_<TValue, Levels<TSpec, TConfig> >::VALUE, _BITS_PER_BLOCK>::VALUE;
     static constexpr unsigned _VALUES_PER_WORD  = _BITS_PER_WORD / _BITS_PER_VALUE;
     static constexpr unsigned _WORDS_PER_BLOCK  = _BITS_PER_BLOCK / _BITS_PER_WORD;
@@ -1128,6 +1213,80 @@ _getUltraBlockRank(RankDictionary<bool, TPREFIXLEVELS> const & dict,
     return _getUltraBlockRank(dict, ultrablock, pos, true);
 }
 
+// ----------------------------------------------------------------------------
+// Function _getWordRankBits()
+// ----------------------------------------------------------------------------
+// Returns a mask with one bit set per value in word[0..posInWord] that is counted by the rank of the character
+// encoded in charMask.  charMask is either a word or a SIMD vector of words, one character per lane.
+
+template <typename TValue, typename TSpec, typename TConfig, typename TMask, typename TWord, typename TPosInWord>
+inline TMask
+_getWordRankBits(RankDictionary<TValue, Levels<TSpec, TConfig> > const & /* dict */,
+                 TMask const & charMask,
+                 TWord const word,
+                 TPosInWord const posInWord)
+{
+    typedef RankDictionary<TValue, Levels<TSpec, TConfig> > TRankDictionary;
+
+    TMask mask = charMask ^ word;
+    // NOTE: actually it should be: mask & (mask >> 1) & (mask >> 2) & ... but this is shorter and equivalent
+    for (unsigned i = 1; i < TRankDictionary::_BITS_PER_VALUE; ++i)
+        mask &= mask >> 1;
+    return mask & TRankDictionary::_TRUNC_BITMASKS[posInWord];
+}
+
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB,
+          typename TMask, typename TWord, typename TPosInWord>
+inline typename std::enable_if_t<RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_WORD % RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_VALUE == 0, TMask>
+_getWordRankBits(RankDictionary<TValue, TPREFIXLEVELS> const &,
+                 TMask const & charMask,
+                 TWord const word,
+                 TPosInWord const posInWord)
+{
+    typedef RankDictionary<TValue, TPREFIXLEVELS> TRD;
+
+    TMask const erg1 = (charMask - (word & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord + 1)/2];
+    TMask const erg2 = (charMask - ((word >> TRD::_BITS_PER_VALUE) & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord/2) + 1];
+
+    return erg1 | (erg2 << 1);
+}
+
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB,
+          typename TMask, typename TWord, typename TPosInWord>
+inline typename std::enable_if_t<RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_WORD % RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_VALUE != 0, TMask>
+_getWordRankBits(RankDictionary<TValue, TPREFIXLEVELS> const &,
+                 TMask const & charMask,
+                 TWord const word,
+                 TPosInWord const posInWord)
+{
+    typedef RankDictionary<TValue, TPREFIXLEVELS>    TRD;
+
+    TMask const erg1 = (charMask - (word & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord/2) + 1];
+    TMask const erg2 = (charMask - ((word << TRD::_BITS_PER_VALUE) & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord + 1)/2];
+
+    return erg1 | (erg2 >> 1);
+}
+
+#if defined(SEQAN_SEQANSIMD_ENABLED)
+// ----------------------------------------------------------------------------
+// Function _popCountLanes()
+// ----------------------------------------------------------------------------
+// Population count of every 64 bit lane.  SSE4 and AVX2 lack a vector popcount instruction.
+
+template <typename TSimdVector>
+inline TSimdVector
+_popCountLanes(TSimdVector x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    x = x + (x >> 8);
+    x = x + (x >> 16);
+    x = x + (x >> 32);
+    return x & 0x7full;
+}
+#endif  // defined(SEQAN_SEQANSIMD_ENABLED)
+
 // ----------------------------------------------------------------------------
 // Function _getWordRank()
 // ----------------------------------------------------------------------------
@@ -1141,53 +1300,27 @@ _getWordRank(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict, TWord
 
 template <typename TValue, typename TSpec, typename TConfig, typename TWord, typename TPosInWord>
 inline typename Size<RankDictionary<TValue, Levels<TSpec, TConfig> > const>::Type
-_getWordRank(RankDictionary<TValue, Levels<TSpec, TConfig> > const & /* dict */,
+_getWordRank(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict,
              TWord const & word,
              TPosInWord const posInWord,
              TValue const c)
 {
     typedef RankDictionary<TValue, Levels<TSpec, TConfig> > TRankDictionary;
 
-    TWord mask = word ^ TRankDictionary::_CHAR_BITMASKS[ordValue(c)];
-    // NOTE: actually it should be: mask & (mask >> 1) & (mask >> 2) & ... but this is shorter and equivalent
-    for (TWord i = 1; i < TRankDictionary::_BITS_PER_VALUE; ++i)
-        mask &= mask >> 1;
-    return popCount(TRankDictionary::_TRUNC_BITMASKS[posInWord] & mask);
+    return popCount(_getWordRankBits(dict, TRankDictionary::_CHAR_BITMASKS[ordValue(c)], word, posInWord));
 }
 
 template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB,
           typename TWord, typename TPosInWord>
-inline typename std::enable_if_t<RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_WORD % RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_VALUE == 0, typename Size<RankDictionary<TValue, TPREFIXLEVELS> const>::Type>
-_getWordRank(RankDictionary<TValue, TPREFIXLEVELS> const &,
+inline typename Size<RankDictionary<TValue, TPREFIXLEVELS> const>::Type
+_getWordRank(RankDictionary<TValue, TPREFIXLEVELS> const & dict,
              TWord const & word,
              TPosInWord const posInWord,
              TValue const c)
 {
     typedef RankDictionary<TValue, TPREFIXLEVELS> TRD;
 
-    TWord const erg1 = (TRD::_CHAR_BITMASKS[ordValue(c)] - (word & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord + 1)/2];
-    TWord const erg2 = (TRD::_CHAR_BITMASKS[ordValue(c)] - ((word >> TRD::_BITS_PER_VALUE) & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord/2) + 1];
-
-    return popCount(erg1 | (erg2 << 1));
-}
-
-template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB,
-          typename TWord, typename TPosInWord>
-inline
-typename std::enable_if_t<RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_WORD % RankDictionary<TValue, TPREFIXLEVELS>::_BITS_PER_VALUE != 0, typename Size<RankDictionary<TValue, TPREFIXLEVELS> const>::Type>
-_getWordRank(RankDictionary<TValue, TPREFIXLEVELS> const &,
-             TWord const & word,
-             TPosInWord const posInWord,
-             TValue const c)
-{
-    typedef RankDictionary<TValue, TPREFIXLEVELS>    TRD;
-
-    TWord erg1 = (TRD::_CHAR_BITMASKS[ordValue(c)]
-                  - (word & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord/2) + 1];
-    TWord erg2 = (TRD::_CHAR_BITMASKS[ordValue(c)]
-                  - ((word << TRD::_BITS_PER_VALUE) & TRD::_SELECT_BITMASK)) & TRD::_TRUNC_BITMASKS[(posInWord + 1)/2];
-
-    return popCount(erg1 | (erg2 >> 1));
+    return popCount(_getWordRankBits(dict, TRD::_CHAR_BITMASKS[ordValue(c)], word, posInWord));
 }
 
 // TODO(cpockrandt): rename functions with smaller value (cause they return a different value than their counterparts)
@@ -1294,6 +1427,58 @@ _getValueRank(RankDictionary<TValue, TPREFIXLEVELS> const & dict,
     return valueRank;
 }
 
+// ----------------------------------------------------------------------------
+// Function _getValueRanks()
+// ----------------------------------------------------------------------------
+// Computes _getValueRank() of all characters in one pass over the block.  With SIMD enabled every vector lane counts
+// one character.
+
+template <typename TValue, typename TSpec, typename TConfig, typename TValues, typename TPosInBlock, typename TRanks>
+inline void
+_getValueRanks(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict,
+               TValues const & values,
+               TPosInBlock const posInBlock,
+               TRanks & ranks)
+{
+    typedef RankDictionary<TValue, Levels<TSpec, TConfig> > TRankDictionary;
+    typedef typename Size<TRankDictionary>::Type            TSize;
+
+    static constexpr unsigned BLOCK_SIZE = RankDictionaryBlockSize_<TValue, Levels<TSpec, TConfig> >::VALUE;
+
+    TSize wordPos    = _toWordPos(dict, posInBlock);
+    TSize posInWord  = _toPosInWord(dict, posInBlock);
+
+#if defined(SEQAN_SEQANSIMD_ENABLED)
+    typedef typename SimdVector<uint64_t>::Type             TSimdVector;
+
+    for (unsigned c = 0; c < BLOCK_SIZE; c += LENGTH<TSimdVector>::VALUE)
+    {
+        TSimdVector charMasks = createVector<TSimdVector>(0);
+        for (unsigned lane = 0; lane < LENGTH<TSimdVector>::VALUE && c + lane < BLOCK_SIZE; ++lane)
+            assignValue(charMasks, lane, TRankDictionary::_CHAR_BITMASKS[c + lane]);
+
+        TSimdVector counts = createVector<TSimdVector>(0);
+        for (TSize wordPrevPos = 0; wordPrevPos < TRankDictionary::_WORDS_PER_BLOCK; ++wordPrevPos)
+            if (wordPrevPos < wordPos)
+                counts = counts + _popCountLanes(_getWordRankBits(dict, charMasks, values[wordPrevPos].i,
+                                                                  TRankDictionary::_VALUES_PER_WORD - 1));
+        counts = counts + _popCountLanes(_getWordRankBits(dict, charMasks, values[wordPos].i, posInWord));
+
+        for (unsigned lane = 0; lane < LENGTH<TSimdVector>::VALUE && c + lane < BLOCK_SIZE; ++lane)
+            ranks[c + lane] = counts[lane];
+    }
+#else
+    for (unsigned c = 0; c < BLOCK_SIZE; ++c)
+    {
+        TSize valueRank = 0;
+        for (TSize wordPrevPos = 0; wordPrevPos < TRankDictionary::_WORDS_PER_BLOCK; ++wordPrevPos)
+            if (wordPrevPos < wordPos)
+                valueRank += _getWordRank(dict, values[wordPrevPos].i, static_cast<TValue>(c));
+        ranks[c] = valueRank + _getWordRank(dict, values[wordPos].i, posInWord, static_cast<TValue>(c));
+    }
+#endif
+}
+
 // ----------------------------------------------------------------------------
 // Function _getValuesRanks()
 // ----------------------------------------------------------------------------
@@ -1305,12 +1490,14 @@ inline typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig> >::Type
 _getValuesRanks(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict, TPos const pos)
 {
     typedef typename RankDictionaryBlock_<TValue, Levels<TSpec, TConfig> >::Type    TBlock;
-    typedef typename ValueSize<TValue>::Type                                        TValueSize;
+    typedef typename Size<RankDictionary<TValue, Levels<TSpec, TConfig> > >::Type   TSize;
 
     TBlock blockRank;
+    TSize ranks[RankDictionaryBlockSize_<TValue, Levels<TSpec, TConfig> >::VALUE];
 
-    for (TValueSize c = 0; c < ValueSize<TValue>::VALUE; ++c)
-        assignValue(blockRank, c, _getValueRank(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), TValue(c)));
+    _getValueRanks(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), ranks);
+    for (unsigned c = 0; c < RankDictionaryBlockSize_<TValue, Levels<TSpec, TConfig> >::VALUE; ++c)
+        assignValue(blockRank, c, ranks[c]);
 
     return blockRank;
 }
@@ -1322,18 +1509,14 @@ _getValuesRanks(RankDictionary<TValue, TPREFIXLEVELS> const & dict,
                 TPos const pos)
 {
     typedef typename RankDictionaryBlock_<TValue, TPREFIXLEVELS>::Type    TBlock;
-    typedef typename ValueSize<TValue>::Type                                        TValueSize;
 
+    // The prefix sum blocks store the number of values less or equal to each character.
     TBlock blockRank;
-    TPos rank = _getValueRank(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), TValue(0));
-    assignValue(blockRank, 0, rank);
+    TSize ranks[RankDictionaryBlockSize_<TValue, TPREFIXLEVELS>::VALUE];
 
-    for (TValueSize c = 1; c < RankDictionaryBlockSize_<TValue, TPREFIXLEVELS>::VALUE; ++c)
-    {
-        TPos smaller = 0;
-        rank = _getValueRank(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), TValue(c), smaller);
-        assignValue(blockRank, c, rank + smaller);
-    }
+    _getValueRanks(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), ranks);
+    for (unsigned c = 0; c < RankDictionaryBlockSize_<TValue, TPREFIXLEVELS>::VALUE; ++c)
+        assignValue(blockRank, c, ranks[c]);
 
     return blockRank;
 }
@@ -1439,6 +1622,16 @@ inline TSize getRank(RankDictionary<TValue, Levels<TSpec, LevelsRDConfig<TSize,
     return getRank(dict, pos, static_cast<TValue>(c));
 }
 
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS,
+          typename TPos, typename TChar>
+inline TSize getRank(RankDictionary<TValue, Levels<TSpec, InterleavedRDConfig<TSize, TFibre, LEVELS> > > const & dict,
+                     TPos const pos,
+                     TChar const c,
+                     TPos & /*smaller*/)
+{
+    return getRank(dict, pos, static_cast<TValue>(c));
+}
+
 template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB,
           typename TPos, typename TChar>
 inline typename std::enable_if_t<LEVELS == 3, TSize>
@@ -1563,6 +1756,89 @@ getRank(RankDictionary<bool, Levels<TSpec, TConfig> > const & dict, TPos const p
     return getRank(dict, pos, true);
 }
 
+// ----------------------------------------------------------------------------
+// Function getRanks()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos, typename TRanks>
+inline void
+_getRanks(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict, TPos const pos, TRanks & ranks)
+{
+    typedef RankDictionary<TValue, Levels<TSpec, TConfig> > const   TRankDictionary;
+    typedef typename Size<TRankDictionary>::Type                    TSize;
+
+    static constexpr unsigned BLOCK_SIZE = RankDictionaryBlockSize_<TValue, Levels<TSpec, TConfig> >::VALUE;
+
+    TSize blockRanks[BLOCK_SIZE];
+    _getValueRanks(dict, _valuesAt(dict, pos), _toPosInBlock(dict, pos), blockRanks);
+
+    for (unsigned c = 0; c < BLOCK_SIZE; ++c)
+    {
+        TSize rank = blockRanks[c] + _blockAt(dict, pos)[c];
+        if (TConfig::LEVELS > 1)
+            rank += _superBlockAt(dict, pos)[c];
+        if (TConfig::LEVELS > 2)
+            rank += _ultraBlockAt(dict, pos)[c];
+        ranks[c] = rank;
+    }
+}
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos, typename TRanks>
+inline void
+getRanks(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict, TPos const pos, TRanks & ranks)
+{
+    _getRanks(dict, pos, ranks);
+}
+
+template <typename TValue, typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB,
+          typename TPos, typename TRanks>
+inline void
+getRanks(RankDictionary<TValue, TPREFIXLEVELS> const & dict, TPos const pos, TRanks & ranks)
+{
+    static constexpr unsigned BLOCK_SIZE = RankDictionaryBlockSize_<TValue, TPREFIXLEVELS>::VALUE;
+
+    // Turn the prefix sums into ranks, the last character is not stored.
+    _getRanks(dict, pos, ranks);
+    ranks[BLOCK_SIZE] = pos + 1 - ranks[BLOCK_SIZE - 1];
+    for (unsigned c = BLOCK_SIZE - 1; c > 0; --c)
+        ranks[c] -= ranks[c - 1];
+}
+
+template <typename TSpec, typename TConfig, typename TPos, typename TRanks>
+inline void
+getRanks(RankDictionary<bool, Levels<TSpec, TConfig> > const & dict, TPos const pos, TRanks & ranks)
+{
+    ranks[1] = getRank(dict, pos);
+    ranks[0] = pos + 1 - ranks[1];
+}
+
+template <typename TSpec, typename TSize, typename TFibre, unsigned LEVELS, unsigned WPB, typename TPos, typename TRanks>
+inline void
+getRanks(RankDictionary<bool, TPREFIXLEVELS> const & dict, TPos const pos, TRanks & ranks)
+{
+    ranks[1] = getRank(dict, pos);
+    ranks[0] = pos + 1 - ranks[1];
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, Levels<TSpec, TConfig> > const & dict, TPos const pos)
+{
+    // A block entry can straddle two cache lines.
+    char const * entry = reinterpret_cast<char const *>(&*(begin(dict.blocks, Standard()) + _toBlockPos(dict, pos)));
+    SEQAN_PREFETCH(entry);
+    SEQAN_PREFETCH(entry + sizeof(typename Value<typename Fibre<RankDictionary<TValue, Levels<TSpec, TConfig> >,
+                                                                FibreRanks>::Type>::Type) - 1);
+
+    if (TConfig::LEVELS > 1)
+        SEQAN_PREFETCH(&*(begin(dict.superblocks, Standard()) + _toSuperBlockPos(dict, pos)));
+    if (TConfig::LEVELS > 2)
+        SEQAN_PREFETCH(&*(begin(dict.ultrablocks, Standard()) + _toUltraBlockPos(dict, pos)));
+}
+
 // ----------------------------------------------------------------------------
 // Function getValue()
 // ----------------------------------------------------------------------------
@@ -401,6 +401,18 @@ _getRankAndValue(RankDictionary<TValue, WaveletTree<TSpec, TConfig> > const & di
     return pos + 1;
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchRank()
+// ----------------------------------------------------------------------------
+// Only the root level is known before the rank query descends the tree.
+
+template <typename TValue, typename TSpec, typename TConfig, typename TPos>
+inline void _prefetchRank(RankDictionary<TValue, WaveletTree<TSpec, TConfig> > const & dict, TPos pos)
+{
+    if (!empty(dict.ranks))
+        _prefetchRank(dict.ranks[0], pos);
+}
+
 // ----------------------------------------------------------------------------
 // Function _fillStructure()
 // ----------------------------------------------------------------------------
@@ -328,6 +328,14 @@ template <typename TText, typename TOccSpec, typename TSpec, typename TIndexSpec
 inline bool
 _goDown(Iter<Index<TText, FMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
         VSTreeIteratorTraits<TDfsOrder, True> const)
+{
+    return _goDown(it, typename Eval<isWaveletTree<typename TIndexSpec::Bwt>::Value>::Type());
+}
+
+// Wavelet trees compute the rank of one character at a time.
+template <typename TText, typename TOccSpec, typename TSpec, typename TIndexSpec>
+inline bool
+_goDown(Iter<Index<TText, FMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it, True)
 {
     typedef Index<TText, FMIndex<TOccSpec, TIndexSpec> >    TIndex;
     typedef typename Value<TIndex>::Type                    TAlphabet;
@@ -344,6 +352,56 @@ _goDown(Iter<Index<TText, FMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec>
     return false;
 }
 
+// Other rank dictionaries compute the LF-mappings of all characters at both ends of the range at once.
+template <typename TText, typename TOccSpec, typename TSpec, typename TIndexSpec>
+inline bool
+_goDown(Iter<Index<TText, FMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it, False)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TIndexSpec> >    TIndex;
+    typedef typename Value<TIndex>::Type                    TAlphabet;
+    typedef typename Size<TIndex>::Type                     TSize;
+    typedef Pair<TSize>                                     TRange;
+    typedef typename Fibre<TIndex, FibreLF>::Type           TLF;
+
+    static const unsigned SIGMA = ValueSize<TAlphabet>::VALUE;
+
+    if (isLeaf(it)) return false;
+
+    TLF const & lf = indexLF(container(it));
+    TRange _range = range(container(it), value(it));
+
+    TSize lo[SIGMA];
+    TSize hi[SIGMA];
+    TSize sentinels = _getBwtRanks(lf, _range.i2, hi) - _getBwtRanks(lf, _range.i1, lo);
+
+    // Sentinels are smaller than all characters, except for prefix sum rank dictionaries that sort them right before
+    // the sentinel substitute (see _getCumulativeBwtRank()).
+    bool const sentinelsFirst = !isLevelsPrefixRD<typename TIndexSpec::Bwt>::VALUE;
+    TSize smaller = sentinelsFirst ? sentinels : 0;
+
+    for (unsigned c = 0; c < SIGMA; ++c)
+    {
+        if (!sentinelsFirst && ordEqual(lf.sentinelSubstitute, static_cast<TAlphabet>(c)))
+            smaller += sentinels;
+
+        if (lo[c] < hi[c])
+        {
+            _historyPush(it);
+
+            value(it).range.i1 = lo[c];
+            value(it).range.i2 = hi[c];
+            value(it).smaller = smaller;
+            value(it).lastChar = static_cast<TAlphabet>(c);
+            value(it).repLen++;
+
+            return true;
+        }
+        smaller += hi[c] - lo[c];
+    }
+
+    return false;
+}
+
 // ----------------------------------------------------------------------------
 // Function _goDownString()                                          [Iterator]
 // ----------------------------------------------------------------------------
@@ -0,0 +1,555 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// LCP table construction with the Phi algorithm of Kaerkkaeinen, Manzini and
+// Puglisi ("Permuted longest-common-prefix array", CPM 2009).
+//
+// KarkkainenPhi works in memory.  The text positions are processed in blocks
+// so that the Phi and permuted LCP arrays stay within a workspace limit.  The
+// text, the suffix array and the LCP table are not part of that limit.
+//
+// SemiExternalPhi keeps only the text in memory.  The suffix array entries
+// are permuted into text order and the LCP values back into suffix array
+// order with external mapper pools.  Its memory limit covers every array that
+// resides in memory.
+// ==========================================================================
+
+#ifndef SEQAN_INDEX_INDEX_LCP_PHI_H_
+#define SEQAN_INDEX_INDEX_LCP_PHI_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @class KarkkainenPhi
+ * @headerfile <seqan/index.h>
+ * @brief Parallel in-memory LCP table construction with the Phi algorithm.
+ *
+ * @signature struct KarkkainenPhi;
+ *
+ * Computes the permuted LCP array in text order with the Phi algorithm using all OpenMP threads and permutes it into
+ * the LCP table.  Use it with <tt>indexCreate(index, FibreLcp(), KarkkainenPhi(workspaceLimit))</tt>.
+ *
+ * This is not an external-memory construction, see @link SemiExternalPhi @endlink for one.  The text is accessed
+ * randomly and must be held in memory.  The suffix array and the LCP table are scanned sequentially.  They may be
+ * @link ExternalString External Strings @endlink, but then they are scanned by a single thread and their page caches
+ * are not covered by <tt>workspaceLimit</tt>.
+ *
+ * The algorithm needs <tt>(sizeof(SAValue) + sizeof(LcpValue))</tt> bytes of workspace per text position.  If this
+ * exceeds <tt>workspaceLimit</tt>, the text is processed in blocks and the suffix array and LCP table are scanned once
+ * per block.
+ */
+
+/*!
+ * @fn KarkkainenPhi::KarkkainenPhi
+ * @brief Constructor.
+ *
+ * @signature KarkkainenPhi::KarkkainenPhi([workspaceLimit]);
+ *
+ * @param[in] workspaceLimit Maximal number of bytes of the Phi and permuted LCP arrays.  The text, the suffix array
+ *                           and the LCP table are not included.  Default: 0 (unlimited).
+ */
+
+struct KarkkainenPhi
+{
+    uint64_t workspaceLimit;
+
+    KarkkainenPhi(uint64_t workspaceLimit = 0) :
+        workspaceLimit(workspaceLimit)
+    {}
+};
+
+/*!
+ * @class SemiExternalPhi
+ * @headerfile <seqan/index.h>
+ * @brief Parallel semi-external LCP table construction with the Phi algorithm.
+ *
+ * @signature struct SemiExternalPhi;
+ *
+ * Only the text is accessed randomly and held in memory.  The suffix array is scanned once and every suffix is sent
+ * with its rank and its successor in the suffix array through an external @link MapperSpec Mapper @endlink pool into
+ * text order.  The permuted LCP values are computed batch-wise by all OpenMP threads and sent with their ranks through
+ * a second mapper pool back into suffix array order, in which they are written to the LCP table.  Use it with
+ * <tt>indexCreate(index, FibreLcp(), SemiExternalPhi(memoryLimit))</tt> and @link ExternalString External Strings
+ * @endlink as suffix array and LCP table.
+ *
+ * <tt>memoryLimit</tt> covers all arrays that reside in memory during the construction: the text, the suffix array
+ * and the LCP table (only the page caches of External Strings), the buffers of both pools and the batch.  What
+ * remains after the text and the tables is split evenly between the two pools and the batch.  A pool whose entries
+ * fit into its share is kept in memory.  The pools need at least four pages of 16384 entries and a bucket per page
+ * and the batch at least 1024 entries, a smaller share is raised to that minimum.
+ */
+
+/*!
+ * @fn SemiExternalPhi::SemiExternalPhi
+ * @brief Constructor.
+ *
+ * @signature SemiExternalPhi::SemiExternalPhi([memoryLimit]);
+ *
+ * @param[in] memoryLimit Maximal number of bytes of all arrays in memory, including the text and the tables.
+ *                        Default: 1 GiB.
+ */
+
+struct SemiExternalPhi
+{
+    uint64_t memoryLimit;
+
+    SemiExternalPhi(uint64_t memoryLimit = 1ull << 30) :
+        memoryLimit(memoryLimit)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _phiScanSuffixArray()
+// ----------------------------------------------------------------------------
+
+// Stores the successor in the suffix array of every suffix in [blockBeg, blockEnd).
+
+template <typename TPhi, typename TSA, typename TLimits, typename TSize>
+inline void
+_phiScanSuffixArray(TPhi & phi, TSA const & sa, TLimits const & limits, TSize blockBeg, TSize blockEnd, True)
+{
+    typedef typename MakeSigned<TSize>::Type TSignedSize;
+
+    TSize const n = length(sa);
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize i = 0; i < static_cast<TSignedSize>(n - 1); ++i)
+    {
+        TSize pos = posGlobalize(sa[i], limits);
+        if (blockBeg <= pos && pos < blockEnd)
+            phi[pos - blockBeg] = sa[i + 1];
+    }
+}
+
+template <typename TPhi, typename TSA, typename TLimits, typename TSize>
+inline void
+_phiScanSuffixArray(TPhi & phi, TSA const & sa, TLimits const & limits, TSize blockBeg, TSize blockEnd, False)
+{
+    typedef typename Iterator<TSA const, Standard>::Type TSAIter;
+
+    TSAIter it = begin(sa, Standard());
+    TSAIter itEnd = end(sa, Standard());
+    TSize prev = posGlobalize(*it, limits);
+    for (++it; it != itEnd; ++it)
+    {
+        if (blockBeg <= prev && prev < blockEnd)
+            phi[prev - blockBeg] = *it;
+        prev = posGlobalize(*it, limits);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _phiPermuteLcp()
+// ----------------------------------------------------------------------------
+
+// Writes the permuted LCP values of the suffixes in [blockBeg, blockEnd) to the LCP table.
+
+template <typename TLCP, typename TPlcp, typename TSA, typename TLimits, typename TSize>
+inline void
+_phiPermuteLcp(TLCP & lcp, TPlcp const & plcp, TSA const & sa, TLimits const & limits,
+               TSize blockBeg, TSize blockEnd, True)
+{
+    typedef typename MakeSigned<TSize>::Type TSignedSize;
+
+    TSize const n = length(sa);
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize i = 0; i < static_cast<TSignedSize>(n); ++i)
+    {
+        TSize pos = posGlobalize(sa[i], limits);
+        if (blockBeg <= pos && pos < blockEnd)
+            lcp[i] = plcp[pos - blockBeg];
+    }
+}
+
+template <typename TLCP, typename TPlcp, typename TSA, typename TLimits, typename TSize>
+inline void
+_phiPermuteLcp(TLCP & lcp, TPlcp const & plcp, TSA const & sa, TLimits const & limits,
+               TSize blockBeg, TSize blockEnd, False)
+{
+    typedef typename Iterator<TSA const, Standard>::Type TSAIter;
+    typedef typename Iterator<TLCP, Standard>::Type      TLCPIter;
+
+    TSAIter it = begin(sa, Standard());
+    TSAIter itEnd = end(sa, Standard());
+    TLCPIter lcpIt = begin(lcp, Standard());
+    for (; it != itEnd; ++it, ++lcpIt)
+    {
+        TSize pos = posGlobalize(*it, limits);
+        if (blockBeg <= pos && pos < blockEnd)
+            *lcpIt = plcp[pos - blockBeg];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _phiComputePlcp()
+// ----------------------------------------------------------------------------
+
+// Computes lcp(i, phi(i)) for all text positions i in [blockBeg, blockEnd).  The range is split between the threads,
+// each of them starts without a known lower bound.
+
+template <typename TPlcp, typename TPhi, typename TText, typename TSize>
+inline void
+_phiComputePlcp(TPlcp & plcp, TPhi const & phi, TText const & text, TSize lastPos, TSize blockBeg, TSize blockEnd)
+{
+    typedef typename Value<TPhi>::Type          TSAValue;
+    typedef typename Value<TPlcp>::Type         TLcpValue;
+    typedef typename MakeSigned<TSize>::Type    TSignedSize;
+
+    Splitter<TSize> splitter(blockBeg, blockEnd, Parallel());
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        Pair<TSize> loc;
+        posLocalize(loc, splitter[job], stringSetLimits(text));
+        TSize seqNo = getValueI1(loc);
+        TSize seqOffset = getValueI2(loc);
+        TSize seqLen = sequenceLength(seqNo, text);
+        TSize h = 0;
+
+        for (TSize pos = splitter[job]; pos < splitter[job + 1]; ++pos, ++seqOffset)
+        {
+            while (seqOffset >= seqLen)
+            {   // Continue with the next non-empty sequence.
+                seqLen = sequenceLength(++seqNo, text);
+                seqOffset = 0;
+                h = 0;
+            }
+
+            if (pos == lastPos)
+            {   // The last suffix has no successor.
+                plcp[pos - blockBeg] = 0;
+                h = 0;
+                continue;
+            }
+
+            TSAValue succ = phi[pos - blockBeg];
+            auto const & seq = getSequenceByNo(seqNo, text);
+            auto const & succSeq = getSequenceByNo(getSeqNo(succ), text);
+            TSize hMax = _min(seqLen - seqOffset, static_cast<TSize>(length(succSeq) - getSeqOffset(succ)));
+            while (h < hMax && seq[seqOffset + h] == succSeq[getSeqOffset(succ) + h])
+                ++h;
+
+            plcp[pos - blockBeg] = static_cast<TLcpValue>(h);
+            if (h != 0)
+                --h;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function createLcpTable()
+// ----------------------------------------------------------------------------
+
+template <typename TLCP, typename TText, typename TSA>
+inline void
+createLcpTable(TLCP & lcp, TText const & text, TSA const & sa, KarkkainenPhi const & alg)
+{
+    typedef typename Value<TSA>::Type                               TSAValue;
+    typedef typename Value<TLCP>::Type                              TLcpValue;
+    typedef typename Size<TSA>::Type                                TSize;
+    typedef typename AllowsFastRandomAccess<TSA>::Type              TRandomSA;
+    typedef typename And<TRandomSA,
+                         typename AllowsFastRandomAccess<TLCP>::Type>::Type TRandomLCP;
+
+    TSize const n = length(sa);
+    if (n == 0)
+        return;
+
+    typename StringSetLimits<TText const>::Type const & limits = stringSetLimits(text);
+    TSize const lastPos = posGlobalize(back(sa), limits);
+
+    TSize blockSize = n;
+    if (alg.workspaceLimit != 0)
+        blockSize = _max(static_cast<TSize>(1),
+                         _min(n, static_cast<TSize>(alg.workspaceLimit / (sizeof(TSAValue) + sizeof(TLcpValue)))));
+
+    String<TSAValue> phi;
+    String<TLcpValue> plcp;
+    resize(phi, blockSize, Exact());
+    resize(plcp, blockSize, Exact());
+
+    for (TSize blockBeg = 0; blockBeg < n; blockBeg += blockSize)
+    {
+        TSize blockEnd = _min(n, blockBeg + blockSize);
+        _phiScanSuffixArray(phi, sa, limits, blockBeg, blockEnd, TRandomSA());
+        _phiComputePlcp(plcp, phi, text, lastPos, blockBeg, blockEnd);
+        _phiPermuteLcp(lcp, plcp, sa, limits, blockBeg, blockEnd, TRandomLCP());
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _semiExternalResidentBytes()
+// ----------------------------------------------------------------------------
+
+// Returns the number of bytes a string or string set occupies in memory.  Of External Strings only the page cache
+// resides in memory.
+
+template <typename TText>
+inline uint64_t
+_semiExternalResidentBytes(TText const & text)
+{
+    return static_cast<uint64_t>(length(text)) * sizeof(typename Value<TText>::Type);
+}
+
+template <typename TValue, typename TSpec>
+inline uint64_t
+_semiExternalResidentBytes(String<TValue, TSpec> const & str)
+{
+    return static_cast<uint64_t>(capacity(str)) * sizeof(TValue);
+}
+
+template <typename TValue, typename TSpec>
+inline uint64_t
+_semiExternalResidentBytes(String<TValue, Packed<TSpec> > const & str)
+{
+    return _semiExternalResidentBytes(host(str));
+}
+
+template <typename TValue, typename TConfig>
+inline uint64_t
+_semiExternalResidentBytes(String<TValue, External<TConfig> > const &)
+{
+    return static_cast<uint64_t>(TConfig::SEQAN_PAGESIZE) * TConfig::FRAMES * sizeof(TValue);
+}
+
+template <typename TString, typename TSpec>
+inline uint64_t
+_semiExternalResidentBytes(StringSet<TString, TSpec> const & set)
+{
+    uint64_t bytes = _semiExternalResidentBytes(stringSetLimits(set));
+    for (typename Size<StringSet<TString, TSpec> >::Type i = 0; i < length(set); ++i)
+        bytes += _semiExternalResidentBytes(set[i]);
+    return bytes;
+}
+
+template <typename TString>
+inline uint64_t
+_semiExternalResidentBytes(StringSet<TString, Owner<ConcatDirect<> > > const & set)
+{
+    return _semiExternalResidentBytes(stringSetLimits(set)) + _semiExternalResidentBytes(concat(set));
+}
+
+// ----------------------------------------------------------------------------
+// Function _semiExternalPoolParameters()
+// ----------------------------------------------------------------------------
+
+// Returns the parameters of a mapper pool with n entries of type TValue that uses at most the given number of bytes.
+// The pool is kept in memory if it fits, otherwise half of the bytes are used by the read-ahead pages and a quarter by
+// the buckets and the write-back clusters each.  The share is raised to four pages of 16k entries, the alignment of the
+// pool pages, and to the bucket buffer the mapper needs for one bucket per page.
+
+template <typename TValue, typename TSize>
+inline PoolParameters
+_semiExternalPoolParameters(uint64_t bytes, TSize n)
+{
+    uint64_t const PAGE_ALIGN = 16 * 1024;
+
+    uint64_t quarter = bytes / sizeof(TValue) / 4;
+    quarter = _max(quarter, PAGE_ALIGN);
+    quarter = _max(quarter, 2 * static_cast<uint64_t>(std::ceil(std::sqrt(static_cast<double>(n)))));
+
+    PoolParameters conf;
+    conf.absoluteSizes = false;
+    conf.memBufferSize = 4 * quarter;
+    conf.pageSize = quarter / PAGE_ALIGN * PAGE_ALIGN;
+    conf.bucketBufferSize = quarter;
+    conf.readAheadBuffers = 2;
+    conf.writeBackBuffers = 2;
+    conf.writeBackBuckets = 2;
+    return conf;
+}
+
+// ----------------------------------------------------------------------------
+// Function _semiExternalPhiBatch()
+// ----------------------------------------------------------------------------
+
+// Computes the permuted LCP values of the batch of consecutive text positions beginning at batchBeg.  The entries
+// are (position, rank, successor) triples in text order.  The batch is split between the threads, the first one
+// continues with the lower bound h of the previous batch and the last one returns it for the next batch.
+
+template <typename TLcpBatch, typename TBatch, typename TText, typename TSize>
+inline void
+_semiExternalPhiBatch(TLcpBatch & lcpBatch, TBatch const & batch, TText const & text, TSize n, TSize batchBeg,
+                      TSize batchSize, TSize & h)
+{
+    typedef typename Value<TLcpBatch>::Type     TLcpValue;
+    typedef typename MakeSigned<TSize>::Type    TSignedSize;
+
+    Splitter<TSize> splitter(0, batchSize, Parallel());
+    String<TSize> hEnd;
+    resize(hEnd, length(splitter), Exact());
+    TSize hBegin = h;
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < static_cast<TSignedSize>(length(splitter)); ++job)
+    {
+        TSize hJob = (job == 0) ? hBegin : 0;
+        hEnd[job] = 0;
+        if (splitter[job] == splitter[job + 1])
+            continue;
+
+        Pair<TSize> loc;
+        posLocalize(loc, batchBeg + splitter[job], stringSetLimits(text));
+        TSize seqNo = getValueI1(loc);
+        TSize seqOffset = getValueI2(loc);
+        TSize seqLen = sequenceLength(seqNo, text);
+
+        for (TSize i = splitter[job]; i < splitter[job + 1]; ++i, ++seqOffset)
+        {
+            while (seqOffset >= seqLen)
+            {   // Continue with the next non-empty sequence.
+                seqLen = sequenceLength(++seqNo, text);
+                seqOffset = 0;
+                hJob = 0;
+            }
+
+            if (batch[i].i2 == n - 1)
+            {   // The last suffix has no successor.
+                lcpBatch[i] = 0;
+                hJob = 0;
+                continue;
+            }
+
+            auto const & succ = batch[i].i3;
+            auto const & seq = getSequenceByNo(seqNo, text);
+            auto const & succSeq = getSequenceByNo(getSeqNo(succ), text);
+            TSize hMax = _min(seqLen - seqOffset, static_cast<TSize>(length(succSeq) - getSeqOffset(succ)));
+            while (hJob < hMax && seq[seqOffset + hJob] == succSeq[getSeqOffset(succ) + hJob])
+                ++hJob;
+
+            lcpBatch[i] = static_cast<TLcpValue>(hJob);
+            if (hJob != 0)
+                --hJob;
+        }
+        hEnd[job] = hJob;
+    }
+
+    h = back(hEnd);
+}
+
+// ----------------------------------------------------------------------------
+// Function createLcpTable()
+// ----------------------------------------------------------------------------
+
+template <typename TLCP, typename TText, typename TSA>
+inline void
+createLcpTable(TLCP & lcp, TText const & text, TSA const & sa, SemiExternalPhi const & alg)
+{
+    typedef typename Value<TSA>::Type                                               TSAValue;
+    typedef typename Value<TLCP>::Type                                              TLcpValue;
+    typedef typename Size<TSA>::Type                                                TSize;
+    typedef Triple<TSize, TSize, TSAValue>                                          TPhiEntry;
+    typedef Pair<TSize>                                                             TLcpEntry;
+    typedef Pool<TPhiEntry, MapperSpec<MapperConfigSize<filterI1<TPhiEntry>, TSize> > > TPhiPool;
+    typedef Pool<TLcpEntry, MapperSpec<MapperConfigSize<filterI1<TLcpEntry>, TSize> > > TLcpPool;
+    typedef typename Iterator<TSA const, Standard>::Type                            TSAIter;
+    typedef typename Iterator<TLCP, Standard>::Type                                 TLCPIter;
+
+    TSize const n = length(sa);
+    if (n == 0)
+        return;
+
+    // split what the text and the tables leave of the limit between the pools and the batch
+    uint64_t resident = _semiExternalResidentBytes(text) + _semiExternalResidentBytes(sa) +
+                        _semiExternalResidentBytes(lcp);
+    uint64_t share = (alg.memoryLimit > resident) ? (alg.memoryLimit - resident) / 3 : 0;
+    TSize batchSize = _max(static_cast<TSize>(1024),
+                           _min(n, static_cast<TSize>(share / (sizeof(TPhiEntry) + sizeof(TLcpValue)))));
+
+    typename StringSetLimits<TText const>::Type const & limits = stringSetLimits(text);
+
+    // send every suffix with its rank and successor into text order
+    TPhiPool phiPool(_semiExternalPoolParameters<TPhiEntry>(share, n));
+    resize(phiPool, n);
+    beginWrite(phiPool);
+    {
+        TSAIter it = begin(sa, Standard());
+        TPhiEntry entry(posGlobalize(*it, limits), 0, TSAValue());
+        for (++it; entry.i2 + 1 < n; ++it)
+        {
+            entry.i3 = *it;
+            push(phiPool, entry);
+            entry.i1 = posGlobalize(*it, limits);
+            ++entry.i2;
+        }
+        entry.i3 = TSAValue();
+        push(phiPool, entry);
+    }
+    endWrite(phiPool);
+
+    // compute the permuted LCP values batch-wise and send them into suffix array order
+    TLcpPool lcpPool(_semiExternalPoolParameters<TLcpEntry>(share, n));
+    resize(lcpPool, n);
+    beginWrite(lcpPool);
+    beginRead(phiPool);
+    {
+        String<TPhiEntry> batch;
+        String<TLcpValue> lcpBatch;
+        resize(batch, batchSize, Exact());
+        resize(lcpBatch, batchSize, Exact());
+
+        TSize h = 0;
+        for (TSize batchBeg = 0; batchBeg < n; batchBeg += batchSize)
+        {
+            TSize size = _min(batchSize, n - batchBeg);
+            for (TSize i = 0; i < size; ++i, ++phiPool)
+                batch[i] = *phiPool;
+
+            _semiExternalPhiBatch(lcpBatch, batch, text, n, batchBeg, size, h);
+
+            for (TSize i = 0; i < size; ++i)
+                push(lcpPool, TLcpEntry(batch[i].i2, lcpBatch[i]));
+        }
+    }
+    endRead(phiPool);
+    clear(phiPool);
+    endWrite(lcpPool);
+
+    // write the LCP table sequentially
+    beginRead(lcpPool);
+    TLCPIter lcpIt = begin(lcp, Standard());
+    for (TSize i = 0; i < n; ++i, ++lcpIt, ++lcpPool)
+        *lcpIt = static_cast<TLcpValue>((*lcpPool).i2);
+    endRead(lcpPool);
+}
+
+}  // namespace seqan2
+
+#endif  // SEQAN_INDEX_INDEX_LCP_PHI_H_
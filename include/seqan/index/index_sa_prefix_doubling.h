@@ -0,0 +1,446 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Parallel suffix array construction by prefix doubling.
+//
+// The suffixes are first distributed into buckets by their first q
+// characters with a parallel counting sort.  Afterwards every round sorts
+// the groups of suffixes that share their first h characters by the rank
+// of their (h+1)-th suffix and refines the groups, doubling h (Manber and
+// Myers, 1993; Larsson and Sadakane, 2007).  Groups are sorted
+// independently by all threads.
+//
+// Besides the text and the suffix array, the working set consists of one
+// rank per text position (32 bits if the text length plus the number of
+// sequences fits, 64 bits otherwise), two bit vectors marking the group
+// ends (2 bits per position) and one bucket counter table of at most
+// 2^18 entries per thread.  For a single 32-bit text this amounts to
+// 4.25 bytes per position on top of the suffix array.
+// ==========================================================================
+
+#ifndef SEQAN_INDEX_INDEX_SA_PREFIX_DOUBLING_H_
+#define SEQAN_INDEX_INDEX_SA_PREFIX_DOUBLING_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @tag IndexCreatorTags#ParallelPrefixDoubling
+ * @headerfile <seqan/index.h>
+ * @brief Parallel suffix array construction by prefix doubling.
+ *
+ * @signature struct ParallelPrefixDoubling;
+ *
+ * Builds the suffix array of a string or a @link StringSet @endlink in memory using <tt>omp_get_max_threads()</tt>
+ * threads.  Select it explicitly with <tt>indexCreate(index, FibreSA(), ParallelPrefixDoubling())</tt>, the default
+ * creator remains @link Skew7 @endlink.  For the @link FMIndex @endlink, this also keeps the temporary suffix array
+ * in memory instead of on disk.  Texts over alphabets with more than 16 bits per character are sorted by @link Skew7
+ * @endlink instead.
+ *
+ * Besides the suffix array, the algorithm needs one rank per text position (32 bits for texts shorter than 2^32
+ * characters) and two bits per position.
+ */
+
+struct ParallelPrefixDoubling {};
+
+// Sort groups with more suffixes than this in parallel instead of assigning them to a single thread.
+template <typename T = void>
+struct PrefixDoublingConfig_
+{
+    static const unsigned MAX_BUCKETS = 1u << 18;
+    static const unsigned MIN_PARALLEL_GROUP = 1u << 16;
+};
+
+// ----------------------------------------------------------------------------
+// Functor PrefixDoublingLess_
+// ----------------------------------------------------------------------------
+
+// Compares two suffixes of a group by the rank of their suffixes h characters further.  Suffixes that end before
+// are smaller, equal suffixes of different sequences are ordered by decreasing sequence number, like in Skew7.
+template <typename TSAValue, typename TText, typename TRanks>
+struct PrefixDoublingLess_
+{
+    typedef typename StringSetLimits<TText const>::Type TLimits;
+    typedef typename Value<TRanks>::Type                TRank;
+    typedef typename Size<TText>::Type                  TSize;
+
+    TText const &   text;
+    TLimits const & limits;
+    TRanks const &  ranks;
+    TSize           h;
+    TRank           numSeqs;
+
+    PrefixDoublingLess_(TText const & text, TLimits const & limits, TRanks const & ranks, TSize h, TRank numSeqs) :
+        text(text), limits(limits), ranks(ranks), h(h), numSeqs(numSeqs)
+    {}
+
+    inline TRank key(TSAValue const & pos) const
+    {
+        if (getSeqOffset(pos) + h < sequenceLength(getSeqNo(pos), text))
+            return ranks[posGlobalize(pos, limits) + h] + numSeqs;
+        return numSeqs - 1 - getSeqNo(pos);
+    }
+
+    inline bool operator() (TSAValue const & a, TSAValue const & b) const
+    {
+        return key(a) < key(b);
+    }
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _prefixDoublingAssignPos()
+// ----------------------------------------------------------------------------
+
+template <typename TSAValue, typename TSeqNo, typename TSeqOffset>
+inline void
+_prefixDoublingAssignPos(TSAValue & pos, TSeqNo /*seqNo*/, TSeqOffset seqOffset)
+{
+    pos = seqOffset;
+}
+
+template <typename T1, typename T2, typename TPack, typename TSeqNo, typename TSeqOffset>
+inline void
+_prefixDoublingAssignPos(Pair<T1, T2, TPack> & pos, TSeqNo seqNo, TSeqOffset seqOffset)
+{
+    assignValueI1(pos, seqNo);
+    assignValueI2(pos, seqOffset);
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefixDoublingLocalize()
+// ----------------------------------------------------------------------------
+
+template <typename TSize>
+inline void
+_prefixDoublingLocalize(TSize & seqNo, TSize & seqOffset, TSize pos, Nothing const &)
+{
+    seqNo = 0;
+    seqOffset = pos;
+}
+
+template <typename TSize, typename TLimits>
+inline void
+_prefixDoublingLocalize(TSize & seqNo, TSize & seqOffset, TSize pos, TLimits const & limits)
+{
+    typedef typename Iterator<TLimits const, Standard>::Type TIter;
+    TIter it = std::upper_bound(begin(limits, Standard()), end(limits, Standard()), pos) - 1;
+    seqNo = it - begin(limits, Standard());
+    seqOffset = pos - *it;
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefixDoublingNextEnd()
+// ----------------------------------------------------------------------------
+
+// Returns the position of the first group end at or after pos.
+template <typename TBits, typename TSize>
+inline TSize
+_prefixDoublingNextEnd(TBits const & bits, TSize pos)
+{
+    TSize w = pos / 64;
+    uint64_t word = bits[w] & (~static_cast<uint64_t>(0) << (pos % 64));
+    while (word == 0)
+        word = bits[++w];
+    return w * 64 + bitScanForward(word);
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefixDoublingBuckets()
+// ----------------------------------------------------------------------------
+
+// Distributes the suffixes into buckets by their first q characters, sets the rank of every suffix to the end of
+// its bucket and marks the bucket ends.
+template <typename TSA, typename TText, typename TRanks, typename TBits>
+inline void
+_prefixDoublingBuckets(TSA & sa, TText const & text, TRanks & ranks, TBits & bits, unsigned q, uint64_t sigma)
+{
+    typedef typename Size<TSA>::Type                    TSize;
+    typedef typename MakeSigned<TSize>::Type            TSignedSize;
+    typedef typename Value<TRanks>::Type                TRank;
+    typedef typename StringSetLimits<TText const>::Type TLimits;
+
+    TLimits const & limits = stringSetLimits(text);
+    TSize const n = length(sa);
+
+    uint64_t numBuckets = 1;
+    for (unsigned i = 0; i < q; ++i)
+        numBuckets *= sigma;
+    uint64_t const highDigit = numBuckets / sigma;
+
+    Splitter<TSize> splitter(0, n, Parallel());
+    TSignedSize const numJobs = length(splitter);
+    String<TSize> counts;
+    resize(counts, numJobs * numBuckets, 0, Exact());
+
+    // Calls f(pos, code) for every suffix in [beg, end) with the code of its first q characters, characters beyond
+    // the end of a sequence are 0.
+    auto forEachCode = [&] (TSize beg, TSize end, auto && f)
+    {
+        TSize seqNo, seqOffset;
+        _prefixDoublingLocalize(seqNo, seqOffset, beg, limits);
+        for (TSize pos = beg; pos < end; ++seqNo, seqOffset = 0)
+        {
+            auto const & seq = getSequenceByNo(seqNo, text);
+            TSize const seqLen = length(seq);
+            uint64_t code = 0;
+            for (unsigned i = 0; i < q; ++i)
+                code = code * sigma + ((seqOffset + i < seqLen) ? ordValue(seq[seqOffset + i]) + 1 : 0);
+
+            for (; seqOffset < seqLen && pos < end; ++seqOffset, ++pos)
+            {
+                f(seqNo, seqOffset, pos, code);
+                code = (code % highDigit) * sigma +
+                       ((seqOffset + q < seqLen) ? ordValue(seq[seqOffset + q]) + 1 : 0);
+            }
+        }
+    };
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < numJobs; ++job)
+    {
+        TSize * jobCounts = &counts[job * numBuckets];
+        forEachCode(splitter[job], splitter[job + 1], [&] (TSize, TSize, TSize, uint64_t code)
+        {
+            ++jobCounts[code];
+        });
+    }
+
+    // Turn the counts into the first positions of each job in each bucket.
+    String<TSize> bucketEnds;
+    resize(bucketEnds, numBuckets, Exact());
+    TSize sum = 0;
+    for (uint64_t bucket = 0; bucket < numBuckets; ++bucket)
+    {
+        for (TSignedSize job = 0; job < numJobs; ++job)
+        {
+            TSize count = counts[job * numBuckets + bucket];
+            counts[job * numBuckets + bucket] = sum;
+            sum += count;
+        }
+        bucketEnds[bucket] = sum;
+        if (sum != 0 && (bucket == 0 || bucketEnds[bucket - 1] != sum))
+            bits[(sum - 1) / 64] |= static_cast<uint64_t>(1) << ((sum - 1) % 64);
+    }
+
+    SEQAN_OMP_PRAGMA(parallel for)
+    for (TSignedSize job = 0; job < numJobs; ++job)
+    {
+        TSize * jobPos = &counts[job * numBuckets];
+        forEachCode(splitter[job], splitter[job + 1], [&] (TSize seqNo, TSize seqOffset, TSize pos, uint64_t code)
+        {
+            _prefixDoublingAssignPos(sa[jobPos[code]++], seqNo, seqOffset);
+            ranks[pos] = static_cast<TRank>(bucketEnds[code] - 1);
+        });
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _createSuffixArrayPrefixDoubling()
+// ----------------------------------------------------------------------------
+
+template <typename TSA, typename TText, typename TRank>
+inline void
+_createSuffixArrayPrefixDoubling(TSA & sa, TText const & text, TRank)
+{
+    typedef typename Value<TSA>::Type                           TSAValue;
+    typedef typename Size<TSA>::Type                            TSize;
+    typedef typename MakeSigned<TSize>::Type                    TSignedSize;
+    typedef typename Value<typename Concatenator<TText>::Type>::Type TAlphabet;
+    typedef typename StringSetLimits<TText const>::Type         TLimits;
+    typedef String<TRank>                                       TRanks;
+    typedef String<uint64_t>                                    TBits;
+    typedef PrefixDoublingLess_<TSAValue, TText, TRanks>        TLess;
+    typedef PrefixDoublingConfig_<>                             TConfig;
+
+    TLimits const & limits = stringSetLimits(text);
+    TSize const n = length(sa);
+    if (n == 0)
+        return;
+
+    // Choose q as large as possible for the alphabet (+1 for the end of a sequence), but use no more buckets than
+    // suffixes to keep the counter tables of short texts small.
+    uint64_t const sigma = static_cast<uint64_t>(ValueSize<TAlphabet>::VALUE) + 1;
+    uint64_t const maxBuckets = std::min(static_cast<uint64_t>(TConfig::MAX_BUCKETS), static_cast<uint64_t>(n));
+    unsigned q = 1;
+    for (uint64_t numBuckets = sigma * sigma; numBuckets <= maxBuckets; numBuckets *= sigma)
+        ++q;
+
+    // The bit vectors have a bit per suffix array entry that is set at the end of each group.
+    TSize const numWords = (n + 63) / 64;
+    TBits bits, newBits;
+    resize(bits, numWords + 1, 0, Exact());
+    resize(newBits, numWords + 1, 0, Exact());
+    bits[numWords - 1] = (n % 64 == 0) ? 0 : (~static_cast<uint64_t>(0) << (n % 64));
+    bits[numWords] = newBits[numWords] = ~static_cast<uint64_t>(0);
+
+    TRanks ranks;
+    resize(ranks, n, Exact());
+    _prefixDoublingBuckets(sa, text, ranks, bits, q, sigma);
+
+    TSize const numThreads = omp_get_max_threads();
+    TSize const wordsPerJob = std::max(static_cast<TSize>(1), numWords / (numThreads * 16));
+    TSignedSize const numJobs = (numWords + wordsPerJob - 1) / wordsPerJob;
+    TSize const minParallelGroup = (numThreads > 1) ?
+        std::max(static_cast<TSize>(TConfig::MIN_PARALLEL_GROUP), n / numThreads) : n + 1;
+    TRank const numSeqs = countSequences(text);
+
+    auto isSingleton = [&bits] (TSize pos)
+    {
+        return ((bits[pos / 64] >> (pos % 64)) & 1) && (pos == 0 || ((bits[(pos - 1) / 64] >> ((pos - 1) % 64)) & 1));
+    };
+
+    for (TSize h = q; ; h *= 2)
+    {
+        TLess less(text, limits, ranks, h, numSeqs);
+        std::vector<std::pair<TSize, TSize> > largeGroups;
+
+        // 1. Sort the groups starting in each job's range by the ranks of their h-th suffix.
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+        for (TSignedSize job = 0; job < numJobs; ++job)
+        {
+            TSize const jobBeg = job * wordsPerJob * 64;
+            TSize const jobEnd = std::min(n, jobBeg + wordsPerJob * 64);
+            TSize groupBeg = (jobBeg == 0) ? 0 : _prefixDoublingNextEnd(bits, jobBeg - 1) + 1;
+            while (groupBeg < jobEnd)
+            {
+                unsigned shift = groupBeg % 64;
+                if ((bits[groupBeg / 64] >> shift) == (~static_cast<uint64_t>(0) >> shift))
+                {   // Skip the remaining singletons of this word.
+                    groupBeg = (groupBeg / 64 + 1) * 64;
+                    continue;
+                }
+                TSize groupEnd = _prefixDoublingNextEnd(bits, groupBeg) + 1;
+                if (groupEnd - groupBeg >= minParallelGroup)
+                {
+                    SEQAN_OMP_PRAGMA(critical(prefix_doubling_large_groups))
+                    largeGroups.push_back(std::make_pair(groupBeg, groupEnd));
+                }
+                else if (groupEnd - groupBeg > 1)
+                {
+                    std::sort(begin(sa, Standard()) + groupBeg, begin(sa, Standard()) + groupEnd, less);
+                }
+                groupBeg = groupEnd;
+            }
+        }
+
+        for (auto const & group : largeGroups)
+            sort(infix(sa, group.first, group.second), less, Parallel());
+
+        // 2. Mark the ends of the refined groups.
+        bool unsorted = false;
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic) reduction(||:unsorted))
+        for (TSignedSize job = 0; job < numJobs; ++job)
+        {
+            TSize const wordEnd = std::min(numWords, static_cast<TSize>((job + 1) * wordsPerJob));
+            for (TSize w = job * wordsPerJob; w < wordEnd; ++w)
+            {
+                uint64_t word = bits[w];
+                for (uint64_t open = ~word; open != 0; open &= open - 1)
+                {
+                    TSize pos = w * 64 + bitScanForward(open);
+                    if (less.key(sa[pos]) != less.key(sa[pos + 1]))
+                        word |= static_cast<uint64_t>(1) << (pos % 64);
+                }
+                newBits[w] = word;
+                unsorted = unsorted || (~word != 0);
+            }
+        }
+
+        // 3. Update the ranks of the suffixes in refined groups to the end of their new group.
+        SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+        for (TSignedSize job = 0; job < numJobs; ++job)
+        {
+            TSize const jobBeg = job * wordsPerJob * 64;
+            TSize const jobEnd = std::min(n, jobBeg + wordsPerJob * 64);
+            for (TSize pos = jobBeg; pos < jobEnd; )
+            {
+                if (bits[pos / 64] == ~static_cast<uint64_t>(0) && isSingleton(pos))
+                {   // Skip words of sorted suffixes.
+                    pos = (pos / 64 + 1) * 64;
+                    continue;
+                }
+                if (!isSingleton(pos))
+                {
+                    TSize groupEnd = _prefixDoublingNextEnd(newBits, pos);
+                    for (; pos <= groupEnd && pos < jobEnd; ++pos)
+                        ranks[posGlobalize(sa[pos], limits)] = static_cast<TRank>(groupEnd);
+                    continue;
+                }
+                ++pos;
+            }
+        }
+
+        swap(bits, newBits);
+        if (!unsorted)
+            break;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function createSuffixArray()
+// ----------------------------------------------------------------------------
+
+template <typename TSA, typename TText>
+inline void
+_createSuffixArrayPrefixDoubling(TSA & sa, TText const & text, False)
+{
+    if (static_cast<uint64_t>(length(sa)) + countSequences(text) <= MaxValue<uint32_t>::VALUE)
+        _createSuffixArrayPrefixDoubling(sa, text, uint32_t());
+    else
+        _createSuffixArrayPrefixDoubling(sa, text, uint64_t());
+}
+
+template <typename TSA, typename TText>
+inline void
+_createSuffixArrayPrefixDoubling(TSA & sa, TText const & text, True)
+{
+    createSuffixArray(sa, text, Skew7());
+}
+
+template <typename TSA, typename TText>
+inline void
+createSuffixArray(TSA & sa, TText const & text, ParallelPrefixDoubling const &)
+{
+    typedef typename Value<typename Concatenator<TText>::Type>::Type TAlphabet;
+    _createSuffixArrayPrefixDoubling(sa, text, typename Eval<(BitsPerValue<TAlphabet>::VALUE > 16)>::Type());
+}
+
+}  // namespace seqan2
+
+#endif  // SEQAN_INDEX_INDEX_SA_PREFIX_DOUBLING_H_
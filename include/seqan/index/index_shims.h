@@ -646,6 +646,13 @@ namespace seqan2
         return true;
     }
 
+    template <typename TText, typename TSpec>
+    inline bool indexCreate(Index<TText, TSpec> &index, FibreBwt, SemiExternalBwt const & alg) {
+        resize(indexBwt(index), length(indexRawText(index)), Exact());
+        createBWTable(indexBwt(index), indexText(index), indexRawSA(index), alg);
+        return true;
+    }
+
     template <typename TText, typename TSpec>
     inline bool indexCreate(Index<TText, TSpec> &index, FibreChildtab, Childtab const) {
         resize(indexChildtab(index), length(indexRawText(index)), Exact());
@@ -65,6 +65,10 @@
 #include <condition_variable>
 #include <unordered_map>
 #include <shared_mutex>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
 
 // ============================================================================
 // Module Headers
@@ -94,6 +98,7 @@
 #include <seqan/parallel/enumerable_thread_local.h>
 #include <seqan/parallel/enumerable_thread_local_iterator.h>
 #include <seqan/parallel/parallel_thread_pool.h>
+#include <seqan/parallel/parallel_work_stealing_scheduler.h>
 
 
 #endif  // SEQAN_PARALLEL_H_
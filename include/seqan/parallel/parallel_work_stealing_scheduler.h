@@ -0,0 +1,624 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// A work-stealing task scheduler.  Every worker thread owns a lock-free
+// deque (Chase and Lev, "Dynamic circular work-stealing deque", SPAA 2005,
+// with the C11 memory orderings of Le et al., PPoPP 2013).  Tasks spawned
+// by a worker are pushed to and popped from the bottom of its own deque,
+// idle workers steal from the top of the deques of others.  Tasks spawned
+// by other threads enter through a shared injection queue.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_PARALLEL_PARALLEL_WORK_STEALING_SCHEDULER_H_
+#define INCLUDE_SEQAN_PARALLEL_PARALLEL_WORK_STEALING_SCHEDULER_H_
+
+namespace seqan2
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+class TaskGroup;
+class WorkStealingScheduler;
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Class WorkStealingTask_
+// ----------------------------------------------------------------------------
+
+struct WorkStealingTask_
+{
+    std::function<void()>   callable;
+    TaskGroup *             group;
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class WorkStealingDeque_
+// ----------------------------------------------------------------------------
+
+// Only the owning thread calls _pushBottom() and _popBottom(), any thread may
+// call _stealTop().  Arrays that were replaced when the deque grew are kept
+// until destruction, as thieves might still read from them.
+
+class WorkStealingDeque_
+{
+public:
+
+    struct Array_
+    {
+        int64_t                                                 mask;
+        std::unique_ptr<std::atomic<WorkStealingTask_ *>[]>     slots;
+
+        explicit Array_(int64_t capacity) :
+            mask(capacity - 1),
+            slots(new std::atomic<WorkStealingTask_ *>[capacity])
+        {}
+    };
+
+    alignas(64) std::atomic<int64_t>        top{0};
+    alignas(64) std::atomic<int64_t>        bottom{0};
+    std::atomic<Array_ *>                   array;
+    std::vector<std::unique_ptr<Array_> >   arrays;
+
+    explicit WorkStealingDeque_(int64_t capacity = 256)
+    {
+        arrays.emplace_back(new Array_(capacity));
+        array.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class WorkStealingContext_
+// ----------------------------------------------------------------------------
+
+// Identifies the worker the current thread belongs to.
+
+struct WorkStealingContext_
+{
+    WorkStealingScheduler * scheduler;
+    size_t                  index;
+    uint64_t                seed;
+};
+
+// ----------------------------------------------------------------------------
+// Class TaskGroup
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class TaskGroup
+ * @headerfile <seqan/parallel.h>
+ * @brief A group of tasks that can be waited for.
+ * @signature class TaskGroup;
+ *
+ * Tasks are spawned into a group with @link WorkStealingScheduler#spawn @endlink and the group is waited for with
+ * @link WorkStealingScheduler#wait @endlink.  Tasks may spawn further tasks into the same group.  The group must not
+ * be destroyed while it has pending tasks.
+ */
+
+class TaskGroup
+{
+public:
+    std::atomic<size_t> _pending{0};
+    std::mutex          _mutexException;
+    std::exception_ptr  _exception;
+
+    TaskGroup() = default;
+    TaskGroup(TaskGroup const &) = delete;
+    TaskGroup(TaskGroup &&) = delete;
+
+    TaskGroup & operator=(TaskGroup const &) = delete;
+    TaskGroup & operator=(TaskGroup &&) = delete;
+
+    ~TaskGroup()
+    {
+        SEQAN_ASSERT_EQ(_pending.load(std::memory_order_acquire), 0u);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class WorkStealingScheduler
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class WorkStealingScheduler
+ * @headerfile <seqan/parallel.h>
+ * @brief Executes tasks on a pool of worker threads with per-thread deques and work stealing.
+ * @signature class WorkStealingScheduler;
+ *
+ * Each worker thread owns a lock-free deque.  Tasks spawned from within a task are pushed to the deque of the
+ * executing worker and are executed in LIFO order by it, which keeps the working set in the worker's cache.  Idle
+ * workers steal the oldest tasks from other workers.  Tasks spawned by other threads are handed over through a
+ * shared injection queue.  Workers without work sleep until new tasks arrive.
+ *
+ * A thread waiting for a @link TaskGroup @endlink executes pending tasks itself, thus a task may wait for the tasks it
+ * spawned without blocking a worker.  A scheduler with 0 threads executes all tasks while waiting.
+ */
+
+class WorkStealingScheduler
+{
+public:
+
+    struct Worker_
+    {
+        WorkStealingDeque_  deque;
+    };
+
+    //-------------------------------------------------------------------------
+    // Member Variables.
+
+    std::vector<std::unique_ptr<Worker_> >  _workers;
+    ThreadPool                              _threadPool;
+
+    std::mutex                              _mutexInject;
+    std::deque<WorkStealingTask_ *>         _injectQueue;
+    std::atomic<size_t>                     _injectSize{0};
+
+    std::mutex                              _mutexSleep;
+    std::condition_variable                 _cvSleep;
+    std::atomic<uint64_t>                   _epoch{0};
+    std::atomic<unsigned>                   _numSleeping{0};
+
+    std::mutex                              _mutexWait;
+    std::condition_variable                 _cvWait;
+
+    std::atomic<bool>                       _stop{false};
+
+    //-------------------------------------------------------------------------
+    // Constructor.
+
+    /*!
+     * @fn WorkStealingScheduler::WorkStealingScheduler
+     * @brief The constructor.
+     * @signature WorkStealingScheduler::WorkStealingScheduler([numThreads]);
+     *
+     * @param[in] numThreads The number of worker threads, defaults to <tt>std::thread::hardware_concurrency()</tt>.
+     */
+    explicit WorkStealingScheduler(size_t const numThreads = std::thread::hardware_concurrency());
+
+    WorkStealingScheduler(WorkStealingScheduler const &) = delete;
+    WorkStealingScheduler(WorkStealingScheduler &&) = delete;
+
+    WorkStealingScheduler & operator=(WorkStealingScheduler const &) = delete;
+    WorkStealingScheduler & operator=(WorkStealingScheduler &&) = delete;
+
+    /*!
+     * @fn WorkStealingScheduler::~WorkStealingScheduler
+     * @brief The destructor.
+     * @signature WorkStealingScheduler::~WorkStealingScheduler();
+     *
+     * Executes all tasks that are still pending and joins the worker threads.
+     */
+    ~WorkStealingScheduler();
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _workStealingContext()
+// ----------------------------------------------------------------------------
+
+inline WorkStealingContext_ &
+_workStealingContext()
+{
+    static thread_local WorkStealingContext_ ctx{nullptr, 0, 0x9e3779b97f4a7c15ull};
+    return ctx;
+}
+
+// ----------------------------------------------------------------------------
+// Function _pushBottom()
+// ----------------------------------------------------------------------------
+
+inline void
+_pushBottom(WorkStealingDeque_ & me, WorkStealingTask_ * task)
+{
+    typedef WorkStealingDeque_::Array_ TArray;
+
+    int64_t b = me.bottom.load(std::memory_order_relaxed);
+    int64_t t = me.top.load(std::memory_order_acquire);
+    TArray * a = me.array.load(std::memory_order_relaxed);
+
+    if (b - t > a->mask)
+    {   // Full, double the capacity.
+        TArray * bigger = new TArray(2 * (a->mask + 1));
+        for (int64_t i = t; i < b; ++i)
+            bigger->slots[i & bigger->mask].store(a->slots[i & a->mask].load(std::memory_order_relaxed),
+                                                  std::memory_order_relaxed);
+        me.arrays.emplace_back(bigger);
+        me.array.store(bigger, std::memory_order_release);
+        a = bigger;
+    }
+
+    a->slots[b & a->mask].store(task, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    me.bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+// Function _popBottom()
+// ----------------------------------------------------------------------------
+
+inline WorkStealingTask_ *
+_popBottom(WorkStealingDeque_ & me)
+{
+    int64_t b = me.bottom.load(std::memory_order_relaxed) - 1;
+    WorkStealingDeque_::Array_ * a = me.array.load(std::memory_order_relaxed);
+    me.bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = me.top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {   // Empty.
+        me.bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    WorkStealingTask_ * task = a->slots[b & a->mask].load(std::memory_order_relaxed);
+    if (t == b)
+    {   // The last task, race against thieves.
+        if (!me.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            task = nullptr;
+        me.bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+// ----------------------------------------------------------------------------
+// Function _stealTop()
+// ----------------------------------------------------------------------------
+
+inline WorkStealingTask_ *
+_stealTop(WorkStealingDeque_ & me)
+{
+    int64_t t = me.top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = me.bottom.load(std::memory_order_acquire);
+
+    if (t >= b)
+        return nullptr;  // Empty.
+
+    WorkStealingDeque_::Array_ * a = me.array.load(std::memory_order_acquire);
+    WorkStealingTask_ * task = a->slots[t & a->mask].load(std::memory_order_relaxed);
+    if (!me.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;  // Lost the race against another thief or the owner.
+    return task;
+}
+
+// ----------------------------------------------------------------------------
+// Function _findTask()
+// ----------------------------------------------------------------------------
+
+// Look for a task in the own deque, the injection queue, and the deques of
+// the other workers starting at a random victim.
+
+inline WorkStealingTask_ *
+_findTask(WorkStealingScheduler & me)
+{
+    WorkStealingContext_ & ctx = _workStealingContext();
+    bool const isWorker = ctx.scheduler == &me;
+    WorkStealingTask_ * task = nullptr;
+
+    if (isWorker && (task = _popBottom(me._workers[ctx.index]->deque)) != nullptr)
+        return task;
+
+    if (me._injectSize.load(std::memory_order_acquire) != 0)
+    {
+        std::lock_guard<std::mutex> lck(me._mutexInject);
+        if (!me._injectQueue.empty())
+        {
+            task = me._injectQueue.front();
+            me._injectQueue.pop_front();
+            me._injectSize.fetch_sub(1, std::memory_order_release);
+            return task;
+        }
+    }
+
+    size_t const numWorkers = me._workers.size();
+    if (numWorkers == 0)
+        return nullptr;
+
+    // xorshift64 to pick the first victim.
+    ctx.seed ^= ctx.seed << 13;
+    ctx.seed ^= ctx.seed >> 7;
+    ctx.seed ^= ctx.seed << 17;
+    size_t const first = ctx.seed % numWorkers;
+    for (size_t i = 0; i < numWorkers; ++i)
+    {
+        size_t victim = (first + i) % numWorkers;
+        if (isWorker && victim == ctx.index)
+            continue;
+        if ((task = _stealTop(me._workers[victim]->deque)) != nullptr)
+            return task;
+    }
+    return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function _executeTask()
+// ----------------------------------------------------------------------------
+
+inline void
+_executeTask(WorkStealingScheduler & me, WorkStealingTask_ * task)
+{
+    TaskGroup & group = *task->group;
+    try
+    {
+        task->callable();
+    }
+    catch (...)
+    {   // Keep the first exception, it is rethrown by wait().
+        std::lock_guard<std::mutex> lck(group._mutexException);
+        if (!group._exception)
+            group._exception = std::current_exception();
+    }
+    delete task;
+
+    // The group might be destroyed as soon as the counter drops to 0, only the scheduler is touched afterwards.
+    if (group._pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        std::lock_guard<std::mutex> lck(me._mutexWait);
+        me._cvWait.notify_all();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _notifyWorkers()
+// ----------------------------------------------------------------------------
+
+inline void
+_notifyWorkers(WorkStealingScheduler & me)
+{
+    me._epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (me._numSleeping.load(std::memory_order_seq_cst) != 0)
+    {
+        {
+            std::lock_guard<std::mutex> lck(me._mutexSleep);
+        }
+        me._cvSleep.notify_one();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _workerLoop()
+// ----------------------------------------------------------------------------
+
+inline void
+_workerLoop(WorkStealingScheduler & me, size_t const index)
+{
+    WorkStealingContext_ & ctx = _workStealingContext();
+    ctx.scheduler = &me;
+    ctx.index = index;
+    ctx.seed += index * 0x2545f4914f6cdd1dull;
+
+    SpinDelay spinDelay;
+    while (true)
+    {
+        WorkStealingTask_ * task = _findTask(me);
+        if (task != nullptr)
+        {
+            _executeTask(me, task);
+            clear(spinDelay);
+            continue;
+        }
+
+        if (spinDelay.duration <= SpinDelay::LOOPS_BEFORE_YIELD)
+        {   // Spin shortly before going to sleep.
+            waitFor(spinDelay);
+            continue;
+        }
+
+        // Announce the sleep before the last look for work, so that no notification is missed.
+        uint64_t epoch = me._epoch.load(std::memory_order_seq_cst);
+        me._numSleeping.fetch_add(1, std::memory_order_seq_cst);
+        if ((task = _findTask(me)) != nullptr)
+        {
+            me._numSleeping.fetch_sub(1, std::memory_order_relaxed);
+            _executeTask(me, task);
+            clear(spinDelay);
+            continue;
+        }
+
+        if (me._stop.load(std::memory_order_acquire))
+        {
+            me._numSleeping.fetch_sub(1, std::memory_order_relaxed);
+            break;  // All tasks are done.
+        }
+
+        {
+            std::unique_lock<std::mutex> lck(me._mutexSleep);
+            me._cvSleep.wait(lck, [&me, epoch]
+            {
+                return me._epoch.load(std::memory_order_seq_cst) != epoch || me._stop.load(std::memory_order_acquire);
+            });
+        }
+        me._numSleeping.fetch_sub(1, std::memory_order_relaxed);
+        clear(spinDelay);
+    }
+
+    ctx.scheduler = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+// WorkStealingScheduler Constructor and Destructor
+// ----------------------------------------------------------------------------
+
+inline
+WorkStealingScheduler::WorkStealingScheduler(size_t const numThreads)
+{
+    for (size_t i = 0; i < numThreads; ++i)
+        _workers.emplace_back(new Worker_);
+
+    for (size_t i = 0; i < numThreads; ++i)
+        spawn(_threadPool, [this, i] () { _workerLoop(*this, i); });
+}
+
+inline
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lck(_mutexSleep);
+        _stop.store(true, std::memory_order_release);
+        _epoch.fetch_add(1, std::memory_order_seq_cst);
+    }
+    _cvSleep.notify_all();
+    join(_threadPool);
+
+    // Without workers the remaining tasks are executed here.
+    while (WorkStealingTask_ * task = _findTask(*this))
+        _executeTask(*this, task);
+}
+
+// ----------------------------------------------------------------------------
+// Function numThreads()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn WorkStealingScheduler#numThreads
+ * @brief Returns the number of worker threads.
+ * @headerfile <seqan/parallel.h>
+ *
+ * @signature size_t numThreads(scheduler);
+ * @param[in] scheduler The @link WorkStealingScheduler @endlink.
+ */
+
+inline size_t
+numThreads(WorkStealingScheduler const & me)
+{
+    return me._workers.size();
+}
+
+// ----------------------------------------------------------------------------
+// Function spawn()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn WorkStealingScheduler#spawn
+ * @brief Spawns a task in a task group.
+ * @headerfile <seqan/parallel.h>
+ *
+ * @signature void spawn(scheduler, group, callable);
+ * @param[in,out] scheduler The @link WorkStealingScheduler @endlink to execute the task.
+ * @param[in,out] group     The @link TaskGroup @endlink the task belongs to.
+ * @param[in]     callable  A callable object without arguments.
+ *
+ * Called from a task, the new task is pushed to the deque of the executing worker, otherwise it is appended to the
+ * injection queue of the scheduler.
+ *
+ * @datarace Thread safe.
+ */
+
+template <typename TCallable>
+inline void
+spawn(WorkStealingScheduler & me, TaskGroup & group, TCallable && callable)
+{
+    group._pending.fetch_add(1, std::memory_order_relaxed);
+    WorkStealingTask_ * task = new WorkStealingTask_{std::function<void()>(std::forward<TCallable>(callable)), &group};
+
+    WorkStealingContext_ & ctx = _workStealingContext();
+    if (ctx.scheduler == &me)
+    {
+        _pushBottom(me._workers[ctx.index]->deque, task);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lck(me._mutexInject);
+        me._injectQueue.push_back(task);
+        me._injectSize.fetch_add(1, std::memory_order_release);
+    }
+    _notifyWorkers(me);
+}
+
+// ----------------------------------------------------------------------------
+// Function wait()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn WorkStealingScheduler#wait
+ * @brief Waits until all tasks of a group are finished.
+ * @headerfile <seqan/parallel.h>
+ *
+ * @signature void wait(scheduler, group);
+ * @param[in,out] scheduler The @link WorkStealingScheduler @endlink executing the tasks.
+ * @param[in,out] group     The @link TaskGroup @endlink to wait for.
+ *
+ * The calling thread executes pending tasks while waiting.  Worker threads never block here, other threads block
+ * once no more tasks are available.  If a task of the group threw an exception, the first one is rethrown after all
+ * tasks of the group finished.
+ *
+ * @datarace Thread safe.
+ */
+
+inline void
+wait(WorkStealingScheduler & me, TaskGroup & group)
+{
+    bool const isWorker = _workStealingContext().scheduler == &me;
+
+    SpinDelay spinDelay;
+    while (group._pending.load(std::memory_order_acquire) != 0)
+    {
+        if (WorkStealingTask_ * task = _findTask(me))
+        {
+            _executeTask(me, task);
+            clear(spinDelay);
+        }
+        else if (isWorker || spinDelay.duration <= SpinDelay::LOOPS_BEFORE_YIELD || numThreads(me) == 0)
+        {
+            waitFor(spinDelay);
+        }
+        else
+        {   // Leave the remaining tasks to the workers.
+            std::unique_lock<std::mutex> lck(me._mutexWait);
+            me._cvWait.wait(lck, [&group] { return group._pending.load(std::memory_order_acquire) == 0; });
+        }
+    }
+
+    // Serialize with the notification of the last task before the group can be destroyed.
+    {
+        std::lock_guard<std::mutex> lck(me._mutexWait);
+    }
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lck(group._mutexException);
+        std::swap(exception, group._exception);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+}  // namespace seqan2
+
+#endif  // INCLUDE_SEQAN_PARALLEL_PARALLEL_WORK_STEALING_SCHEDULER_H_
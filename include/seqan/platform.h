@@ -404,6 +404,15 @@ typedef int8_t __int8;     // nolint
 #define SEQAN_UNLIKELY(x)    (x)
 #endif
 
+// ==========================================================================
+// Software prefetching
+// ==========================================================================
+#if defined(COMPILER_GCC) || defined(COMPILER_CLANG) || defined(COMPILER_LINTEL)
+#define SEQAN_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define SEQAN_PREFETCH(addr) ((void)(addr))
+#endif
+
 // A macro to eliminate warnings for unused entities.
 #if __cplusplus >= 201703L
 #define SEQAN_UNUSED [[maybe_unused]]
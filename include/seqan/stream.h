@@ -100,11 +100,18 @@ Either disable -DSEQAN_HAS_BZIP2 or define -DSEQAN_HAS_ZLIB"
 #include <seqan/stream/iostream_zutil.h>
 #include <seqan/stream/iostream_zip.h>
 #include <seqan/stream/iostream_zip_impl.h>
+#include <seqan/stream/iostream_decompression_pipeline.h>
 #include <seqan/stream/iostream_bgzf.h>
+#include <seqan/stream/binning_index.h>
 #endif
 
 #if SEQAN_HAS_BZIP2
 #include <seqan/stream/iostream_bzip2.h>
+#include <seqan/stream/iostream_bzip2_parallel.h>
+#endif
+
+#if SEQAN_HAS_ZSTD
+#include <seqan/stream/iostream_zstd.h>
 #endif
 
 #include <seqan/stream/virtual_stream.h>
@@ -116,6 +123,7 @@ Either disable -DSEQAN_HAS_BZIP2 or define -DSEQAN_HAS_ZLIB"
 // TODO(esiragusa): move these files into basic - they are not unique to streams.
 
 #include <seqan/stream/tokenization.h>
+#include <seqan/stream/tokenization_simd.h>
 #include <seqan/stream/lexical_cast.h>
 
 #endif  // SEQAN_STREAM_H_
@@ -0,0 +1,761 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Construction of the UCSC binning indices (BAI, CSI, TBI) over BGZF files.
+//
+// The builder mimics hts_idx_push() and hts_idx_finish() of htslib so the
+// resulting bins, chunks, and linear indices equal the ones of samtools and
+// tabix.  Records are fed in file order into BinningIndexPart_ objects which
+// can be filled independently by worker threads and are then merged in
+// order into a BinningIndexBuilder_.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_STREAM_BINNING_INDEX_H_
+#define INCLUDE_SEQAN_STREAM_BINNING_INDEX_H_
+
+namespace seqan2 {
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Class BinningIndexRun_
+// ----------------------------------------------------------------------------
+
+// A maximal stretch of consecutive records on the same reference in the same bin.
+
+struct BinningIndexRun_
+{
+    int32_t  rID;
+    uint32_t bin;
+    uint64_t beginOffset;   // virtual offset of the first record
+    uint64_t endOffset;     // virtual offset behind the last record
+    int64_t  firstPos;
+    int64_t  lastPos;
+    uint64_t numMapped;
+    uint64_t numUnmapped;
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BinningIndexLinearPatch_
+// ----------------------------------------------------------------------------
+
+// The linear index windows of one reference touched by a part.
+
+struct BinningIndexLinearPatch_
+{
+    int32_t          rID;
+    uint64_t         firstWindow;
+    String<uint64_t> offsets;       // max() marks windows not touched
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BinningIndexPart_
+// ----------------------------------------------------------------------------
+
+// The index contribution of a consecutive range of records.
+
+struct BinningIndexPart_
+{
+    String<BinningIndexRun_>         runs;
+    String<BinningIndexLinearPatch_> linear;
+    bool                             ok;
+
+    BinningIndexPart_() : ok(true)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BinningIndexRefInfo_
+// ----------------------------------------------------------------------------
+
+// Per reference statistics stored in the pseudo-bin.
+
+struct BinningIndexRefInfo_
+{
+    uint64_t beginOffset;
+    uint64_t endOffset;
+    uint64_t numMapped;
+    uint64_t numUnmapped;
+    bool     used;
+
+    BinningIndexRefInfo_() : beginOffset(0), endOffset(0), numMapped(0), numUnmapped(0), used(false)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BinningIndexBuilder_
+// ----------------------------------------------------------------------------
+
+template <typename TBinIndex>
+struct BinningIndexBuilder_
+{
+    String<TBinIndex>               binIndices;
+    String<String<uint64_t> >       linearIndices;
+    String<BinningIndexRefInfo_>    refInfos;
+
+    int                             minShift;
+    int                             depth;
+
+    BinningIndexRun_                pending;
+    bool                            hasPending;
+    int32_t                         currentRID;
+    int64_t                         lastPos;
+    bool                            hasNoCoor;
+    uint64_t                        unalignedCount;
+    bool                            ok;
+
+    BinningIndexBuilder_(size_t numRefs, int minShift_, int depth_) :
+        minShift(minShift_),
+        depth(depth_),
+        hasPending(false),
+        currentRID(-2),
+        lastPos(0),
+        hasNoCoor(false),
+        unalignedCount(0),
+        ok(true)
+    {
+        resize(binIndices, numRefs);
+        resize(linearIndices, numRefs);
+        resize(refInfos, numRefs);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BgzfSpan_
+// ----------------------------------------------------------------------------
+
+// Maps a range of a decompressed buffer back to its BGZF block.
+
+struct BgzfSpan_
+{
+    size_t   bufferPos;
+    size_t   length;
+    uint64_t fileOffset;        // compressed offset of the block
+    uint64_t nextFileOffset;    // compressed offset of the block behind
+    uint32_t blockOffset;       // offset of bufferPos within the decompressed block
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BgzfBatchReader_
+// ----------------------------------------------------------------------------
+
+// Reads a BGZF file in batches of blocks that are decompressed in parallel.
+// Bytes not consumed by the caller are carried over into the next batch.
+
+struct BgzfBatchReader_
+{
+    std::ifstream               file;
+    uint64_t                    fileOffset;
+    String<char>                buffer;
+    String<BgzfSpan_>           spans;
+    String<String<char> >       blocks;
+    size_t                      skip;           // bytes to drop from the first block
+    bool                        atEof;
+    bool                        ok;
+
+    BgzfBatchReader_() : fileOffset(0), skip(0), atEof(false), ok(true)
+    {}
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _binningReg2bin()
+// ----------------------------------------------------------------------------
+
+// Bin of the 0-based half-open interval [beg, end), see hts_reg2bin().
+
+inline uint32_t
+_binningReg2bin(int64_t beg, int64_t end, int minShift, int depth)
+{
+    int s = minShift;
+    int64_t t = ((1ll << (3 * depth)) - 1) / 7;
+    for (--end; depth > 0; --depth, s += 3, t -= 1ll << (3 * depth))
+        if (beg >> s == end >> s)
+            return static_cast<uint32_t>(t + (beg >> s));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningNumBins()
+// ----------------------------------------------------------------------------
+
+// Number of bins of a scheme with the given depth, the pseudo-bin is the one behind.
+
+inline uint32_t
+_binningNumBins(int depth)
+{
+    return ((1u << (3 * (depth + 1))) - 1) / 7;
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningReg2bins()
+// ----------------------------------------------------------------------------
+
+// All bins overlapping the 0-based half-open interval [beg, end), see reg2bins() of htslib.
+
+template <typename TBin>
+inline void
+_binningReg2bins(std::vector<TBin> & list, int64_t beg, int64_t end, int minShift, int depth)
+{
+    list.clear();
+
+    int s = minShift + 3 * depth;
+    if (beg >= end)
+        return;
+    if (end >= (1ll << s))
+        end = 1ll << s;
+
+    --end;
+    for (int l = 0, t = 0; l <= depth; s -= 3, t += 1 << (3 * l), ++l)
+        for (int64_t b = t + (beg >> s); b <= t + (end >> s); ++b)
+            list.push_back(static_cast<TBin>(b));
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningBinBottom()
+// ----------------------------------------------------------------------------
+
+// First window of the linear index covered by a bin, see hts_bin_bot() of htslib.
+
+inline uint64_t
+_binningBinBottom(uint32_t bin, int depth)
+{
+    int l = 0;
+    for (uint32_t b = bin; b != 0; b = (b - 1) >> 3)
+        ++l;
+    return static_cast<uint64_t>(bin - _binningNumBins(l - 1)) << (3 * (depth - l));
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexResize()
+// ----------------------------------------------------------------------------
+
+// Grow the number of references, e.g. for formats that learn them while indexing.
+
+template <typename TBinIndex>
+inline void
+_binningIndexResize(BinningIndexBuilder_<TBinIndex> & builder, size_t numRefs)
+{
+    resize(builder.binIndices, numRefs);
+    resize(builder.linearIndices, numRefs);
+    resize(builder.refInfos, numRefs);
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexAddRecord()
+// ----------------------------------------------------------------------------
+
+// Add a record to a part.  The record spans [beg, end) on reference rID and is
+// stored between the virtual offsets beginOffset and endOffset.
+
+inline void
+_binningIndexAddRecord(BinningIndexPart_ & part,
+                       int32_t rID,
+                       int64_t beg,
+                       int64_t end,
+                       bool isMapped,
+                       uint64_t beginOffset,
+                       uint64_t endOffset,
+                       int minShift,
+                       int depth)
+{
+    if (rID < 0)
+    {
+        beg = -1;
+        end = 0;
+    }
+    else if (beg > (1ll << (minShift + 3 * depth)) || end > (1ll << (minShift + 3 * depth)))
+    {
+        part.ok = false;    // The position cannot be stored in the binning scheme.
+        return;
+    }
+    else if (isMapped)
+    {
+        // Update the linear index with the clipped interval.
+        uint64_t firstWindow = std::max(beg, (int64_t)0) >> minShift;
+        uint64_t lastWindow = (std::max(end, (int64_t)1) - 1) >> minShift;
+
+        if (empty(part.linear) || back(part.linear).rID != rID)
+        {
+            resize(part.linear, length(part.linear) + 1);
+            back(part.linear).rID = rID;
+            back(part.linear).firstWindow = firstWindow;
+        }
+
+        BinningIndexLinearPatch_ & patch = back(part.linear);
+        if (firstWindow < patch.firstWindow)
+        {
+            part.ok = false;    // Records are not sorted.
+            return;
+        }
+        if (length(patch.offsets) < lastWindow + 1 - patch.firstWindow)
+            resize(patch.offsets, lastWindow + 1 - patch.firstWindow, std::numeric_limits<uint64_t>::max());
+        for (uint64_t w = firstWindow - patch.firstWindow; w <= lastWindow - patch.firstWindow; ++w)
+            if (patch.offsets[w] == std::numeric_limits<uint64_t>::max())
+                patch.offsets[w] = beginOffset;
+
+        beg = std::max(beg, (int64_t)0);
+        end = std::max(end, (int64_t)1);
+    }
+
+    uint32_t bin = _binningReg2bin(beg, end, minShift, depth);
+
+    if (!empty(part.runs) && back(part.runs).rID == rID && back(part.runs).bin == bin)
+    {
+        BinningIndexRun_ & run = back(part.runs);
+        if (rID >= 0 && run.lastPos > beg)
+            part.ok = false;    // Records are not sorted.
+        run.endOffset = endOffset;
+        run.lastPos = beg;
+    }
+    else
+    {
+        BinningIndexRun_ run;
+        run.rID = rID;
+        run.bin = bin;
+        run.beginOffset = beginOffset;
+        run.endOffset = endOffset;
+        run.firstPos = beg;
+        run.lastPos = beg;
+        run.numMapped = 0;
+        run.numUnmapped = 0;
+        appendValue(part.runs, run);
+    }
+
+    if (isMapped)
+        ++back(part.runs).numMapped;
+    else
+        ++back(part.runs).numUnmapped;
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexFlushRun()
+// ----------------------------------------------------------------------------
+
+template <typename TBinIndex>
+inline void
+_binningIndexFlushRun(BinningIndexBuilder_<TBinIndex> & builder, BinningIndexRun_ const & run)
+{
+    if (run.rID < 0)
+    {
+        // Records without coordinate are only counted.
+        builder.unalignedCount += run.numMapped + run.numUnmapped;
+        builder.hasNoCoor = true;
+        builder.currentRID = -1;
+        return;
+    }
+
+    if (builder.hasNoCoor || static_cast<uint64_t>(run.rID) >= length(builder.binIndices))
+    {
+        builder.ok = false;
+        return;
+    }
+
+    BinningIndexRefInfo_ & info = builder.refInfos[run.rID];
+    if (run.rID != builder.currentRID)
+    {
+        if (info.used)
+        {
+            builder.ok = false;     // The records of a reference are not contiguous.
+            return;
+        }
+        info.used = true;
+        info.beginOffset = run.beginOffset;
+        builder.currentRID = run.rID;
+    }
+    else if (builder.lastPos > run.firstPos)
+    {
+        builder.ok = false;         // Records are not sorted.
+        return;
+    }
+
+    appendValue(builder.binIndices[run.rID][run.bin].chunkBegEnds, Pair<uint64_t>(run.beginOffset, run.endOffset));
+    info.endOffset = run.endOffset;
+    info.numMapped += run.numMapped;
+    info.numUnmapped += run.numUnmapped;
+    builder.lastPos = run.lastPos;
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexMerge()
+// ----------------------------------------------------------------------------
+
+// Merge the parts in file order.  Runs of consecutive parts that continue
+// each other are joined before their chunks are stored.
+
+template <typename TBinIndex>
+inline void
+_binningIndexMerge(BinningIndexBuilder_<TBinIndex> & builder, BinningIndexPart_ const & part)
+{
+    if (!part.ok)
+        builder.ok = false;
+    if (!builder.ok)
+        return;
+
+    for (BinningIndexRun_ const & run : part.runs)
+    {
+        if (builder.hasPending && builder.pending.rID == run.rID && builder.pending.bin == run.bin)
+        {
+            if (run.rID >= 0 && builder.pending.lastPos > run.firstPos)
+                builder.ok = false;
+            builder.pending.endOffset = run.endOffset;
+            builder.pending.lastPos = run.lastPos;
+            builder.pending.numMapped += run.numMapped;
+            builder.pending.numUnmapped += run.numUnmapped;
+        }
+        else
+        {
+            if (builder.hasPending)
+                _binningIndexFlushRun(builder, builder.pending);
+            builder.pending = run;
+            builder.hasPending = true;
+        }
+    }
+
+    // The first offset written to a linear window wins.
+    for (BinningIndexLinearPatch_ const & patch : part.linear)
+    {
+        if (static_cast<uint64_t>(patch.rID) >= length(builder.linearIndices))
+        {
+            builder.ok = false;
+            return;
+        }
+
+        String<uint64_t> & linear = builder.linearIndices[patch.rID];
+        if (length(linear) < patch.firstWindow + length(patch.offsets))
+            resize(linear, patch.firstWindow + length(patch.offsets), std::numeric_limits<uint64_t>::max());
+        for (size_t i = 0; i < length(patch.offsets); ++i)
+            if (linear[patch.firstWindow + i] == std::numeric_limits<uint64_t>::max())
+                linear[patch.firstWindow + i] = patch.offsets[i];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexCompressBins()
+// ----------------------------------------------------------------------------
+
+// Move the chunks of small bins into their parents and join chunks that
+// start in the same BGZF block, see compress_binning() of htslib.
+
+template <typename TBinIndex>
+inline void
+_binningIndexCompressBins(TBinIndex & binIndex, int depth)
+{
+    typedef typename TBinIndex::iterator TBinIter;
+    typedef Pair<uint64_t, uint64_t>     TChunk;
+
+    auto chunkLess = [](TChunk const & a, TChunk const & b) { return a.i1 < b.i1; };
+    uint32_t const numBins = _binningNumBins(depth);
+
+    for (int l = depth; l > 0; --l)
+    {
+        uint32_t levelBegin = _binningNumBins(l - 1);
+        uint32_t levelEnd = _binningNumBins(l);
+
+        for (TBinIter it = binIndex.lower_bound(levelBegin); it != binIndex.end() && it->first < levelEnd;)
+        {
+            String<TChunk> & chunks = it->second.chunkBegEnds;
+            if (l < depth)
+                std::sort(begin(chunks, Standard()), end(chunks, Standard()), chunkLess);
+
+            if ((back(chunks).i2 >> 16) - (front(chunks).i1 >> 16) < 65536u)
+            {
+                TBinIter parentIt = binIndex.find((it->first - 1) >> 3);
+                if (parentIt != binIndex.end())
+                {
+                    append(parentIt->second.chunkBegEnds, chunks);
+                    it = binIndex.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+    }
+
+    TBinIter rootIt = binIndex.find(0);
+    if (rootIt != binIndex.end())
+        std::sort(begin(rootIt->second.chunkBegEnds, Standard()), end(rootIt->second.chunkBegEnds, Standard()),
+                  chunkLess);
+
+    for (TBinIter it = binIndex.begin(); it != binIndex.end() && it->first < numBins; ++it)
+    {
+        String<TChunk> & chunks = it->second.chunkBegEnds;
+        size_t m = 0;
+        for (size_t l = 1; l < length(chunks); ++l)
+        {
+            if ((chunks[m].i2 >> 16) >= (chunks[l].i1 >> 16))
+                chunks[m].i2 = std::max(chunks[m].i2, chunks[l].i2);
+            else
+                chunks[++m] = chunks[l];
+        }
+        resize(chunks, m + 1);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _binningIndexFinish()
+// ----------------------------------------------------------------------------
+
+template <typename TBinIndex>
+inline bool
+_binningIndexFinish(BinningIndexBuilder_<TBinIndex> & builder)
+{
+    if (builder.hasPending)
+        _binningIndexFlushRun(builder, builder.pending);
+    builder.hasPending = false;
+
+    if (!builder.ok)
+        return false;
+
+    uint32_t const metaBin = _binningNumBins(builder.depth) + 1;
+
+    for (size_t i = 0; i < length(builder.binIndices); ++i)
+    {
+        BinningIndexRefInfo_ const & info = builder.refInfos[i];
+        if (!info.used)
+            continue;
+
+        // Fill windows not covered by any record.
+        String<uint64_t> & linear = builder.linearIndices[i];
+        size_t l = 0;
+        for (; l < length(linear) && linear[l] == std::numeric_limits<uint64_t>::max(); ++l)
+            linear[l] = info.beginOffset;
+        for (; l < length(linear); ++l)
+            if (linear[l] == std::numeric_limits<uint64_t>::max())
+                linear[l] = linear[l - 1];
+
+        _binningIndexCompressBins(builder.binIndices[i], builder.depth);
+
+        // Store the reference statistics in the pseudo-bin.
+        String<Pair<uint64_t> > & meta = builder.binIndices[i][metaBin].chunkBegEnds;
+        appendValue(meta, Pair<uint64_t>(info.beginOffset, info.endOffset));
+        appendValue(meta, Pair<uint64_t>(info.numMapped, info.numUnmapped));
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _bgzfVirtualOffset()
+// ----------------------------------------------------------------------------
+
+// Virtual offset of a buffer position as reported by tell after reading up to it.
+
+inline uint64_t
+_bgzfVirtualOffset(BgzfBatchReader_ const & reader, size_t pos)
+{
+    auto it = std::lower_bound(begin(reader.spans, Standard()), end(reader.spans, Standard()), pos,
+                               [](BgzfSpan_ const & span, size_t p) { return span.bufferPos + span.length < p; });
+    SEQAN_ASSERT(it != end(reader.spans, Standard()));
+
+    if (it->bufferPos + it->length == pos)
+        return it->nextFileOffset << 16;
+    return (it->fileOffset << 16) | (it->blockOffset + (pos - it->bufferPos));
+}
+
+// ----------------------------------------------------------------------------
+// Function _consumeBuffer()
+// ----------------------------------------------------------------------------
+
+// Drop the first pos bytes of the buffer and keep the rest for the next batch.
+
+inline void
+_consumeBuffer(BgzfBatchReader_ & reader, size_t pos)
+{
+    String<BgzfSpan_> spans;
+    for (BgzfSpan_ const & span : reader.spans)
+    {
+        if (span.bufferPos + span.length < pos)
+            continue;
+
+        // The span ending at pos is kept empty to report the offset behind it.
+        BgzfSpan_ rest = span;
+        size_t first = std::max(span.bufferPos, pos);
+        rest.blockOffset += first - span.bufferPos;
+        rest.length = span.bufferPos + span.length - first;
+        rest.bufferPos = first - pos;
+        appendValue(spans, rest);
+    }
+    swap(reader.spans, spans);
+
+    erase(reader.buffer, 0, pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function _readBlocks()
+// ----------------------------------------------------------------------------
+
+// Read up to maxBlocks BGZF blocks and append their decompressed content to
+// the buffer.  Returns false if no block was left.
+
+inline bool
+_readBlocks(BgzfBatchReader_ & reader, size_t maxBlocks, size_t numThreads)
+{
+    typedef DefaultPageSize<BgzfFile> TPageSize;
+
+    ignoreUnusedVariableWarning(numThreads);
+
+    if (reader.atEof || !reader.ok)
+        return false;
+
+    if (length(reader.blocks) < maxBlocks)
+        resize(reader.blocks, maxBlocks);
+
+    // Load the compressed blocks sequentially.
+    size_t numBlocks = 0;
+    size_t bufferLen = length(reader.buffer);
+    while (numBlocks < maxBlocks)
+    {
+        String<char> & block = reader.blocks[numBlocks];
+        resize(block, TPageSize::BLOCK_HEADER_LENGTH);
+        reader.file.read(&block[0], TPageSize::BLOCK_HEADER_LENGTH);
+        if (reader.file.gcount() == 0)
+        {
+            reader.atEof = true;
+            break;
+        }
+        if (reader.file.gcount() != TPageSize::BLOCK_HEADER_LENGTH || !_bgzfCheckHeader(&block[0]))
+        {
+            reader.ok = false;
+            return false;
+        }
+
+        size_t blockLen = _bgzfUnpack16(&block[16]) + 1u;
+        if (blockLen <= TPageSize::BLOCK_HEADER_LENGTH + TPageSize::BLOCK_FOOTER_LENGTH)
+        {
+            reader.ok = false;
+            return false;
+        }
+        resize(block, blockLen);
+        reader.file.read(&block[TPageSize::BLOCK_HEADER_LENGTH], blockLen - TPageSize::BLOCK_HEADER_LENGTH);
+        if (static_cast<size_t>(reader.file.gcount()) != blockLen - TPageSize::BLOCK_HEADER_LENGTH)
+        {
+            reader.ok = false;
+            return false;
+        }
+
+        uint32_t rawLen = _bgzfUnpack32(&block[blockLen - 4]);
+        if (rawLen > TPageSize::MAX_BLOCK_SIZE)
+        {
+            reader.ok = false;
+            return false;
+        }
+
+        // Empty blocks, e.g. the EOF marker, get no span.
+        if (rawLen != 0)
+        {
+            BgzfSpan_ span;
+            span.bufferPos = bufferLen;
+            span.length = rawLen;
+            span.fileOffset = reader.fileOffset;
+            span.nextFileOffset = reader.fileOffset + blockLen;
+            span.blockOffset = 0;
+            appendValue(reader.spans, span);
+            bufferLen += rawLen;
+            ++numBlocks;
+        }
+        reader.fileOffset += blockLen;
+    }
+
+    if (numBlocks == 0)
+        return false;
+
+    // Decompress the blocks in parallel, each directly into its place in the buffer.
+    size_t spansBegin = length(reader.spans) - numBlocks;
+    resize(reader.buffer, bufferLen);
+    bool ok = true;
+
+    SEQAN_OMP_PRAGMA(parallel num_threads(numThreads))
+    {
+        // One decompression context per thread, reused for all its blocks.
+        CompressionContext<BgzfFile> ctx;
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic) reduction(&&:ok))
+        for (int64_t i = 0; i < static_cast<int64_t>(numBlocks); ++i)
+        {
+            String<char> & block = reader.blocks[i];
+            BgzfSpan_ const & span = reader.spans[spansBegin + i];
+            try
+            {
+                if (_decompressBlock(&reader.buffer[span.bufferPos], span.length, &block[0], length(block), ctx) !=
+                    span.length)
+                    ok = false;
+            }
+            catch (IOError const &)
+            {
+                ok = false;
+            }
+        }
+    }
+
+    reader.ok = ok;
+    if (ok && reader.skip != 0)
+    {
+        if (length(reader.buffer) < reader.skip)
+        {
+            reader.ok = false;
+            return false;
+        }
+        _consumeBuffer(reader, reader.skip);
+        reader.skip = 0;
+    }
+    return reader.ok;
+}
+
+// ----------------------------------------------------------------------------
+// Function open()                                            [BgzfBatchReader_]
+// ----------------------------------------------------------------------------
+
+// Open a BGZF file and position it at a virtual offset.
+
+inline bool
+open(BgzfBatchReader_ & reader, char const * fileName, uint64_t virtualOffset)
+{
+    reader.file.open(fileName, std::ios::binary | std::ios::in);
+    if (!reader.file.good())
+        return false;
+
+    clear(reader.buffer);
+    clear(reader.spans);
+    reader.fileOffset = virtualOffset >> 16;
+    reader.skip = virtualOffset & 0xffff;    // the bytes before the virtual offset are dropped on reading
+    reader.atEof = false;
+    reader.ok = true;
+    return reader.file.seekg(reader.fileOffset).good();
+}
+
+}  // namespace seqan2
+
+#endif  // INCLUDE_SEQAN_STREAM_BINNING_INDEX_H_
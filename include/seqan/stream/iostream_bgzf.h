@@ -104,7 +104,6 @@ public:
     size_t                  numThreads;
     size_t                  numJobs;
     String<CompressionJob>  jobs;
-    TJobQueue               jobQueue;
     TJobQueue               idleQueue;
     Serializer<
         OutputBuffer,
@@ -112,60 +111,47 @@ public:
 
     size_t                  currentJobId;
     bool                    currentJobAvail;
+    std::atomic<bool>       compressionFailed;
 
-
-    struct CompressionThread
-    {
-        basic_bgzf_streambuf            *streamBuf;
-        CompressionContext<BgzfFile>    compressionCtx;
-        size_t                          threadNum;
-
-        void operator()()
-        {
-            ScopedReadLock<TJobQueue> readLock(streamBuf->jobQueue);
-            ScopedWriteLock<TJobQueue> writeLock(streamBuf->idleQueue);
-
-            // wait for a new job to become available
-            bool success = true;
-            while (success)
-            {
-                size_t jobId = -1;
-                if (!popFront(jobId, streamBuf->jobQueue))
-                    return;
-
-                CompressionJob &job = streamBuf->jobs[jobId];
-
-                // compress block with zlib
-                job.outputBuffer->size = _compressBlock(
-                    job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
-                    &job.buffer[0], job.size, compressionCtx);
-
-                success = releaseValue(streamBuf->serializer, job.outputBuffer);
-                appendValue(streamBuf->idleQueue, jobId);
-            }
-        }
-    };
-
-    // array of worker threads
-    using TFuture = decltype(std::async(CompressionThread{nullptr, CompressionContext<BgzfFile>{}, static_cast<size_t>(0)}));
-    std::vector<TFuture>         threads;
+    // the blocks are compressed by tasks of a work-stealing scheduler, which
+    // is either owned by the stream buffer or shared with other streams
+    std::unique_ptr<WorkStealingScheduler>  ownScheduler;
+    WorkStealingScheduler                   *scheduler;
+    TaskGroup                               taskGroup;
 
     basic_bgzf_streambuf(ostream_reference ostream_,
                          size_t numThreads = SEQAN_BGZF_NUM_THREADS,
                          size_t jobsPerThread = 8) :
         numThreads(numThreads),
         numJobs(numThreads * jobsPerThread),
-        jobQueue(numJobs),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numJobs),
+        compressionFailed(false),
+        ownScheduler(new WorkStealingScheduler(numThreads)),
+        scheduler(ownScheduler.get())
+    {
+        init();
+    }
+
+    basic_bgzf_streambuf(ostream_reference ostream_,
+                         WorkStealingScheduler & scheduler_,
+                         size_t jobsPerThread = 8) :
+        numThreads(std::max(seqan2::numThreads(scheduler_), static_cast<size_t>(1))),
+        numJobs(numThreads * jobsPerThread),
+        idleQueue(numJobs),
+        serializer(ostream_, numJobs),
+        compressionFailed(false),
+        scheduler(&scheduler_)
+    {
+        init();
+    }
+
+    void init()
     {
         resize(jobs, numJobs, Exact());
         currentJobId = 0;
 
-        lockWriting(jobQueue);
-        lockReading(idleQueue);
-        setReaderWriterCount(jobQueue, numThreads, 1);
-        setReaderWriterCount(idleQueue, 1, numThreads);
+        setReaderWriterCount(idleQueue, 1, 1);
 
         for (unsigned i = 0; i < numJobs; ++i)
         {
@@ -174,11 +160,6 @@ public:
             SEQAN_ASSERT(success);
         }
 
-        for (size_t i = 0; i < numThreads; ++i)
-        {
-            threads.push_back(std::async(std::launch::async, CompressionThread{this, CompressionContext<BgzfFile>{}, i}));
-        }
-
         currentJobAvail = popFront(currentJobId, idleQueue);
         SEQAN_ASSERT(currentJobAvail);
 
@@ -191,27 +172,75 @@ public:
     {
         // the buffer is now (after addFooter()) and flush will append the empty EOF marker
         flush(true);
+        wait(*scheduler, taskGroup);
 
-        unlockWriting(jobQueue);
+        unlockWriting(idleQueue);
         unlockReading(idleQueue);
     }
 
+    void compressJob(size_t jobId)
+    {
+        CompressionJob &job = jobs[jobId];
+        CompressionContext<BgzfFile> compressionCtx;
+
+        // compress block with zlib
+        try
+        {
+            job.outputBuffer->size = _compressBlock(
+                job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
+                &job.buffer[0], job.size, compressionCtx);
+        }
+        catch (IOError const &)
+        {
+            job.outputBuffer->size = 0;
+            compressionFailed.store(true, std::memory_order_release);
+        }
+
+        if (!releaseValue(serializer, job.outputBuffer))
+            compressionFailed.store(true, std::memory_order_release);
+        appendValue(idleQueue, jobId);
+    }
+
     bool compressBuffer(size_t size)
     {
         // submit current job
         if (currentJobAvail)
         {
             jobs[currentJobId].size = size;
-            appendValue(jobQueue, currentJobId);
+            size_t jobId = currentJobId;
+            spawn(*scheduler, taskGroup, [this, jobId] () { compressJob(jobId); });
+
+            // without worker threads the block is compressed right here
+            if (seqan2::numThreads(*scheduler) == 0)
+                wait(*scheduler, taskGroup);
+        }
+
+        // Recycle an idle job and an output buffer.  If all of them are in
+        // use, execute pending tasks until one job and one buffer are free
+        // instead of blocking, as this thread might be a worker of the same
+        // scheduler.  Waiting for the whole task group would drain the
+        // pipeline.  Only this thread takes jobs and buffers, so neither
+        // call below can block afterwards.
+        SpinDelay spinDelay;
+        while (empty(idleQueue) || empty(serializer.pool.recycled))
+        {
+            if (WorkStealingTask_ * task = _findTask(*scheduler))
+            {
+                _executeTask(*scheduler, task);
+                clear(spinDelay);
+            }
+            else
+            {
+                waitFor(spinDelay);
+            }
         }
 
-        // recycle existing idle job
         if (!(currentJobAvail = popFront(currentJobId, idleQueue)))
             return false;
 
         jobs[currentJobId].outputBuffer = aquireValue(serializer);
 
-        return serializer;
+        return serializer && !compressionFailed.load(std::memory_order_acquire);
     }
 
     int_type overflow(int_type c)
@@ -247,8 +276,8 @@ public:
             w = 0;
         }
 
-        // wait for running compressor threads
-        waitForMinSize(idleQueue, numJobs - 1);
+        // wait for running compression jobs (and help with them)
+        wait(*scheduler, taskGroup);
 
         serializer.worker.ostream.flush();
         return w;
@@ -302,7 +331,6 @@ public:
     typedef typename Tr::pos_type pos_type;
 
     typedef std::vector<char_type, char_allocator_type>     TBuffer;
-    typedef ConcurrentQueue<int, Suspendable<Limit> >       TJobQueue;
 
     static const size_t MAX_PUTBACK = 4;
 
@@ -327,7 +355,7 @@ public:
 
     Serializer serializer;
 
-    struct DecompressionJob
+    struct DecompressionJob : DecompressionJobBase_
     {
         typedef std::vector<byte_type, byte_allocator_type> TInputBuffer;
 
@@ -336,10 +364,6 @@ public:
         off_type                fileOfs;
         int                     size;
         unsigned                compressedSize;
-
-        std::mutex              cs;
-        std::condition_variable readyEvent;
-        std::atomic<bool>       ready;
         bool                    bgzfEofMarker;
 
         DecompressionJob() :
@@ -347,205 +371,102 @@ public:
             buffer(MAX_PUTBACK + BGZF_MAX_BLOCK_SIZE / sizeof(char_type), 0),
             fileOfs(),
             size(0),
-            cs(),
-            readyEvent(),
-            ready(true),
             bgzfEofMarker(false)
         {}
-
-        // TODO(rrahn): Do we need a copy constructor for the decompression job.
-        DecompressionJob(DecompressionJob const &other) :
-            inputBuffer(other.inputBuffer),
-            buffer(other.buffer),
-            fileOfs(other.fileOfs),
-            size(other.size),
-            cs(),
-            readyEvent(),
-            ready(other.ready.load()),
-            bgzfEofMarker(other.bgzfEofMarker)
-        {}
     };
 
-    // string of recycable jobs
-    size_t                      numThreads;
-    size_t                      numJobs;
-    String<DecompressionJob>    jobs;
-    TJobQueue                   runningQueue;
-    TJobQueue                   todoQueue;
+    typedef DecompressionPipeline_<basic_unbgzf_streambuf, DecompressionJob, CompressionContext<BgzfFile> > TPipeline;
+
+    // recycable jobs and worker threads
+    TPipeline                   pipeline;
     int                         currentJobId;
+    TBuffer                     putbackBuffer;
 
-    struct DecompressionThread
+    basic_unbgzf_streambuf(istream_reference istream_,
+                           size_t numThreads = SEQAN_BGZF_NUM_THREADS,
+                           size_t jobsPerThread = 8) :
+        serializer(istream_),
+        pipeline(numThreads, numThreads * jobsPerThread),
+        currentJobId(-1),
+        putbackBuffer(MAX_PUTBACK)
     {
-        basic_unbgzf_streambuf          *streamBuf;
-        CompressionContext<BgzfFile>    compressionCtx;
-
-        void operator()()
-        {
-            ScopedReadLock<TJobQueue> readLock(streamBuf->todoQueue);
-            ScopedWriteLock<TJobQueue> writeLock(streamBuf->runningQueue);
-
-            // wait for a new job to become available
-            while (true)
-            {
-                int jobId = -1;
-                if (!popFront(jobId, streamBuf->todoQueue))
-                    return;
+        pipeline.start(*this, numThreads);
+    }
 
-                DecompressionJob &job = streamBuf->jobs[jobId];
-                size_t tailLen = 0;
+    // reads the next block into the job, called by the pipeline under serializer.lock
+    bool loadJob(DecompressionJob & job)
+    {
+        job.bgzfEofMarker = false;
 
-                // typically the idle queue contains only ready jobs
-                // however, if seek() fast forwards running jobs into the todoQueue
-                // the caller defers the task of waiting to the decompression threads
-                if (!job.ready)
-                {
-                    std::unique_lock<std::mutex> lock(job.cs);
-                    job.readyEvent.wait(lock, [&job]{return job.ready.load();});
-                    SEQAN_ASSERT_EQ(job.ready, true);
-                }
+        // remember start offset (for tellg later)
+        job.fileOfs = serializer.fileOfs;
+        job.size = -1;
+        job.compressedSize = 0;
 
-                {
-                    std::lock_guard<std::mutex> scopedLock(streamBuf->serializer.lock);
+        // only load if not at EOF
+        if (job.fileOfs == -1)
+            return true;
 
-                    job.bgzfEofMarker = false;
-                    if (streamBuf->serializer.error != NULL)
-                        return;
+        // read header
+        serializer.istream.read((char*)&job.inputBuffer[0], BGZF_BLOCK_HEADER_LENGTH);
 
-                    // remember start offset (for tellg later)
-                    job.fileOfs = streamBuf->serializer.fileOfs;
-                    job.size = -1;
-                    job.compressedSize = 0;
+        if (!serializer.istream.good())
+        {
+            serializer.fileOfs = -1;
+            if (serializer.istream.eof())
+                goto eofSkip;
+            serializer.error = new IOError("Stream read error.");
+            return false;
+        }
 
-                    // only load if not at EOF
-                    if (job.fileOfs != -1)
-                    {
-                        // read header
-                        streamBuf->serializer.istream.read(
-                            (char*)&job.inputBuffer[0],
-                            BGZF_BLOCK_HEADER_LENGTH);
-
-                        if (!streamBuf->serializer.istream.good())
-                        {
-                            streamBuf->serializer.fileOfs = -1;
-                            if (streamBuf->serializer.istream.eof())
-                                goto eofSkip;
-                            streamBuf->serializer.error = new IOError("Stream read error.");
-                            return;
-                        }
-
-                        // check header
-                        if (!_bgzfCheckHeader(&job.inputBuffer[0]))
-                        {
-                            streamBuf->serializer.fileOfs = -1;
-                            streamBuf->serializer.error = new IOError("Invalid BGZF block header.");
-                            return;
-                        }
-
-                        // extract length of compressed data
-                        tailLen = _bgzfUnpack16(&job.inputBuffer[0] + 16) + 1u - BGZF_BLOCK_HEADER_LENGTH;
-
-                        // read compressed data and tail
-                        streamBuf->serializer.istream.read(
-                            (char*)&job.inputBuffer[0] + BGZF_BLOCK_HEADER_LENGTH,
-                            tailLen);
-
-                        // Check if end-of-file marker is set
-                        if (memcmp(reinterpret_cast<uint8_t const *>(&job.inputBuffer[0]),
-                                   reinterpret_cast<uint8_t const *>(&BGZF_END_OF_FILE_MARKER[0]),
-                                   28) == 0)
-                        {
-                            job.bgzfEofMarker = true;
-                        }
-
-                        if (!streamBuf->serializer.istream.good())
-                        {
-                            streamBuf->serializer.fileOfs = -1;
-                            if (streamBuf->serializer.istream.eof())
-                                goto eofSkip;
-                            streamBuf->serializer.error = new IOError("Stream read error.");
-                            return;
-                        }
-
-                        job.compressedSize = BGZF_BLOCK_HEADER_LENGTH + tailLen;
-                        streamBuf->serializer.fileOfs += job.compressedSize;
-                        job.ready = false;
-
-                    eofSkip:
-                        streamBuf->serializer.istream.clear(
-                            streamBuf->serializer.istream.rdstate() & ~std::ios_base::failbit);
-                    }
+        // check header
+        if (!_bgzfCheckHeader(&job.inputBuffer[0]))
+        {
+            serializer.fileOfs = -1;
+            serializer.error = new IOError("Invalid BGZF block header.");
+            return false;
+        }
 
-                    if (!appendValue(streamBuf->runningQueue, jobId))
-                    {
-                        // signal that job is ready
-                        {
-                            std::unique_lock<std::mutex> lock(job.cs);
-                            job.ready = true;
-                        }
-                        job.readyEvent.notify_all();
-                        return;  // Terminate this thread.
-                    }
-                }
+        {
+            // extract length of compressed data
+            size_t tailLen = _bgzfUnpack16(&job.inputBuffer[0] + 16) + 1u - BGZF_BLOCK_HEADER_LENGTH;
 
-                if (!job.ready)
-                {
-                    // decompress block
-                    auto decompressed_size = _decompressBlock(
-                        &job.buffer[0] + MAX_PUTBACK, capacity(job.buffer),
-                        &job.inputBuffer[0], job.compressedSize, compressionCtx);
+            // read compressed data and tail
+            serializer.istream.read((char*)&job.inputBuffer[0] + BGZF_BLOCK_HEADER_LENGTH, tailLen);
 
-                    // signal that job is ready
-                    {
-                        std::unique_lock<std::mutex> lock(job.cs);
-                        job.size = decompressed_size;
-                        job.ready = true;
-                    }
-                    job.readyEvent.notify_all();
-                }
+            // Check if end-of-file marker is set
+            if (memcmp(reinterpret_cast<uint8_t const *>(&job.inputBuffer[0]),
+                       reinterpret_cast<uint8_t const *>(&BGZF_END_OF_FILE_MARKER[0]),
+                       28) == 0)
+            {
+                job.bgzfEofMarker = true;
             }
-        }
-    };
 
-    // array of worker threads
-    using TFuture = decltype(std::async(DecompressionThread{nullptr, CompressionContext<BgzfFile>{}}));
-    std::vector<TFuture> threads;
-    TBuffer              putbackBuffer;
-
-    basic_unbgzf_streambuf(istream_reference istream_,
-                           size_t numThreads = SEQAN_BGZF_NUM_THREADS,
-                           size_t jobsPerThread = 8) :
-        serializer(istream_),
-        numThreads(numThreads),
-        numJobs(numThreads * jobsPerThread),
-        runningQueue(numJobs),
-        todoQueue(numJobs),
-        putbackBuffer(MAX_PUTBACK)
-    {
-        resize(jobs, numJobs, Exact());
-        currentJobId = -1;
-
-        lockReading(runningQueue);
-        lockWriting(todoQueue);
-        setReaderWriterCount(runningQueue, 1, numThreads);
-        setReaderWriterCount(todoQueue, numThreads, 1);
+            if (!serializer.istream.good())
+            {
+                serializer.fileOfs = -1;
+                if (serializer.istream.eof())
+                    goto eofSkip;
+                serializer.error = new IOError("Stream read error.");
+                return false;
+            }
 
-        for (unsigned i = 0; i < numJobs; ++i)
-        {
-            bool success = appendValue(todoQueue, i);
-            ignoreUnusedVariableWarning(success);
-            SEQAN_ASSERT(success);
+            job.compressedSize = BGZF_BLOCK_HEADER_LENGTH + tailLen;
+            serializer.fileOfs += job.compressedSize;
+            job.ready = false;
         }
 
-        for (unsigned i = 0; i < numThreads; ++i)
-        {
-            threads.push_back(std::async(std::launch::async, DecompressionThread{this, CompressionContext<BgzfFile>{}}));
-        }
+    eofSkip:
+        serializer.istream.clear(serializer.istream.rdstate() & ~std::ios_base::failbit);
+        return true;
     }
 
-    ~basic_unbgzf_streambuf()
+    // decompresses the block of a loaded job, called by the pipeline
+    void decompressJob(DecompressionJob & job, CompressionContext<BgzfFile> & compressionCtx)
     {
-        unlockWriting(todoQueue);
-        unlockReading(runningQueue);
+        job.size = _decompressBlock(
+            &job.buffer[0] + MAX_PUTBACK, capacity(job.buffer),
+            &job.inputBuffer[0], job.compressedSize, compressionCtx);
     }
 
     int_type underflow()
@@ -566,20 +487,20 @@ public:
                 &putbackBuffer[0]);
 
         if (currentJobId >= 0)
-            appendValue(todoQueue, currentJobId);
+            pipeline.recycle(currentJobId);
 
         while (true)
         {
-            if (!popFront(currentJobId, runningQueue))
+            // wait for the end of decompression
+            if (!pipeline.pop(currentJobId))
             {
-                currentJobId = -1;
                 SEQAN_ASSERT(serializer.error != NULL);
                 if (serializer.error != NULL)
                     throw *serializer.error;
                 return EOF;
             }
 
-            DecompressionJob &job = jobs[currentJobId];
+            DecompressionJob &job = pipeline.jobs[currentJobId];
 
             // restore putback buffer
             this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
@@ -589,12 +510,6 @@ public:
                     &putbackBuffer[0] + putback,
                     &job.buffer[0] + (MAX_PUTBACK - putback));
 
-            // wait for the end of decompression
-            {
-                std::unique_lock<std::mutex> lock(job.cs);
-                job.readyEvent.wait(lock, [&job]{return job.ready.load();});
-            }
-
             size_t size = (job.size != -1)? job.size : 0;
 
             // reset buffer pointers
@@ -631,7 +546,7 @@ public:
 
                 if (currentJobId >= 0 && ofs <= this->egptr() - this->gptr())
                 {
-                    DecompressionJob &job = jobs[currentJobId];
+                    DecompressionJob &job = pipeline.jobs[currentJobId];
 
                     // reset buffer pointers
                     this->setg(
@@ -652,9 +567,9 @@ public:
                 std::streampos destFileOfs = ofs >> 16;
 
                 // are we in the same block?
-                if (currentJobId >= 0 && jobs[currentJobId].fileOfs == (off_type)destFileOfs)
+                if (currentJobId >= 0 && pipeline.jobs[currentJobId].fileOfs == (off_type)destFileOfs)
                 {
-                    DecompressionJob &job = jobs[currentJobId];
+                    DecompressionJob &job = pipeline.jobs[currentJobId];
 
                     // reset buffer pointers
                     this->setg(
@@ -672,30 +587,30 @@ public:
                     // find our seek target
 
                     if (currentJobId >= 0)
-                        appendValue(todoQueue, currentJobId);
+                        pipeline.recycle(currentJobId);
 
                     // Note that if we are here the current job does not represent the sought block.
                     // Hence if the running queue is empty we need to explicitly unset the jobId,
                     // otherwise we would not update the serializers istream pointer to the correct position.
-                    if (empty(runningQueue))
+                    if (empty(pipeline.runningQueue))
                         currentJobId = -1;
 
                     // empty is thread-safe in serializer.lock
-                    while (!empty(runningQueue))
+                    while (!empty(pipeline.runningQueue))
                     {
-                        popFront(currentJobId, runningQueue);
+                        popFront(currentJobId, pipeline.runningQueue);
 
-                        if (jobs[currentJobId].fileOfs == (off_type)destFileOfs)
+                        if (pipeline.jobs[currentJobId].fileOfs == (off_type)destFileOfs)
                             break;
 
                         // push back useless job
-                        appendValue(todoQueue, currentJobId);
+                        pipeline.recycle(currentJobId);
                         currentJobId = -1;
                     }
 
                     if (currentJobId == -1)
                     {
-                        SEQAN_ASSERT(empty(runningQueue));
+                        SEQAN_ASSERT(empty(pipeline.runningQueue));
                         serializer.istream.clear(serializer.istream.rdstate() & ~std::ios_base::eofbit);
                         if (serializer.istream.rdbuf()->pubseekpos(destFileOfs, std::ios_base::in) == destFileOfs)
                             serializer.fileOfs = destFileOfs;
@@ -707,19 +622,15 @@ public:
                 // if our block wasn't in the running queue yet, it should now
                 // be the first that falls out after modifying serializer.fileOfs
                 if (currentJobId == -1)
-                    popFront(currentJobId, runningQueue);
+                    popFront(currentJobId, pipeline.runningQueue);
                 else if (currentJobId == -2)
                     currentJobId = -1;
 
                 if (currentJobId >= 0)
                 {
                     // wait for the end of decompression
-                    DecompressionJob &job = jobs[currentJobId];
-
-                    {
-                        std::unique_lock<std::mutex> lock(job.cs);
-                        job.readyEvent.wait(lock, [&job]{return job.ready.load();});
-                    }
+                    DecompressionJob &job = pipeline.jobs[currentJobId];
+                    TPipeline::waitFor(job);
 
                     SEQAN_ASSERT_EQ(job.fileOfs, (off_type)destFileOfs);
 
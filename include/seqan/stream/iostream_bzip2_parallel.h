@@ -0,0 +1,611 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Parallel decompression of bzip2 files.
+//
+// The blocks of a bzip2 stream are compressed independently and start with
+// a 48 bit magic number, but they are not byte aligned. The reader scans the
+// input for the block and end-of-stream magic numbers, shifts every block
+// into a stand-alone single-block bzip2 stream and lets worker threads
+// decompress them. The decompressed blocks are handed to the reader in order
+// by the DecompressionPipeline_ shared with basic_unbgzf_streambuf.
+//
+// The magic numbers can also occur inside the compressed data. A block that
+// was cut at such a false magic number fails to decompress (the block CRC is
+// checked) and is merged with the following piece and decompressed again.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_STREAM_IOSTREAM_BZIP2_PARALLEL_H_
+#define INCLUDE_SEQAN_STREAM_IOSTREAM_BZIP2_PARALLEL_H_
+
+// Decompress bzip2 input with multiple threads, see basic_bzip2_parallel_istream.
+#ifndef SEQAN_BZIP2_PARALLEL
+#define SEQAN_BZIP2_PARALLEL 1
+#endif
+
+#ifndef SEQAN_BZIP2_NUM_THREADS
+#define SEQAN_BZIP2_NUM_THREADS 8
+#endif
+
+namespace seqan2 {
+
+// ===========================================================================
+// Constants
+// ===========================================================================
+
+// BCD encoded pi and sqrt(pi)
+const uint64_t BZIP2_BLOCK_MAGIC = 0x314159265359ull;
+const uint64_t BZIP2_EOS_MAGIC = 0x177245385090ull;
+const unsigned BZIP2_MAGIC_BITS = 48;
+const unsigned BZIP2_HEADER_LENGTH = 4;
+
+// A compressed bzip2 block with at most 900k symbols is always smaller than this.
+const size_t BZIP2_MAX_PIECE_SIZE = 2 * 1024 * 1024;
+
+const size_t BZIP2_READ_SIZE = 1024 * 1024;
+
+// ===========================================================================
+// Functions
+// ===========================================================================
+
+// --------------------------------------------------------------------------
+// Function _bzip2AppendBits()
+// --------------------------------------------------------------------------
+
+// Appends numBits bits of src beginning at bit srcOfs to the dstBits bits in dst (most significant bit first).
+template <typename TBytes>
+inline void
+_bzip2AppendBits(TBytes & dst, uint64_t & dstBits, unsigned char const * src, uint64_t srcOfs, uint64_t numBits)
+{
+    if (numBits == 0)
+        return;
+
+    dst.resize((dstBits + numBits + 7) / 8, 0);
+    unsigned char * out = reinterpret_cast<unsigned char *>(&dst[0]);
+    src += srcOfs / 8;
+    srcOfs %= 8;
+
+    if (dstBits % 8 == 0)
+    {
+        // byte aligned output, copy byte-wise
+        out += dstBits / 8;
+        size_t numBytes = (numBits + 7) / 8;
+        size_t lastSrcByte = (srcOfs + numBits - 1) / 8;
+        if (srcOfs == 0)
+            std::copy(src, src + numBytes, out);
+        else
+            for (size_t i = 0; i < numBytes; ++i)
+                out[i] = static_cast<unsigned char>((src[i] << srcOfs) |
+                                                    ((i < lastSrcByte) ? (src[i + 1] >> (8 - srcOfs)) : 0));
+    }
+    else
+    {
+        for (uint64_t i = 0; i < numBits; ++i)
+        {
+            uint64_t outPos = dstBits + i;
+            if ((src[(srcOfs + i) / 8] >> (7 - (srcOfs + i) % 8)) & 1)
+                out[outPos / 8] |= static_cast<unsigned char>(0x80 >> (outPos % 8));
+            else
+                out[outPos / 8] &= static_cast<unsigned char>(~(0x80 >> (outPos % 8)));
+        }
+    }
+
+    dstBits += numBits;
+    if (dstBits % 8 != 0)
+        dst[dstBits / 8] &= static_cast<unsigned char>(0xff << (8 - dstBits % 8));
+}
+
+template <typename TBytes>
+inline void
+_bzip2AppendBits(TBytes & dst, uint64_t & dstBits, uint64_t value, unsigned numBits)
+{
+    unsigned char bytes[8];
+    for (unsigned i = 0; i < 8; ++i)
+        bytes[i] = static_cast<unsigned char>(value >> (56 - 8 * i));
+    _bzip2AppendBits(dst, dstBits, bytes, 64 - numBits, numBits);
+}
+
+// --------------------------------------------------------------------------
+// Function _bzip2PieceCrc()
+// --------------------------------------------------------------------------
+
+// Returns the CRC that follows the block or end-of-stream magic number at the beginning of a piece.
+template <typename TBytes>
+inline uint32_t
+_bzip2PieceCrc(TBytes const & piece, uint64_t numBits)
+{
+    uint32_t crc = 0;
+    for (unsigned i = 0; i < 4 && numBits >= BZIP2_MAGIC_BITS + 32; ++i)
+        crc = (crc << 8) | static_cast<unsigned char>(piece[BZIP2_MAGIC_BITS / 8 + i]);
+    return crc;
+}
+
+// --------------------------------------------------------------------------
+// Function _bzip2FindMagic()
+// --------------------------------------------------------------------------
+
+// Returns the first bit position >= from where a block or end-of-stream magic number begins, or
+// the number of bits if there is none.
+inline uint64_t
+_bzip2FindMagic(bool & eos, unsigned char const * data, uint64_t numBits, uint64_t from)
+{
+    const uint64_t MASK = (1ull << BZIP2_MAGIC_BITS) - 1;
+    uint64_t window = 0;
+    for (uint64_t b = from / 8; 8 * b + 8 <= numBits; ++b)
+    {
+        window = (window << 8) | data[b];
+        // check the magic numbers ending at the 8 bits of this byte, the leftmost first
+        for (int shift = 7; shift >= 0; --shift)
+        {
+            uint64_t candidate = (window >> shift) & MASK;
+            if ((candidate != BZIP2_BLOCK_MAGIC && candidate != BZIP2_EOS_MAGIC) ||
+                8 * b + 8 < BZIP2_MAGIC_BITS + shift || 8 * b + 8 - shift - BZIP2_MAGIC_BITS < from)
+                continue;
+            uint64_t begin = 8 * b + 8 - shift - BZIP2_MAGIC_BITS;
+            eos = (candidate == BZIP2_EOS_MAGIC);
+            return begin;
+        }
+    }
+    return numBits;
+}
+
+// --------------------------------------------------------------------------
+// Function _bzip2DecompressBlock()
+// --------------------------------------------------------------------------
+
+// Decompresses a whole bzip2 stream into buffer beginning at ofs, the buffer grows if necessary.
+// Returns false if the stream is invalid or incomplete.
+template <typename TBuffer, typename TBytes>
+inline bool
+_bzip2DecompressBlock(TBuffer & buffer, size_t ofs, size_t & size, TBytes & input)
+{
+    bz_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    size = 0;
+    if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK)
+        return false;
+
+    stream.next_in = reinterpret_cast<char *>(&input[0]);
+    stream.avail_in = input.size();
+
+    int err = BZ_OK;
+    while (err == BZ_OK)
+    {
+        if (buffer.size() < ofs + size + BZIP2_READ_SIZE)
+            buffer.resize(ofs + size + BZIP2_READ_SIZE);
+
+        stream.next_out = reinterpret_cast<char *>(&buffer[ofs + size]);
+        stream.avail_out = buffer.size() - ofs - size;
+        unsigned avail = stream.avail_out;
+        err = BZ2_bzDecompress(&stream);
+        size += avail - stream.avail_out;
+
+        // no progress and no input left means the stream is truncated
+        if (err == BZ_OK && stream.avail_in == 0 && stream.avail_out != 0)
+            err = BZ_UNEXPECTED_EOF;
+    }
+
+    BZ2_bzDecompressEnd(&stream);
+    return err == BZ_STREAM_END;
+}
+
+// ===========================================================================
+// Classes
+// ===========================================================================
+
+// --------------------------------------------------------------------------
+// Class basic_unbzip2_parallel_streambuf
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_unbzip2_parallel_streambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>& istream_reference;
+    typedef ElemA char_allocator_type;
+    typedef ByteT byte_type;
+    typedef ByteAT byte_allocator_type;
+    typedef typename Tr::char_type char_type;
+    typedef typename Tr::int_type int_type;
+
+    typedef std::vector<char_type, char_allocator_type>     TBuffer;
+    typedef std::vector<byte_type, byte_allocator_type>     TInputBuffer;
+
+    static_assert(sizeof(char_type) == 1, "The parallel bzip2 stream only supports byte-sized characters.");
+
+    static const size_t MAX_PUTBACK = 4;
+
+    // Cuts the compressed input into pieces, each beginning with a magic number.
+    struct Serializer
+    {
+        istream_reference   istream;
+        std::mutex          lock;
+        IOError             *error;
+
+        TInputBuffer        input;          // compressed input, beginning with the next piece
+        uint64_t            pieceBegin;     // bit position of the next piece in input
+        bool                pieceEos;       // the next piece begins with an end-of-stream magic
+        bool                started;
+        bool                atEnd;
+
+        Serializer(istream_reference istream) :
+            istream(istream),
+            error(NULL),
+            pieceBegin(0),
+            pieceEos(false),
+            started(false),
+            atEnd(false)
+        {}
+
+        ~Serializer()
+        {
+            delete error;
+        }
+
+        // appends the next chunk of the compressed input, returns false at the end of the input
+        bool fill()
+        {
+            if (!istream.good())
+                return false;
+            size_t size = input.size();
+            input.resize(size + BZIP2_READ_SIZE);
+            istream.read(reinterpret_cast<char *>(&input[size]), BZIP2_READ_SIZE);
+            input.resize(size + istream.gcount());
+            if (istream.bad())
+                error = new IOError("Stream read error.");
+            return istream.gcount() != 0;
+        }
+
+        uint64_t findMagic(bool & eos, uint64_t from)
+        {
+            while (true)
+            {
+                uint64_t pos = _bzip2FindMagic(eos, reinterpret_cast<unsigned char const *>(&input[0]),
+                                               8 * input.size(), from);
+                if (pos != 8 * input.size())
+                    return pos;
+                // continue the search where a magic number can begin in the new data
+                from = std::max(from, pos >= BZIP2_MAGIC_BITS ? pos - BZIP2_MAGIC_BITS + 1 : 0);
+                if (input.size() > BZIP2_MAX_PIECE_SIZE + pieceBegin / 8 || !fill())
+                    return 8 * input.size();
+            }
+        }
+
+        // copies the next piece into the job, returns false at the end of the input or on errors
+        bool readPiece(TInputBuffer & piece, uint64_t & numBits, bool & eos)
+        {
+            if (!started)
+            {
+                started = true;
+                while (input.size() < BZIP2_HEADER_LENGTH && fill()) {}
+                if (input.size() < BZIP2_HEADER_LENGTH || input[0] != 'B' || input[1] != 'Z' || input[2] != 'h' ||
+                    input[3] < '1' || input[3] > '9')
+                {
+                    if (error == NULL)
+                        error = new IOError("Invalid bzip2 header.");
+                    return false;
+                }
+                pieceBegin = findMagic(pieceEos, 8 * BZIP2_HEADER_LENGTH);
+            }
+
+            if (error != NULL || pieceBegin >= 8 * input.size())
+                return false;
+
+            bool nextEos = false;
+            uint64_t pieceEnd = findMagic(nextEos, pieceBegin + BZIP2_MAGIC_BITS);
+            if (error != NULL)
+                return false;
+            if (pieceEnd - pieceBegin > 8 * BZIP2_MAX_PIECE_SIZE)
+            {
+                error = new IOError("Invalid bzip2 block.");
+                return false;
+            }
+
+            piece.clear();
+            numBits = 0;
+            _bzip2AppendBits(piece, numBits, reinterpret_cast<unsigned char const *>(&input[0]), pieceBegin,
+                             pieceEnd - pieceBegin);
+            eos = pieceEos;
+
+            // drop the consumed input
+            size_t consumed = pieceEnd / 8;
+            input.erase(input.begin(), input.begin() + consumed);
+            pieceBegin = pieceEnd - 8 * consumed;
+            pieceEos = nextEos;
+            return true;
+        }
+    };
+
+    Serializer serializer;
+
+    struct DecompressionJob : DecompressionJobBase_
+    {
+        TInputBuffer            inputBuffer;    // the bits of the piece
+        uint64_t                numBits;
+        TInputBuffer            block;          // the piece as a stand-alone bzip2 stream
+        TBuffer                 buffer;
+        int                     size;           // -1 at the end of the input
+        bool                    eos;            // the piece is an end-of-stream marker and has no data
+        bool                    failed;
+
+        DecompressionJob() :
+            numBits(0),
+            buffer(MAX_PUTBACK, 0),
+            size(0),
+            eos(false),
+            failed(false)
+        {}
+
+        void decompress()
+        {
+            size_t decompressedSize = 0;
+            failed = false;
+            if (!eos)
+            {
+                // frame the block with a stream header and an end-of-stream marker, the stream CRC of a
+                // single-block stream is the block CRC that follows the block magic
+                uint32_t crc = _bzip2PieceCrc(inputBuffer, numBits);
+
+                uint64_t blockBits = 0;
+                block.clear();
+                _bzip2AppendBits(block, blockBits, 0x425a6839ull, 32);     // "BZh9"
+                _bzip2AppendBits(block, blockBits, reinterpret_cast<unsigned char const *>(&inputBuffer[0]), 0,
+                                 numBits);
+                _bzip2AppendBits(block, blockBits, BZIP2_EOS_MAGIC, BZIP2_MAGIC_BITS);
+                _bzip2AppendBits(block, blockBits, crc, 32);
+
+                failed = !_bzip2DecompressBlock(buffer, MAX_PUTBACK, decompressedSize, block);
+            }
+            size = static_cast<int>(decompressedSize);
+        }
+    };
+
+    typedef DecompressionPipeline_<basic_unbzip2_parallel_streambuf, DecompressionJob, Nothing> TPipeline;
+
+    // recycable jobs and worker threads
+    TPipeline                   pipeline;
+    int                         currentJobId;
+    uint32_t                    streamCrc;      // combined CRC of the blocks of the current stream
+    TBuffer                     putbackBuffer;
+
+    basic_unbzip2_parallel_streambuf(istream_reference istream_,
+                                     size_t numThreads = SEQAN_BZIP2_NUM_THREADS,
+                                     size_t jobsPerThread = 2) :
+        serializer(istream_),
+        pipeline(std::max(numThreads, (size_t)1),
+                 std::max(numThreads, (size_t)1) * std::max(jobsPerThread, (size_t)1)),
+        currentJobId(-1),
+        streamCrc(0),
+        putbackBuffer(MAX_PUTBACK)
+    {
+        pipeline.start(*this, std::max(numThreads, (size_t)1));
+    }
+
+    // reads the next piece into the job, called by the pipeline under serializer.lock
+    bool loadJob(DecompressionJob & job)
+    {
+        job.size = -1;
+        if (serializer.readPiece(job.inputBuffer, job.numBits, job.eos))
+            job.ready = false;
+        return serializer.error == NULL;
+    }
+
+    // decompresses the piece of a loaded job, called by the pipeline
+    void decompressJob(DecompressionJob & job, Nothing &)
+    {
+        job.decompress();
+    }
+
+    int_type underflow()
+    {
+        // no need to use the next buffer?
+        if (this->gptr() && this->gptr() < this->egptr())
+            return Tr::to_int_type(*this->gptr());
+
+        size_t putback = this->gptr() - this->eback();
+        if (putback > MAX_PUTBACK)
+            putback = MAX_PUTBACK;
+
+        // save at most MAX_PUTBACK characters from previous page to putback buffer
+        if (putback != 0)
+            std::copy(
+                this->gptr() - putback,
+                this->gptr(),
+                &putbackBuffer[0]);
+
+        if (currentJobId >= 0)
+            pipeline.recycle(currentJobId);
+
+        while (true)
+        {
+            // wait for the end of decompression
+            if (!pipeline.pop(currentJobId))
+            {
+                SEQAN_ASSERT(serializer.error != NULL);
+                if (serializer.error != NULL)
+                    throw *serializer.error;
+                return EOF;
+            }
+
+            DecompressionJob &job = pipeline.jobs[currentJobId];
+
+            if (job.failed)
+                mergeFailedJob(job);
+
+            if (job.size != -1 && !checkStreamCrc(job))
+                throw IOError("bzip2 stream CRC mismatch.");
+
+            // skip the end-of-stream markers between concatenated streams
+            if (job.size == 0)
+            {
+                pipeline.recycle(currentJobId);
+                continue;
+            }
+
+            size_t size = (job.size != -1)? job.size : 0;
+
+            // restore putback buffer
+            if (putback != 0)
+                std::copy(
+                    &putbackBuffer[0],
+                    &putbackBuffer[0] + putback,
+                    &job.buffer[0] + (MAX_PUTBACK - putback));
+
+            // reset buffer pointers
+            this->setg(
+                  &job.buffer[0] + (MAX_PUTBACK - putback),     // beginning of putback area
+                  &job.buffer[0] + MAX_PUTBACK,                 // read position
+                  &job.buffer[0] + (MAX_PUTBACK + size));       // end of buffer
+
+            if (job.size == -1)
+                return EOF;
+            return Tr::to_int_type(*this->gptr());          // return next character
+        }
+    }
+
+    // returns the compressed input istream
+    istream_reference get_istream()    { return serializer.istream; };
+
+private:
+    // Combines the block CRCs as bzip2 does and compares them with the CRC at the end of each stream.
+    bool checkStreamCrc(DecompressionJob const &job)
+    {
+        uint32_t crc = _bzip2PieceCrc(job.inputBuffer, job.numBits);
+        if (!job.eos)
+        {
+            streamCrc = ((streamCrc << 1) | (streamCrc >> 31)) ^ crc;
+            return true;
+        }
+        bool match = (job.numBits >= BZIP2_MAGIC_BITS + 32 && crc == streamCrc);
+        streamCrc = 0;
+        return match;
+    }
+
+    // The piece was cut at a false magic number, append the following pieces until it can be decompressed.
+    void mergeFailedJob(DecompressionJob &job)
+    {
+        while (job.failed)
+        {
+            int nextJobId = -1;
+            if (job.inputBuffer.size() > BZIP2_MAX_PIECE_SIZE || !pipeline.pop(nextJobId))
+                throw IOError("Invalid bzip2 block.");
+
+            DecompressionJob &next = pipeline.jobs[nextJobId];
+
+            bool atEnd = (next.size == -1);
+            if (!atEnd)
+                _bzip2AppendBits(job.inputBuffer, job.numBits,
+                                 reinterpret_cast<unsigned char const *>(&next.inputBuffer[0]), 0, next.numBits);
+            pipeline.recycle(nextJobId);
+            if (atEnd)
+                throw IOError("Invalid bzip2 block.");
+
+            job.decompress();
+        }
+    }
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bzip2_parallel_istreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_bzip2_parallel_istreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>&                                       istream_reference;
+    typedef basic_unbzip2_parallel_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>    unbzip2_streambuf_type;
+
+    basic_bzip2_parallel_istreambase(istream_reference istream_, size_t numThreads, size_t jobsPerThread)
+        : m_buf(istream_, numThreads, jobsPerThread)
+    {
+        this->init(&m_buf);
+    };
+
+    // returns the underlying unzip istream object
+    unbzip2_streambuf_type* rdbuf() { return &m_buf; };
+
+private:
+    unbzip2_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_bzip2_parallel_istream
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_bzip2_parallel_istream :
+    public basic_bzip2_parallel_istreambase<Elem,Tr,ElemA,ByteT,ByteAT>,
+    public std::basic_istream<Elem,Tr>
+{
+public:
+    typedef basic_bzip2_parallel_istreambase<Elem,Tr,ElemA,ByteT,ByteAT>    bzip2_istreambase_type;
+    typedef std::basic_istream<Elem,Tr>                                     istream_type;
+    typedef istream_type &                                                  istream_reference;
+
+    basic_bzip2_parallel_istream(istream_reference istream_,
+                                 size_t numThreads = SEQAN_BZIP2_NUM_THREADS,
+                                 size_t jobsPerThread = 2) :
+        bzip2_istreambase_type(istream_, numThreads, jobsPerThread),
+        istream_type(bzip2_istreambase_type::rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+typedef basic_bzip2_parallel_istream<char> bzip2_parallel_istream;
+
+}  // namespace seqan2
+
+#endif  // INCLUDE_SEQAN_STREAM_IOSTREAM_BZIP2_PARALLEL_H_
@@ -0,0 +1,221 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Decompresses the blocks of a stream with multiple threads and hands them
+// to the reader in input order.
+//
+// The worker threads take idle jobs from the todo queue, load the next
+// block under the serializer lock and append the job to the running queue
+// before they decompress it, so that the running queue keeps the order of
+// the input. The reader pops the jobs from the running queue, waits until
+// they are ready and returns them to the todo queue when it is done with
+// them. Used by basic_unbgzf_streambuf and
+// basic_unbzip2_parallel_streambuf.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_STREAM_IOSTREAM_DECOMPRESSION_PIPELINE_H_
+#define INCLUDE_SEQAN_STREAM_IOSTREAM_DECOMPRESSION_PIPELINE_H_
+
+namespace seqan2 {
+
+// ===========================================================================
+// Classes
+// ===========================================================================
+
+// --------------------------------------------------------------------------
+// Class DecompressionJobBase_
+// --------------------------------------------------------------------------
+
+// The synchronization of a job between the worker decompressing it and the reader.
+struct DecompressionJobBase_
+{
+    std::mutex              cs;
+    std::condition_variable readyEvent;
+    std::atomic<bool>       ready;
+
+    DecompressionJobBase_() :
+        cs(),
+        readyEvent(),
+        ready(true)
+    {}
+
+    DecompressionJobBase_(DecompressionJobBase_ const & other) :
+        cs(),
+        readyEvent(),
+        ready(other.ready.load())
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Class DecompressionPipeline_
+// --------------------------------------------------------------------------
+
+// TStreamBuf has a member serializer with a mutex lock and a pointer error, which is set on errors, and the functions
+//
+//   bool loadJob(TJob & job);                      // loads the next block under the serializer lock and sets
+//                                                  // job.ready to false if it has to be decompressed, returns false
+//                                                  // if the worker has to stop
+//   void decompressJob(TJob & job, TContext & ctx);
+//
+// TJob is derived from DecompressionJobBase_ and TContext is the per thread state of the decompression.
+template <typename TStreamBuf, typename TJob, typename TContext>
+class DecompressionPipeline_
+{
+public:
+    typedef ConcurrentQueue<int, Suspendable<Limit> >   TJobQueue;
+
+    struct DecompressionThread
+    {
+        DecompressionPipeline_  *pipeline;
+        TStreamBuf              *streamBuf;
+        TContext                context;
+
+        void operator()()
+        {
+            ScopedReadLock<TJobQueue> readLock(pipeline->todoQueue);
+            ScopedWriteLock<TJobQueue> writeLock(pipeline->runningQueue);
+
+            // wait for a new job to become available
+            while (true)
+            {
+                int jobId = -1;
+                if (!popFront(jobId, pipeline->todoQueue))
+                    return;
+
+                TJob &job = pipeline->jobs[jobId];
+
+                // typically the idle queue contains only ready jobs
+                // however, if seek() fast forwards running jobs into the todoQueue
+                // the caller defers the task of waiting to the decompression threads
+                waitFor(job);
+
+                {
+                    std::lock_guard<std::mutex> scopedLock(streamBuf->serializer.lock);
+
+                    if (streamBuf->serializer.error != NULL || !streamBuf->loadJob(job))
+                        return;
+
+                    if (!appendValue(pipeline->runningQueue, jobId))
+                    {
+                        signalReady(job);
+                        return;  // Terminate this thread.
+                    }
+                }
+
+                if (!job.ready)
+                {
+                    streamBuf->decompressJob(job, context);
+                    signalReady(job);
+                }
+            }
+        }
+    };
+
+    // string of recycable jobs
+    String<TJob>                    jobs;
+    TJobQueue                       runningQueue;
+    TJobQueue                       todoQueue;
+
+    // array of worker threads, destroyed first
+    std::vector<std::future<void> > threads;
+
+    DecompressionPipeline_(size_t numThreads, size_t numJobs) :
+        runningQueue(numJobs),
+        todoQueue(numJobs)
+    {
+        resize(jobs, numJobs, Exact());
+
+        lockReading(runningQueue);
+        lockWriting(todoQueue);
+        setReaderWriterCount(runningQueue, 1, numThreads);
+        setReaderWriterCount(todoQueue, numThreads, 1);
+
+        for (unsigned i = 0; i < numJobs; ++i)
+        {
+            bool success = appendValue(todoQueue, i);
+            ignoreUnusedVariableWarning(success);
+            SEQAN_ASSERT(success);
+        }
+    }
+
+    ~DecompressionPipeline_()
+    {
+        unlockWriting(todoQueue);
+        unlockReading(runningQueue);
+    }
+
+    // starts the worker threads, after the stream buffer is constructed
+    void start(TStreamBuf & streamBuf, size_t numThreads)
+    {
+        for (unsigned i = 0; i < numThreads; ++i)
+            threads.push_back(std::async(std::launch::async, DecompressionThread{this, &streamBuf, TContext{}}));
+    }
+
+    // pops the next job in input order and waits for the end of its decompression, returns false at the end
+    bool pop(int & jobId)
+    {
+        if (!popFront(jobId, runningQueue))
+        {
+            jobId = -1;
+            return false;
+        }
+        waitFor(jobs[jobId]);
+        return true;
+    }
+
+    // returns a job to the workers
+    void recycle(int jobId)
+    {
+        appendValue(todoQueue, jobId);
+    }
+
+    static void waitFor(TJob & job)
+    {
+        if (!job.ready)
+        {
+            std::unique_lock<std::mutex> lock(job.cs);
+            job.readyEvent.wait(lock, [&job]{return job.ready.load();});
+        }
+    }
+
+    static void signalReady(TJob & job)
+    {
+        {
+            std::unique_lock<std::mutex> lock(job.cs);
+            job.ready = true;
+        }
+        job.readyEvent.notify_all();
+    }
+};
+
+}  // namespace seqan2
+
+#endif  // INCLUDE_SEQAN_STREAM_IOSTREAM_DECOMPRESSION_PIPELINE_H_
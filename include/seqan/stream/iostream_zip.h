@@ -21,6 +21,11 @@
 #ifndef INCLUDE_SEQAN_STREAM_IOSTREAM_ZIP_H_
 #define INCLUDE_SEQAN_STREAM_IOSTREAM_ZIP_H_
 
+// Inflate gzip input on a separate thread, see basic_zip_pipelined_istream.
+#ifndef SEQAN_ZIP_PIPELINED
+#define SEQAN_ZIP_PIPELINED 1
+#endif
+
 namespace zlib_stream {
 
 // Default gzip buffer size, change this to suite your needs.
@@ -161,6 +166,61 @@ private:
     char_vector_type m_buffer;
 };
 
+// --------------------------------------------------------------------------
+// Class basic_unzip_pipelined_streambuf
+// --------------------------------------------------------------------------
+// A stream decorator that unzips compressed input on a separate thread.
+// The thread inflates into a ring of num_buffers_ buffers, while the reader
+// consumes the previously inflated buffers.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_unzip_pipelined_streambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &                          istream_reference;
+    typedef basic_unzip_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>   unzip_streambuf_type;
+    typedef ElemA                                                   char_allocator_type;
+    typedef Tr                                                      traits_type;
+    typedef typename Tr::char_type                                  char_type;
+    typedef typename Tr::int_type                                   int_type;
+    typedef std::vector<char_type, char_allocator_type>             char_vector_type;
+
+    // Construct a unzip stream
+    // More info on the following parameters can be found in the zlib documentation.
+    basic_unzip_pipelined_streambuf(istream_reference istream_,
+                                    size_t window_size_,
+                                    size_t read_buffer_size_,
+                                    size_t input_buffer_size_,
+                                    size_t num_buffers_);
+
+    ~basic_unzip_pipelined_streambuf();
+
+    int_type underflow();
+
+    // returns the compressed input istream
+    istream_reference get_istream()  { return m_unzip.get_istream(); }
+
+private:
+    void inflate_buffers();
+
+    unzip_streambuf_type            m_unzip;
+    std::vector<char_vector_type>   m_buffers;
+    std::vector<std::streamsize>    m_sizes;
+    size_t                          m_produced;     // number of buffers inflated by the thread
+    size_t                          m_released;     // number of buffers the reader is done with
+    bool                            m_reading;      // the reader holds buffer m_released
+    bool                            m_stop;
+    std::mutex                      m_mutex;
+    std::condition_variable         m_cond;
+    std::thread                     m_thread;
+};
+
 // --------------------------------------------------------------------------
 // Class basic_zip_ostreambase
 // --------------------------------------------------------------------------
@@ -365,6 +425,89 @@ private:
 #endif
 };
 
+// --------------------------------------------------------------------------
+// Class basic_zip_pipelined_istreambase
+// --------------------------------------------------------------------------
+// Base class for pipelined unzip istreams
+// Contains a basic_unzip_pipelined_streambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zip_pipelined_istreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &                                  istream_reference;
+    typedef basic_unzip_pipelined_streambuf<Elem, Tr, ElemA, ByteT, ByteAT> unzip_streambuf_type;
+
+    basic_zip_pipelined_istreambase(istream_reference istream_,
+                                    size_t window_size_,
+                                    size_t read_buffer_size_,
+                                    size_t input_buffer_size_,
+                                    size_t num_buffers_) :
+        m_buf(istream_, window_size_, read_buffer_size_, input_buffer_size_, num_buffers_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying unzip istream object
+    unzip_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    unzip_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zip_pipelined_istream
+// --------------------------------------------------------------------------
+// Behaves like basic_zip_istream, but inflates on a separate thread ahead of
+// the reader.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zip_pipelined_istream :
+    public basic_zip_pipelined_istreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_istream<Elem, Tr>
+{
+public:
+    typedef basic_zip_pipelined_istreambase<Elem, Tr, ElemA, ByteT, ByteAT> zip_istreambase_type;
+    typedef std::basic_istream<Elem, Tr>                                    istream_type;
+    typedef istream_type &                                                  istream_reference;
+    typedef ByteT                                                           byte_type;
+    typedef Tr                                                              traits_type;
+
+    // Construct a pipelined unzipper stream
+    //
+    // istream_ input buffer
+    // window_size_
+    // read_buffer_size_
+    // input_buffer_size_
+    // num_buffers_ number of read buffers the thread may inflate ahead (at least 2)
+
+    basic_zip_pipelined_istream(istream_reference istream_,
+                                size_t window_size_ = 31, // 15 (size) + 16 (gzip header)
+                                size_t read_buffer_size_ = ZIP_DEFAULT_BUFFER_SIZE,
+                                size_t input_buffer_size_ = ZIP_DEFAULT_BUFFER_SIZE,
+                                size_t num_buffers_ = 2) :
+        zip_istreambase_type(istream_, window_size_, read_buffer_size_, input_buffer_size_, num_buffers_),
+        istream_type(this->rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
 // ===========================================================================
 // Typedefs
 // ===========================================================================
@@ -377,6 +520,8 @@ typedef basic_zip_ostream<wchar_t>  zip_wostream;
 typedef basic_zip_istream<char>     zip_istream;
 // A typedef for basic_zip_istream<wchart>
 typedef basic_zip_istream<wchar_t>  zip_wistream;
+// A typedef for basic_zip_pipelined_istream<char>
+typedef basic_zip_pipelined_istream<char>   zip_pipelined_istream;
 
 } // namespace zlib_stream
 
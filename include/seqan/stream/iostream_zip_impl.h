@@ -379,6 +379,141 @@ void basic_unzip_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>::put_back_from_zip_st
     m_zip_stream.avail_in = 0;
 }
 
+// --------------------------------------------------------------------------
+// Class basic_unzip_pipelined_streambuf
+// --------------------------------------------------------------------------
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+basic_unzip_pipelined_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>::basic_unzip_pipelined_streambuf(
+    istream_reference istream_,
+    size_t window_size_,
+    size_t read_buffer_size_,
+    size_t input_buffer_size_,
+    size_t num_buffers_
+    ) :
+    m_unzip(istream_, window_size_, read_buffer_size_, input_buffer_size_),
+    m_buffers(std::max(num_buffers_, (size_t)2), char_vector_type(read_buffer_size_)),
+    m_sizes(m_buffers.size(), 0),
+    m_produced(0),
+    m_released(0),
+    m_reading(false),
+    m_stop(false)
+{
+    this->setg(&(m_buffers[0][0]) + 4,  // beginning of putback area
+               &(m_buffers[0][0]) + 4,  // read position
+               &(m_buffers[0][0]) + 4); // end position
+
+    // start the thread after all members are initialized
+    m_thread = std::thread(&basic_unzip_pipelined_streambuf::inflate_buffers, this);
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+basic_unzip_pipelined_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>::~basic_unzip_pipelined_streambuf()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    m_thread.join();
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+void basic_unzip_pipelined_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>::inflate_buffers()
+{
+    for (size_t k = 0; ; ++k)
+    {
+        // wait until the reader released the buffer inflated num_buffers_ rounds before
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this, k]{ return m_stop || k - m_released < m_buffers.size(); });
+            if (m_stop)
+                return;
+        }
+
+        // the first 4 characters are the putback area of the reader
+        char_vector_type & buffer = m_buffers[k % m_buffers.size()];
+        std::streamsize num = m_unzip.sgetn(&(buffer[0]) + 4, static_cast<std::streamsize>(buffer.size() - 4));
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_sizes[k % m_buffers.size()] = num;
+            ++m_produced;
+        }
+        m_cond.notify_all();
+
+        if (num <= 0)     // ERROR or EOF
+            return;
+    }
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+typename basic_unzip_pipelined_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>::int_type
+basic_unzip_pipelined_streambuf<Elem, Tr, ElemA, ByteT, ByteAT>::underflow()
+{
+    if (this->gptr() && (this->gptr() < this->egptr()))
+        return *reinterpret_cast<unsigned char *>(this->gptr());
+
+    int n_putback = static_cast<int>(this->gptr() - this->eback());
+    if (n_putback > 4)
+        n_putback = 4;
+
+    char_type putback[4];
+    std::copy(this->gptr() - n_putback, this->gptr(), putback);
+
+    std::streamsize num;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // the thread stops after the last buffer, which is empty
+        if (m_reading && m_sizes[m_released % m_buffers.size()] <= 0)
+            return traits_type::eof();
+
+        // release the current buffer to the thread and wait for the next one
+        if (m_reading)
+        {
+            ++m_released;
+            m_cond.notify_all();
+        }
+        m_cond.wait(lock, [this]{ return m_produced > m_released; });
+        m_reading = true;
+        num = m_sizes[m_released % m_buffers.size()];
+    }
+
+    char_vector_type & buffer = m_buffers[m_released % m_buffers.size()];
+    std::copy(putback, putback + n_putback, &(buffer[0]) + (4 - n_putback));
+
+    if (num <= 0)     // ERROR or EOF
+    {
+        this->setg(&(buffer[0]) + (4 - n_putback), &(buffer[0]) + 4, &(buffer[0]) + 4);
+        return traits_type::eof();
+    }
+
+    // reset buffer pointers
+    this->setg(&(buffer[0]) + (4 - n_putback),         // beginning of putback area
+               &(buffer[0]) + 4,                       // read position
+               &(buffer[0]) + 4 + num);                // end of buffer
+
+    // return next character
+    return *reinterpret_cast<unsigned char *>(this->gptr());
+}
+
 } // namespace zlib_stream
 
 
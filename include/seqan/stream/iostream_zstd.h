@@ -0,0 +1,708 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Stream buffers and streams for the Zstandard format.
+//
+// The output stream writes the seekable Zstandard format: the data is cut
+// into independent frames of a fixed uncompressed size and a seek table with
+// the compressed and uncompressed size of every frame is appended in a
+// skippable frame. Such files can be read by any Zstandard decoder.
+// The input stream reads any sequence of (skippable) frames and can seek to
+// uncompressed positions if the file has a seek table.
+// ==========================================================================
+
+#ifndef INCLUDE_SEQAN_STREAM_IOSTREAM_ZSTD_H_
+#define INCLUDE_SEQAN_STREAM_IOSTREAM_ZSTD_H_
+
+#include <zstd.h>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+
+namespace zstd_stream {
+
+// ===========================================================================
+// Constants
+// ===========================================================================
+
+// size of the put and get areas
+const size_t default_buffer_size = 128 * 1024;
+
+// uncompressed size of the independent frames, the granularity of seeking
+const size_t default_frame_size = 1024 * 1024;
+
+const int default_compression_level = 3;
+
+// the seek table of the seekable format lives in a skippable frame at the end of the file
+const uint32_t SKIPPABLE_SEEK_TABLE_MAGIC = 0x184D2A5E;
+const uint32_t SEEKABLE_MAGIC = 0x8F92EAB1;
+const unsigned SKIPPABLE_HEADER_LENGTH = 8;
+const unsigned SEEK_TABLE_FOOTER_LENGTH = 9;
+const unsigned SEEK_TABLE_CHECKSUM_FLAG = 0x80;
+
+// ===========================================================================
+// Functions
+// ===========================================================================
+
+inline void
+_writeLittleEndian32(char * dst, uint32_t value)
+{
+    for (unsigned i = 0; i < 4; ++i)
+        dst[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+}
+
+inline uint32_t
+_readLittleEndian32(char const * src)
+{
+    uint32_t value = 0;
+    for (unsigned i = 0; i < 4; ++i)
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(src[i])) << (8 * i);
+    return value;
+}
+
+// ===========================================================================
+// Classes
+// ===========================================================================
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_streambuf
+// --------------------------------------------------------------------------
+
+// Compresses everything written to it into the seekable Zstandard format.
+// A frame_size of 0 writes a single frame without seek table.
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_zstd_streambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr>& ostream_reference;
+    typedef ElemA char_allocator_type;
+    typedef ByteT byte_type;
+    typedef ByteAT byte_allocator_type;
+    typedef typename Tr::char_type char_type;
+    typedef typename Tr::int_type int_type;
+    typedef std::vector<byte_type, byte_allocator_type > byte_vector_type;
+    typedef std::vector<char_type, char_allocator_type > char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "Zstandard streams only support byte-sized characters.");
+
+    basic_zstd_streambuf(
+        ostream_reference ostream_,
+        int level_,
+        size_t frame_size_,
+        size_t buffer_size_
+        ) :
+        m_ostream(ostream_),
+        m_cctx(ZSTD_createCCtx()),
+        m_err(0),
+        m_output_buffer(ZSTD_CStreamOutSize(), 0),
+        m_buffer(buffer_size_, 0),
+        m_frame_size(frame_size_),
+        m_frame_in(0),
+        m_frame_out(0),
+        m_finished(false)
+    {
+        if (m_cctx == NULL)
+            m_err = -1;
+        else
+            m_err = check(ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_compressionLevel, level_));
+        this->setp(&m_buffer[0], &m_buffer[0] + m_buffer.size());
+    }
+
+    ~basic_zstd_streambuf()
+    {
+        finish();
+        ZSTD_freeCCtx(m_cctx);
+    }
+
+    int sync()
+    {
+        if (m_finished)
+            return (m_err == 0) ? 0 : -1;
+        if (!compress_buffer() || !compress(NULL, 0, ZSTD_e_flush))
+            return -1;
+        m_ostream.flush();
+        return m_ostream.good() ? 0 : -1;
+    }
+
+    int_type overflow(int_type c)
+    {
+        if (m_finished || !compress_buffer())
+            return Tr::eof();
+
+        if (!Tr::eq_int_type(c, Tr::eof()))
+        {
+            *this->pptr() = Tr::to_char_type(c);
+            this->pbump(1);
+        }
+        return Tr::not_eof(c);
+    }
+
+    // Ends the last frame and writes the seek table.  Called by the destructor.
+    bool finish()
+    {
+        if (m_finished)
+            return m_err == 0;
+        m_finished = true;
+
+        if (!compress_buffer())
+            return false;
+
+        // Write at least one (empty) frame, such that the file is a valid Zstandard file.
+        if (m_frame_in != 0 || m_seek_table.empty())
+            end_frame();
+
+        if (m_frame_size != 0 && m_err == 0)
+            write_seek_table();
+
+        m_ostream.flush();
+        return m_err == 0;
+    }
+
+    int get_zerr() const
+    {
+        return m_err;
+    }
+
+private:
+    int check(size_t ret)
+    {
+        return ZSTD_isError(ret) ? -1 : 0;
+    }
+
+    bool compress_buffer()
+    {
+        std::streamsize size = this->pptr() - this->pbase();
+        this->setp(&m_buffer[0], &m_buffer[0] + m_buffer.size());
+        if (m_err != 0)
+            return false;
+
+        char_type const * data = &m_buffer[0];
+        while (size > 0)
+        {
+            size_t chunk = static_cast<size_t>(size);
+            if (m_frame_size != 0)
+                chunk = std::min(chunk, m_frame_size - m_frame_in);
+
+            if (!compress(data, chunk, ZSTD_e_continue))
+                return false;
+
+            data += chunk;
+            size -= chunk;
+            m_frame_in += chunk;
+            if (m_frame_size != 0 && m_frame_in == m_frame_size)
+                if (!end_frame())
+                    return false;
+        }
+        return true;
+    }
+
+    bool compress(char_type const * data, size_t size, ZSTD_EndDirective mode)
+    {
+        ZSTD_inBuffer input = { data, size, 0 };
+        size_t remaining;
+        do
+        {
+            ZSTD_outBuffer output = { &m_output_buffer[0], m_output_buffer.size(), 0 };
+            remaining = ZSTD_compressStream2(m_cctx, &output, &input, mode);
+            if ((m_err = check(remaining)) != 0)
+                return false;
+
+            m_ostream.write(reinterpret_cast<char const *>(&m_output_buffer[0]), output.pos);
+            if (!m_ostream.good())
+            {
+                m_err = -1;
+                return false;
+            }
+            m_frame_out += output.pos;
+        }
+        while (mode == ZSTD_e_continue ? input.pos != input.size : remaining != 0);
+        return true;
+    }
+
+    bool end_frame()
+    {
+        if (!compress(NULL, 0, ZSTD_e_end))
+            return false;
+        m_seek_table.push_back(m_frame_out);
+        m_seek_table.push_back(m_frame_in);
+        m_frame_in = 0;
+        m_frame_out = 0;
+        return true;
+    }
+
+    void write_seek_table()
+    {
+        uint32_t num_frames = static_cast<uint32_t>(m_seek_table.size() / 2);
+        std::vector<char> table(SKIPPABLE_HEADER_LENGTH + 8 * num_frames + SEEK_TABLE_FOOTER_LENGTH);
+
+        char * it = &table[0];
+        _writeLittleEndian32(it, SKIPPABLE_SEEK_TABLE_MAGIC);
+        _writeLittleEndian32(it + 4, static_cast<uint32_t>(table.size() - SKIPPABLE_HEADER_LENGTH));
+        it += SKIPPABLE_HEADER_LENGTH;
+        for (size_t i = 0; i < m_seek_table.size(); ++i, it += 4)
+            _writeLittleEndian32(it, static_cast<uint32_t>(m_seek_table[i]));
+        _writeLittleEndian32(it, num_frames);
+        it[4] = 0;  // no checksums
+        _writeLittleEndian32(it + 5, SEEKABLE_MAGIC);
+
+        m_ostream.write(&table[0], table.size());
+        if (!m_ostream.good())
+            m_err = -1;
+    }
+
+    ostream_reference m_ostream;
+    ZSTD_CCtx * m_cctx;
+    int m_err;
+    byte_vector_type m_output_buffer;
+    char_vector_type m_buffer;
+
+    size_t m_frame_size;
+    size_t m_frame_in;              // uncompressed bytes of the current frame
+    size_t m_frame_out;             // compressed bytes of the current frame
+    std::vector<size_t> m_seek_table;   // compressed and uncompressed size of every finished frame
+    bool m_finished;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_unzstd_streambuf
+// --------------------------------------------------------------------------
+
+// Decompresses a sequence of Zstandard frames, skippable frames are ignored.
+// Seeking to an uncompressed position requires a seekable input stream and a
+// seek table at its end.
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_unzstd_streambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>& istream_reference;
+    typedef ElemA char_allocator_type;
+    typedef ByteT byte_type;
+    typedef ByteAT byte_allocator_type;
+    typedef typename Tr::char_type char_type;
+    typedef typename Tr::int_type int_type;
+    typedef typename Tr::pos_type pos_type;
+    typedef typename Tr::off_type off_type;
+    typedef std::vector<byte_type, byte_allocator_type > byte_vector_type;
+    typedef std::vector<char_type, char_allocator_type > char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "Zstandard streams only support byte-sized characters.");
+
+    // number of characters that can be put back
+    static const size_t PUTBACK_SIZE = 4;
+
+    basic_unzstd_streambuf(
+        istream_reference istream_,
+        size_t read_buffer_size_,
+        size_t input_buffer_size_
+        ) :
+        m_istream(istream_),
+        m_dctx(ZSTD_createDCtx()),
+        m_err(m_dctx == NULL ? -1 : 0),
+        m_input_buffer(std::max(input_buffer_size_, (size_t)1), 0),
+        m_buffer(std::max(read_buffer_size_, (size_t)1) + PUTBACK_SIZE, 0),
+        m_remaining(0),
+        m_position(0),
+        m_start(istream_.tellg()),
+        m_table_loaded(false)
+    {
+        m_input.src = &m_input_buffer[0];
+        m_input.size = 0;
+        m_input.pos = 0;
+        if (m_start == pos_type(off_type(-1)))
+            istream_.clear();
+        char_type * begin = &m_buffer[0] + PUTBACK_SIZE;
+        this->setg(begin, begin, begin);
+    }
+
+    ~basic_unzstd_streambuf()
+    {
+        ZSTD_freeDCtx(m_dctx);
+    }
+
+    int_type underflow()
+    {
+        if (this->gptr() < this->egptr())
+            return Tr::to_int_type(*this->gptr());
+
+        // keep the last characters for putback
+        size_t putback = std::min(static_cast<size_t>(this->gptr() - this->eback()), PUTBACK_SIZE);
+        std::copy(this->gptr() - putback, this->gptr(), &m_buffer[0] + PUTBACK_SIZE - putback);
+
+        char_type * begin = &m_buffer[0] + PUTBACK_SIZE;
+        size_t n = decompress(begin, m_buffer.size() - PUTBACK_SIZE);
+        this->setg(begin - putback, begin, begin + n);
+        m_position += n;
+
+        if (n == 0)
+            return Tr::eof();
+        return Tr::to_int_type(*this->gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in)
+    {
+        if (dir == std::ios_base::cur)
+            return seekpos(pos_type(static_cast<off_type>(current()) + off), which);
+        if (dir == std::ios_base::beg)
+            return seekpos(pos_type(off), which);
+        return pos_type(off_type(-1));
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in)
+    {
+        if (!(which & std::ios_base::in) || off_type(pos) < 0 || m_err != 0)
+            return pos_type(off_type(-1));
+
+        uint64_t target = static_cast<uint64_t>(off_type(pos));
+        if (target == current())
+            return pos;
+
+        // the target lies in the current get area
+        uint64_t areaBegin = m_position - (this->egptr() - this->eback());
+        if (areaBegin <= target && target <= m_position)
+        {
+            this->setg(this->eback(), this->eback() + (target - areaBegin), this->egptr());
+            return pos;
+        }
+
+        // jump to the beginning of the frame that contains the target
+        if (!load_seek_table() || target > m_uncompressed_offsets.back())
+            return pos_type(off_type(-1));
+
+        size_t frame = std::upper_bound(m_uncompressed_offsets.begin(), m_uncompressed_offsets.end(), target) -
+                       m_uncompressed_offsets.begin() - 1;
+        frame = std::min(frame, m_compressed_offsets.size() - 1);
+
+        m_istream.clear();
+        m_istream.seekg(m_start + off_type(m_compressed_offsets[frame]));
+        if (!m_istream.good() || check(ZSTD_DCtx_reset(m_dctx, ZSTD_reset_session_only)) != 0)
+            return pos_type(off_type(-1));
+        m_input.size = 0;
+        m_input.pos = 0;
+        m_remaining = 0;
+        m_position = m_uncompressed_offsets[frame];
+        char_type * begin = &m_buffer[0] + PUTBACK_SIZE;
+        this->setg(begin, begin, begin);
+
+        // decompress and skip the frame until the target
+        while (m_position < target)
+        {
+            this->setg(this->eback(), this->egptr(), this->egptr());
+            if (Tr::eq_int_type(underflow(), Tr::eof()))
+                return pos_type(off_type(-1));
+        }
+        this->setg(this->eback(), this->egptr() - (m_position - target), this->egptr());
+        return pos;
+    }
+
+    istream_reference get_istream()         {   return m_istream;   };
+    int get_zerr() const                    {   return m_err;       };
+
+private:
+    int check(size_t ret)
+    {
+        return ZSTD_isError(ret) ? -1 : 0;
+    }
+
+    uint64_t current() const
+    {
+        return m_position - (this->egptr() - this->gptr());
+    }
+
+    size_t decompress(char_type * buffer, size_t size)
+    {
+        ZSTD_outBuffer output = { buffer, size, 0 };
+        while (output.pos == 0 && m_err == 0)
+        {
+            if (m_input.pos == m_input.size)
+            {
+                m_istream.read(reinterpret_cast<char *>(&m_input_buffer[0]), m_input_buffer.size());
+                m_input.size = m_istream.gcount();
+                m_input.pos = 0;
+                if (m_input.size == 0)
+                {
+                    // the last frame was truncated
+                    if (m_remaining != 0)
+                        m_err = -1;
+                    break;
+                }
+            }
+
+            m_remaining = ZSTD_decompressStream(m_dctx, &output, &m_input);
+            m_err = check(m_remaining);
+        }
+        return output.pos;
+    }
+
+    // Reads the seek table at the end of the input stream and computes the frame offsets.
+    bool load_seek_table()
+    {
+        if (m_table_loaded)
+            return !m_compressed_offsets.empty();
+        m_table_loaded = true;
+
+        if (m_start == pos_type(off_type(-1)))
+            return false;
+
+        pos_type backup = m_istream.tellg();
+        bool success = read_seek_table();
+        m_istream.clear();
+        m_istream.seekg(backup);
+
+        if (!success)
+        {
+            m_compressed_offsets.clear();
+            m_uncompressed_offsets.clear();
+        }
+        return success;
+    }
+
+    bool read_seek_table()
+    {
+        char footer[SEEK_TABLE_FOOTER_LENGTH];
+        m_istream.clear();
+        m_istream.seekg(-off_type(SEEK_TABLE_FOOTER_LENGTH), std::ios_base::end);
+        if (!m_istream.read(footer, SEEK_TABLE_FOOTER_LENGTH) ||
+            _readLittleEndian32(footer + 5) != SEEKABLE_MAGIC)
+            return false;
+
+        uint32_t num_frames = _readLittleEndian32(footer);
+        unsigned entry_size = (footer[4] & SEEK_TABLE_CHECKSUM_FLAG) ? 12 : 8;
+        off_type table_size = off_type(num_frames) * entry_size + SEEK_TABLE_FOOTER_LENGTH;
+
+        std::vector<char> table(SKIPPABLE_HEADER_LENGTH + table_size);
+        m_istream.seekg(-off_type(table.size()), std::ios_base::end);
+        if (!m_istream.read(&table[0], table.size()) ||
+            _readLittleEndian32(&table[0]) != SKIPPABLE_SEEK_TABLE_MAGIC ||
+            _readLittleEndian32(&table[4]) != static_cast<uint32_t>(table_size))
+            return false;
+
+        m_compressed_offsets.resize(num_frames + 1);
+        m_uncompressed_offsets.resize(num_frames + 1);
+        m_compressed_offsets[0] = 0;
+        m_uncompressed_offsets[0] = 0;
+        char const * entry = &table[SKIPPABLE_HEADER_LENGTH];
+        for (uint32_t i = 0; i < num_frames; ++i, entry += entry_size)
+        {
+            m_compressed_offsets[i + 1] = m_compressed_offsets[i] + _readLittleEndian32(entry);
+            m_uncompressed_offsets[i + 1] = m_uncompressed_offsets[i] + _readLittleEndian32(entry + 4);
+        }
+        return num_frames != 0;
+    }
+
+    istream_reference m_istream;
+    ZSTD_DCtx * m_dctx;
+    int m_err;
+    byte_vector_type m_input_buffer;
+    char_vector_type m_buffer;
+    ZSTD_inBuffer m_input;
+    size_t m_remaining;             // the last return value of ZSTD_decompressStream, 0 at frame ends
+    uint64_t m_position;            // uncompressed position of egptr()
+    pos_type m_start;               // position of the first frame in the input stream
+
+    bool m_table_loaded;
+    std::vector<uint64_t> m_compressed_offsets;     // frame begin positions relative to m_start
+    std::vector<uint64_t> m_uncompressed_offsets;   // uncompressed positions of the frame begins
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_zstd_ostreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr>& ostream_reference;
+    typedef basic_zstd_streambuf<Elem,Tr,ElemA,ByteT,ByteAT> zstd_streambuf_type;
+
+    basic_zstd_ostreambase(
+        ostream_reference ostream_,
+        int level_,
+        size_t frame_size_,
+        size_t buffer_size_
+        )
+        : m_buf(ostream_, level_, frame_size_, buffer_size_)
+    {
+        this->init(&m_buf);
+    };
+
+    zstd_streambuf_type* rdbuf() { return &m_buf; };
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambase
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_zstd_istreambase : virtual public std::basic_ios<Elem,Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr>& istream_reference;
+    typedef basic_unzstd_streambuf<Elem,Tr,ElemA,ByteT,ByteAT> unzstd_streambuf_type;
+
+    basic_zstd_istreambase(
+        istream_reference istream_,
+        size_t read_buffer_size_,
+        size_t input_buffer_size_
+        )
+        : m_buf(istream_, read_buffer_size_, input_buffer_size_)
+    {
+        this->init(&m_buf);
+    };
+
+    unzstd_streambuf_type* rdbuf() { return &m_buf; };
+
+private:
+    unzstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostream
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_zstd_ostream :
+    public basic_zstd_ostreambase<Elem,Tr,ElemA,ByteT,ByteAT>,
+    public std::basic_ostream<Elem,Tr>
+{
+public:
+    typedef basic_zstd_ostreambase<Elem,Tr,ElemA,ByteT,ByteAT> zstd_ostreambase_type;
+    typedef std::basic_ostream<Elem,Tr> ostream_type;
+    typedef ostream_type& ostream_reference;
+
+    basic_zstd_ostream(
+        ostream_reference ostream_,
+        int level_ = default_compression_level,
+        size_t frame_size_ = default_frame_size,
+        size_t buffer_size_ = default_buffer_size
+        )
+    :
+        zstd_ostreambase_type(ostream_, level_, frame_size_, buffer_size_),
+        ostream_type(zstd_ostreambase_type::rdbuf())
+    {}
+
+    // Ends the last frame and writes the seek table, nothing can be written afterwards.
+    basic_zstd_ostream& zfinish()
+    {
+        this->flush();
+        if (!this->rdbuf()->finish())
+            this->setstate(std::ios_base::badbit);
+        return *this;
+    }
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istream
+// --------------------------------------------------------------------------
+
+template<
+    typename Elem,
+    typename Tr = std::char_traits<Elem>,
+    typename ElemA = std::allocator<Elem>,
+    typename ByteT = char,
+    typename ByteAT = std::allocator<ByteT>
+>
+class basic_zstd_istream :
+    public basic_zstd_istreambase<Elem,Tr,ElemA,ByteT,ByteAT>,
+    public std::basic_istream<Elem,Tr>
+{
+public:
+    typedef basic_zstd_istreambase<Elem,Tr,ElemA,ByteT,ByteAT> zstd_istreambase_type;
+    typedef std::basic_istream<Elem,Tr> istream_type;
+    typedef istream_type& istream_reference;
+
+    basic_zstd_istream(
+        istream_reference istream_,
+        size_t read_buffer_size_ = default_buffer_size,
+        size_t input_buffer_size_ = default_buffer_size
+        )
+      :
+        zstd_istreambase_type(istream_, read_buffer_size_, input_buffer_size_),
+        istream_type(zstd_istreambase_type::rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() { } // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() { } // Required to avoid VC++ warning C4250
+#endif
+};
+
+typedef basic_zstd_ostream<char> zstd_ostream;
+typedef basic_zstd_istream<char> zstd_istream;
+
+} // namespace zstd_stream
+
+#endif // INCLUDE_SEQAN_STREAM_IOSTREAM_ZSTD_H_
@@ -91,6 +91,21 @@ typedef Tag<BgzfFile_> BgzfFile;
 struct BZ2File_;
 typedef Tag<BZ2File_> BZ2File;
 
+/*!
+ * @tag FileCompressionTags#ZstdFile
+ * @headerfile <seqan/stream.h>
+ *
+ * @brief File compression using the <a href="https://facebook.github.io/zstd/">Zstandard</a> format.
+ *
+ * Files written by SeqAn follow the seekable Zstandard format, i.e. they consist of independent frames followed by
+ * a seek table in a skippable frame.  They can be read by any Zstandard decoder.
+ *
+ * @signature typedef Tag<ZstdFile_> ZstdFile;
+ */
+
+struct ZstdFile_;
+typedef Tag<ZstdFile_> ZstdFile;
+
 // --------------------------------------------------------------------------
 // MagicHeader
 // --------------------------------------------------------------------------
@@ -114,6 +129,16 @@ struct MagicHeader<BZ2File, T>
 template <typename T>
 char const MagicHeader<BZ2File, T>::VALUE[3] = { 0x42, 0x5a, 0x68 };  // bzip2's magic number
 
+
+template <typename T>
+struct MagicHeader<ZstdFile, T>
+{
+    static char const VALUE[4];
+};
+
+template <typename T>
+char const MagicHeader<ZstdFile, T>::VALUE[4] = { 0x28, '\xb5', 0x2f, '\xfd' };  // zstd's frame magic number
+
 // --------------------------------------------------------------------------
 // FileExtensions
 // --------------------------------------------------------------------------
@@ -134,17 +159,18 @@ char const * FileExtensions<GZFile, T>::VALUE[1] =
 template <typename T>
 struct FileExtensions<BgzfFile, T>
 {
-    static char const * VALUE[5];
+    static char const * VALUE[6];
 };
 
 template <typename T>
-char const * FileExtensions<BgzfFile, T>::VALUE[5] =
+char const * FileExtensions<BgzfFile, T>::VALUE[6] =
 {
     ".bgzf",      // default output extension
     ".bam",       // BAM files are bgzf compressed
     ".vcf.gz",    // Compressed and indexed VCF files are bgzf compressed
     ".bed.gz",    // Compressed and indexed BED files are bgzf compressed
-    ".tbi"        // Tabix index files are bgzf compressed
+    ".tbi",       // Tabix index files are bgzf compressed
+    ".csi"        // CSI index files are bgzf compressed
 };
 
 
@@ -160,6 +186,20 @@ char const * FileExtensions<BZ2File, T>::VALUE[1] =
     ".bz2"      // default output extension
 };
 
+
+template <typename T>
+struct FileExtensions<ZstdFile, T>
+{
+    static char const * VALUE[2];
+};
+
+template <typename T>
+char const * FileExtensions<ZstdFile, T>::VALUE[2] =
+{
+    ".zst",     // default output extension
+    ".zstd"
+};
+
 // ============================================================================
 // Functions
 // ============================================================================
@@ -42,7 +42,12 @@
 #include "iostream_zutil.h"
 #endif
 
+#if SEQAN_HAS_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
 #include <algorithm>    // copy
+#include <memory>       // unique_ptr
 
 namespace seqan2 {
 
@@ -93,12 +98,36 @@ struct CompressionContext<GZFile>
     }
 };
 
+#if SEQAN_HAS_LIBDEFLATE
+struct LibdeflateDeleter_
+{
+    void operator()(libdeflate_compressor * compressor) const
+    {
+        libdeflate_free_compressor(compressor);
+    }
+
+    void operator()(libdeflate_decompressor * decompressor) const
+    {
+        libdeflate_free_decompressor(decompressor);
+    }
+};
+#endif  // #if SEQAN_HAS_LIBDEFLATE
+
 template <>
 struct CompressionContext<BgzfFile>:
     CompressionContext<GZFile>
 {
     enum { BLOCK_HEADER_LENGTH = 18 };
     unsigned char headerPos;
+
+#if SEQAN_HAS_LIBDEFLATE
+    // BGZF blocks are independent and small, so we decompress them with libdeflate's whole-buffer functions.
+    // libdeflate compresses to different (but valid) DEFLATE data than zlib.  Thus it is only used for compression
+    // if SEQAN_BGZF_LIBDEFLATE_COMPRESSION is defined, otherwise the written files stay byte-identical.
+    // The (de)compressors are allocated on first use.
+    std::unique_ptr<libdeflate_compressor, LibdeflateDeleter_>      compressor;
+    std::unique_ptr<libdeflate_decompressor, LibdeflateDeleter_>    decompressor;
+#endif  // #if SEQAN_HAS_LIBDEFLATE
 };
 
 template <typename T>
@@ -219,6 +248,25 @@ compressInit(CompressionContext<BgzfFile> & ctx)
     ctx.headerPos = 0;
 }
 
+inline void
+decompressInit(CompressionContext<GZFile> & ctx)
+{
+    const int GZIP_WINDOW_BITS = -15;   // no zlib header
+
+    ctx.strm.zalloc = NULL;
+    ctx.strm.zfree = NULL;
+    int status = inflateInit2(&ctx.strm, GZIP_WINDOW_BITS);
+    if (status != Z_OK)
+        throw IOError("GZip inflateInit2() failed.");
+}
+
+inline void
+decompressInit(CompressionContext<BgzfFile> & ctx)
+{
+    decompressInit(static_cast<CompressionContext<GZFile> &>(ctx));
+    ctx.headerPos = 0;
+}
+
 template <typename TTarget, typename TSourceIterator>
 inline typename Size<TTarget>::Type
 compress(TTarget & target, TSourceIterator & source, CompressionContext<BgzfFile> & ctx)
@@ -323,74 +371,175 @@ _bgzfPack32(char * buffer, uint32_t value)
 }
 
 
-template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength>
-inline TDestCapacity
-_compressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
-               TSourceValue *srcBegin, TSourceLength srcLength, CompressionContext<BgzfFile> & ctx)
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfCrc32()
+// ----------------------------------------------------------------------------
+
+inline uint32_t
+_bgzfCrc32(void const * buffer, size_t length)
 {
-    const size_t BLOCK_HEADER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_HEADER_LENGTH;
-    const size_t BLOCK_FOOTER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_FOOTER_LENGTH;
+#if SEQAN_HAS_LIBDEFLATE
+    return libdeflate_crc32(0u, buffer, length);
+#else
+    return crc32(crc32(0u, NULL, 0u), static_cast<Bytef const *>(buffer), length);
+#endif  // #if SEQAN_HAS_LIBDEFLATE
+}
 
-    SEQAN_ASSERT_GT(dstCapacity, BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH);
-    SEQAN_ASSERT_EQ(sizeof(TDestValue), 1u);
-    SEQAN_ASSERT_EQ(sizeof(unsigned), 4u);
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfStore()
+// ----------------------------------------------------------------------------
 
-    // 1. COPY HEADER
+// Writes the data as a single uncompressed DEFLATE block (see 3.2.4. at
+// https://datatracker.ietf.org/doc/html/rfc1951#section-3.2.4) and returns its size.  A BGZF block always has room
+// for it, whereas zlib splits incompressible data into several stored blocks that might not fit.
+inline size_t
+_bgzfStore(void * dstBegin, size_t dstCapacity, void const * srcBegin, size_t srcLength)
+{
+    const size_t STORED_BLOCK_OVERHEAD = DefaultPageSize<BgzfFile>::ZLIB_BLOCK_OVERHEAD;
 
-    std::copy(&MagicHeader<BgzfFile>::VALUE[0], &MagicHeader<BgzfFile>::VALUE[BLOCK_HEADER_LENGTH], dstBegin);
+    if (srcLength > 0xffffu || dstCapacity < srcLength + STORED_BLOCK_OVERHEAD)
+        throw IOError("Deflation failed. Compressed BGZF data is too big.");
 
+    char * dst = static_cast<char *>(dstBegin);
+    dst[0] = 1;  // BFINAL = 1, BTYPE = 00 (no compression)
+    _bgzfPack16(dst + 1, srcLength);
+    _bgzfPack16(dst + 3, ~srcLength);
+    std::memcpy(dst + STORED_BLOCK_OVERHEAD, srcBegin, srcLength);
+    return srcLength + STORED_BLOCK_OVERHEAD;
+}
 
-    // 2. COMPRESS
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfDeflate()
+// ----------------------------------------------------------------------------
 
+// Compresses a whole BGZF block into raw DEFLATE data and returns the compressed size.
+inline size_t
+_bgzfDeflate(void * dstBegin, size_t dstCapacity, void const * srcBegin, size_t srcLength,
+             CompressionContext<BgzfFile> & ctx)
+{
+#if SEQAN_HAS_LIBDEFLATE && defined(SEQAN_BGZF_LIBDEFLATE_COMPRESSION)
+    // We use the same level as Z_BEST_SPEED below.
+    if (!ctx.compressor)
+        ctx.compressor.reset(libdeflate_alloc_compressor(1));
+    if (!ctx.compressor)
+        throw IOError("BGZF libdeflate_alloc_compressor() failed.");
+
+    // libdeflate encodes empty input as a stored block, but the BGZF end-of-file marker must contain the empty
+    // fixed Huffman block written by zlib.
+    if (srcLength == 0u)
+    {
+        SEQAN_ASSERT_GEQ(dstCapacity, 2u);
+        static_cast<uint8_t *>(dstBegin)[0] = BGZF_END_OF_FILE_MARKER[18];
+        static_cast<uint8_t *>(dstBegin)[1] = BGZF_END_OF_FILE_MARKER[19];
+        return 2u;
+    }
+
+    size_t len = libdeflate_deflate_compress(ctx.compressor.get(), srcBegin, srcLength, dstBegin, dstCapacity);
+    if (len == 0u)
+        return _bgzfStore(dstBegin, dstCapacity, srcBegin, srcLength);
+    return len;
+#else
     compressInit(ctx);
     ctx.strm.next_in = (Bytef *)(srcBegin);
-    ctx.strm.next_out = (Bytef *)(dstBegin + BLOCK_HEADER_LENGTH);
-    ctx.strm.avail_in = srcLength * sizeof(TSourceValue);
-    ctx.strm.avail_out = dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
+    ctx.strm.next_out = (Bytef *)(dstBegin);
+    ctx.strm.avail_in = srcLength;
+    ctx.strm.avail_out = dstCapacity;
 
     int status = deflate(&ctx.strm, Z_FINISH);
     if (status != Z_STREAM_END)
     {
         deflateEnd(&ctx.strm);
-        throw IOError("Deflation failed. Compressed BGZF data is too big.");
+        return _bgzfStore(dstBegin, dstCapacity, srcBegin, srcLength);
     }
 
     status = deflateEnd(&ctx.strm);
     if (status != Z_OK)
         throw IOError("BGZF deflateEnd() failed.");
 
+    return dstCapacity - ctx.strm.avail_out;
+#endif  // #if SEQAN_HAS_LIBDEFLATE && defined(SEQAN_BGZF_LIBDEFLATE_COMPRESSION)
+}
 
-    // 3. APPEND FOOTER
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfInflate()
+// ----------------------------------------------------------------------------
 
-    // Set compressed length into buffer, compute CRC and write CRC into buffer.
+// Decompresses the raw DEFLATE data of a whole BGZF block and returns the decompressed size.
+inline size_t
+_bgzfInflate(void * dstBegin, size_t dstCapacity, void const * srcBegin, size_t srcLength,
+             CompressionContext<BgzfFile> & ctx)
+{
+#if SEQAN_HAS_LIBDEFLATE
+    if (!ctx.decompressor)
+        ctx.decompressor.reset(libdeflate_alloc_decompressor());
+    if (!ctx.decompressor)
+        throw IOError("BGZF libdeflate_alloc_decompressor() failed.");
+
+    size_t len = 0;
+    libdeflate_result status = libdeflate_deflate_decompress(ctx.decompressor.get(), srcBegin, srcLength,
+                                                             dstBegin, dstCapacity, &len);
+    if (status == LIBDEFLATE_INSUFFICIENT_SPACE)
+        throw IOError("Inflation failed. Decompressed BGZF data is too big.");
+    if (status != LIBDEFLATE_SUCCESS)
+        throw IOError("Inflation failed. Invalid BGZF data.");
+    return len;
+#else
+    decompressInit(ctx);
+    ctx.strm.next_in = (Bytef *)(srcBegin);
+    ctx.strm.next_out = (Bytef *)(dstBegin);
+    ctx.strm.avail_in = srcLength;
+    ctx.strm.avail_out = dstCapacity;
 
-    size_t len = dstCapacity - ctx.strm.avail_out;
-    _bgzfPack16(dstBegin + 16, len - 1);
+    int status = inflate(&ctx.strm, Z_FINISH);
+    if (status != Z_STREAM_END)
+    {
+        inflateEnd(&ctx.strm);
+        throw IOError("Inflation failed. Decompressed BGZF data is too big.");
+    }
 
-    dstBegin += len - BLOCK_FOOTER_LENGTH;
-    _bgzfPack32(dstBegin, crc32(crc32(0u, NULL, 0u), (Bytef *)(srcBegin), srcLength * sizeof(TSourceValue)));
-    _bgzfPack32(dstBegin + 4, srcLength * sizeof(TSourceValue));
+    status = inflateEnd(&ctx.strm);
+    if (status != Z_OK)
+        throw IOError("BGZF inflateEnd() failed.");
 
     return dstCapacity - ctx.strm.avail_out;
+#endif  // #if SEQAN_HAS_LIBDEFLATE
 }
 
-inline void
-decompressInit(CompressionContext<GZFile> & ctx)
+template <typename TDestValue, typename TDestCapacity, typename TSourceValue, typename TSourceLength>
+inline TDestCapacity
+_compressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
+               TSourceValue *srcBegin, TSourceLength srcLength, CompressionContext<BgzfFile> & ctx)
 {
-    const int GZIP_WINDOW_BITS = -15;   // no zlib header
+    const size_t BLOCK_HEADER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_HEADER_LENGTH;
+    const size_t BLOCK_FOOTER_LENGTH = DefaultPageSize<BgzfFile>::BLOCK_FOOTER_LENGTH;
 
-    ctx.strm.zalloc = NULL;
-    ctx.strm.zfree = NULL;
-    int status = inflateInit2(&ctx.strm, GZIP_WINDOW_BITS);
-    if (status != Z_OK)
-        throw IOError("GZip inflateInit2() failed.");
-}
+    SEQAN_ASSERT_GT(dstCapacity, BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH);
+    SEQAN_ASSERT_EQ(sizeof(TDestValue), 1u);
+    SEQAN_ASSERT_EQ(sizeof(unsigned), 4u);
 
-inline void
-decompressInit(CompressionContext<BgzfFile> & ctx)
-{
-    decompressInit(static_cast<CompressionContext<GZFile> &>(ctx));
-    ctx.headerPos = 0;
+    // 1. COPY HEADER
+
+    std::copy(&MagicHeader<BgzfFile>::VALUE[0], &MagicHeader<BgzfFile>::VALUE[BLOCK_HEADER_LENGTH], dstBegin);
+
+
+    // 2. COMPRESS
+
+    size_t len = BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH +
+                 _bgzfDeflate(dstBegin + BLOCK_HEADER_LENGTH, dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH,
+                              srcBegin, srcLength * sizeof(TSourceValue), ctx);
+
+
+    // 3. APPEND FOOTER
+
+    // Set compressed length into buffer, compute CRC and write CRC into buffer.
+
+    _bgzfPack16(dstBegin + 16, len - 1);
+
+    dstBegin += len - BLOCK_FOOTER_LENGTH;
+    _bgzfPack32(dstBegin, _bgzfCrc32(srcBegin, srcLength * sizeof(TSourceValue)));
+    _bgzfPack32(dstBegin + 4, srcLength * sizeof(TSourceValue));
+
+    return len;
 }
 
 inline bool
@@ -466,38 +615,25 @@ _decompressBlock(TDestValue *dstBegin,   TDestCapacity dstCapacity,
 
     // 2. DECOMPRESS
 
-    decompressInit(ctx);
-    ctx.strm.next_in = (Bytef *)(srcBegin + BLOCK_HEADER_LENGTH);
-    ctx.strm.next_out = (Bytef *)(dstBegin);
-    ctx.strm.avail_in = srcLength - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
-    ctx.strm.avail_out = dstCapacity * sizeof(TDestValue);
-
-    int status = inflate(&ctx.strm, Z_FINISH);
-    if (status != Z_STREAM_END)
-    {
-        inflateEnd(&ctx.strm);
-        throw IOError("Inflation failed. Decompressed BGZF data is too big.");
-    }
-
-    status = inflateEnd(&ctx.strm);
-    if (status != Z_OK)
-        throw IOError("BGZF inflateEnd() failed.");
+    size_t len = _bgzfInflate(dstBegin, dstCapacity * sizeof(TDestValue),
+                              srcBegin + BLOCK_HEADER_LENGTH, srcLength - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH,
+                              ctx);
 
 
     // 3. CHECK FOOTER
 
     // Check compressed length in buffer, compute CRC and compare with CRC in buffer.
 
-    unsigned crc = crc32(crc32(0u, NULL, 0u), (Bytef *)(dstBegin), dstCapacity - ctx.strm.avail_out);
+    unsigned crc = _bgzfCrc32(dstBegin, len);
 
     srcBegin += compressedLen - BLOCK_FOOTER_LENGTH;
     if (_bgzfUnpack32(srcBegin) != crc)
         throw IOError("BGZF wrong checksum.");
 
-    if (_bgzfUnpack32(srcBegin + 4) != dstCapacity - ctx.strm.avail_out)
+    if (_bgzfUnpack32(srcBegin + 4) != len)
         throw IOError("BGZF size mismatch.");
 
-    return (dstCapacity - ctx.strm.avail_out) / sizeof(TDestValue);
+    return len / sizeof(TDestValue);
 }
 
 #endif  // #if SEQAN_HAS_ZLIB
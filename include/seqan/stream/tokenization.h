@@ -156,6 +156,32 @@ typedef OrFunctor<IsAlpha, IsDigit>                             IsAlphaNum;
 // Functions
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Function _skipUntilBulk()
+// ----------------------------------------------------------------------------
+// Returns the first position of a chunk the stop functor has to look at.
+// Overloaded in tokenization_simd.h for functors that can be tested in bulk.
+
+template <typename TValue, typename TStopFunctor>
+inline TValue const * _skipUntilBulk(TValue const * ptr, TValue const *, TStopFunctor &)
+{
+    return ptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readUntilBulk()
+// ----------------------------------------------------------------------------
+// Copies the leading characters of a chunk that are neither stop nor ignored
+// characters into the reserved output and returns the first position left to
+// the element-wise loop.  Overloaded in tokenization_simd.h.
+
+template <typename TOValue, typename TIValue, typename TStopFunctor, typename TIgnoreFunctor>
+inline TIValue const * _readUntilBulk(TOValue * SEQAN_RESTRICT &, TOValue *, TIValue const * iptr, TIValue const *,
+                                      TStopFunctor &, TIgnoreFunctor &)
+{
+    return iptr;
+}
+
 // ----------------------------------------------------------------------------
 // Function _skipUntil(); Element-wise
 // ----------------------------------------------------------------------------
@@ -181,7 +207,7 @@ inline void _skipUntil(TFwdIterator &iter, TStopFunctor &stopFunctor, Range<TVal
         getChunk(ichunk, iter, Input());
         SEQAN_ASSERT(!empty(ichunk));
 
-        const TIValue* SEQAN_RESTRICT ptr = ichunk.begin;
+        const TIValue* SEQAN_RESTRICT ptr = _skipUntilBulk(ichunk.begin, ichunk.end, stopFunctor);
 
         for (; ptr != ichunk.end; ++ptr)
         {
@@ -289,6 +315,10 @@ inline void _readUntil(TTarget &target,
 
         for (; iptr != ichunk.end; ++iptr)
         {
+            iptr = _readUntilBulk(optr, ochunk.end, iptr, ichunk.end, stopFunctor, ignoreFunctor);
+            if (iptr == ichunk.end)
+                break;
+
             if (SEQAN_UNLIKELY(stopFunctor(*iptr)))
             {
                 iter += iptr - ichunk.begin;               // advance input iterator
@@ -0,0 +1,524 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Bulk tokenization of character chunks with SSE2/SSSE3/AVX2.
+//
+// The chunked _skipUntil() and _readUntil() call _skipUntilBulk() and
+// _readUntilBulk() before they look at single characters.  The overloads
+// below are chosen for stop and ignore functors that only test the character
+// class (EqualsChar, IsInRange and Or/Not combinations of them, e.g.
+// IsNewline or IsWhitespace) and for the CountDownFunctor used for Fastq
+// qualities.  They scan a whole vector of characters at once and copy or
+// convert the run in front of the first stop or ignored character.
+//
+// Characters are converted to Dna and Dna5 with a table lookup on the lower
+// nibble (pshufb), which also validates the input.  The first character that
+// is not part of the alphabet ends the bulk run and is left to the
+// element-wise loop, which throws the usual ParseError.
+// ==========================================================================
+
+#ifndef SEQAN_STREAM_TOKENIZATION_SIMD_H_
+#define SEQAN_STREAM_TOKENIZATION_SIMD_H_
+
+// Parse character chunks with SIMD instructions, define to 0 to disable.
+#ifndef SEQAN_SIMD_TOKENIZATION
+#if defined(__SSE2__)
+#define SEQAN_SIMD_TOKENIZATION 1
+#else
+#define SEQAN_SIMD_TOKENIZATION 0
+#endif
+#endif
+
+#if SEQAN_SIMD_TOKENIZATION
+
+#if !defined(__SSE2__)
+#error "SEQAN_SIMD_TOKENIZATION requires at least SSE2."
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace seqan2 {
+
+// ============================================================================
+// Classes
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class TokenizationSimd_
+// ----------------------------------------------------------------------------
+// The vector operations needed to scan and convert characters.
+
+struct TokenizationSimd_
+{
+#if defined(__AVX2__)
+    typedef __m256i     TVector;
+    static const unsigned SIZE = 32;
+
+    static TVector load(char const * ptr)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr));
+    }
+
+    static void store(void * ptr, TVector const & v)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), v);
+    }
+
+    static TVector fill(char c)
+    {
+        return _mm256_set1_epi8(c);
+    }
+
+    static TVector zero()
+    {
+        return _mm256_setzero_si256();
+    }
+
+    static TVector cmpEq(TVector const & a, TVector const & b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+
+    static TVector bitOr(TVector const & a, TVector const & b)
+    {
+        return _mm256_or_si256(a, b);
+    }
+
+    static TVector bitAnd(TVector const & a, TVector const & b)
+    {
+        return _mm256_and_si256(a, b);
+    }
+
+    static TVector bitXor(TVector const & a, TVector const & b)
+    {
+        return _mm256_xor_si256(a, b);
+    }
+
+    static TVector sub(TVector const & a, TVector const & b)
+    {
+        return _mm256_sub_epi8(a, b);
+    }
+
+    static TVector minUnsigned(TVector const & a, TVector const & b)
+    {
+        return _mm256_min_epu8(a, b);
+    }
+
+    // 16 entry table lookup, the table is repeated in both 128 bit lanes.
+    static TVector lookup(char const * table, TVector const & idx)
+    {
+        __m128i t = _mm_loadu_si128(reinterpret_cast<__m128i const *>(table));
+        return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(t), idx);
+    }
+
+    static uint32_t bitMask(TVector const & v)
+    {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+    }
+#else
+    typedef __m128i     TVector;
+    static const unsigned SIZE = 16;
+
+    static TVector load(char const * ptr)
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr));
+    }
+
+    static void store(void * ptr, TVector const & v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), v);
+    }
+
+    static TVector fill(char c)
+    {
+        return _mm_set1_epi8(c);
+    }
+
+    static TVector zero()
+    {
+        return _mm_setzero_si128();
+    }
+
+    static TVector cmpEq(TVector const & a, TVector const & b)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+
+    static TVector bitOr(TVector const & a, TVector const & b)
+    {
+        return _mm_or_si128(a, b);
+    }
+
+    static TVector bitAnd(TVector const & a, TVector const & b)
+    {
+        return _mm_and_si128(a, b);
+    }
+
+    static TVector bitXor(TVector const & a, TVector const & b)
+    {
+        return _mm_xor_si128(a, b);
+    }
+
+    static TVector sub(TVector const & a, TVector const & b)
+    {
+        return _mm_sub_epi8(a, b);
+    }
+
+    static TVector minUnsigned(TVector const & a, TVector const & b)
+    {
+        return _mm_min_epu8(a, b);
+    }
+
+#if defined(__SSSE3__)
+    static TVector lookup(char const * table, TVector const & idx)
+    {
+        return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(table)), idx);
+    }
+#endif
+
+    static uint32_t bitMask(TVector const & v)
+    {
+        return static_cast<uint32_t>(_mm_movemask_epi8(v));
+    }
+#endif
+
+    static uint32_t fullMask()
+    {
+        return static_cast<uint32_t>((uint64_t(1) << SIZE) - 1);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction SimdCharClass_
+// ----------------------------------------------------------------------------
+// Functors that only depend on the character.  mask() sets all bits of the
+// characters the functor returns true for.
+
+template <typename TFunctor>
+struct SimdCharClass_ : False
+{};
+
+template <>
+struct SimdCharClass_<False> : True
+{
+    static TokenizationSimd_::TVector mask(TokenizationSimd_::TVector const &)
+    {
+        return TokenizationSimd_::zero();
+    }
+};
+
+template <char CHAR>
+struct SimdCharClass_<EqualsChar<CHAR> > : True
+{
+    static TokenizationSimd_::TVector mask(TokenizationSimd_::TVector const & v)
+    {
+        return TokenizationSimd_::cmpEq(v, TokenizationSimd_::fill(CHAR));
+    }
+};
+
+template <char FIRST_CHAR, char LAST_CHAR>
+struct SimdCharClass_<IsInRange<FIRST_CHAR, LAST_CHAR> > : True
+{
+    // FIRST_CHAR <= v <= LAST_CHAR  <=>  (unsigned)(v - FIRST_CHAR) <= (unsigned)(LAST_CHAR - FIRST_CHAR)
+    static TokenizationSimd_::TVector mask(TokenizationSimd_::TVector const & v)
+    {
+        typedef TokenizationSimd_ TSimd;
+        TSimd::TVector diff = TSimd::sub(v, TSimd::fill(FIRST_CHAR));
+        return TSimd::cmpEq(TSimd::minUnsigned(diff, TSimd::fill(LAST_CHAR - FIRST_CHAR)), diff);
+    }
+};
+
+template <typename TFunctor1, typename TFunctor2>
+struct SimdCharClass_<OrFunctor<TFunctor1, TFunctor2> > :
+    And<SimdCharClass_<TFunctor1>, SimdCharClass_<TFunctor2> >
+{
+    static TokenizationSimd_::TVector mask(TokenizationSimd_::TVector const & v)
+    {
+        return TokenizationSimd_::bitOr(SimdCharClass_<TFunctor1>::mask(v), SimdCharClass_<TFunctor2>::mask(v));
+    }
+};
+
+template <typename TFunctor>
+struct SimdCharClass_<NotFunctor<TFunctor> > : SimdCharClass_<TFunctor>
+{
+    static TokenizationSimd_::TVector mask(TokenizationSimd_::TVector const & v)
+    {
+        typedef TokenizationSimd_ TSimd;
+        TSimd::TVector ones = TSimd::cmpEq(v, v);
+        return TSimd::bitXor(SimdCharClass_<TFunctor>::mask(v), ones);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction SimdIgnoreClass_
+// ----------------------------------------------------------------------------
+// Ignore functors handled in bulk.  TClass is the character class of the
+// ignored characters.  An additional assertion of the target alphabet is left
+// to the validating conversion of SimdCharConverter_.
+
+template <typename TFunctor, typename TOValue>
+struct SimdIgnoreClass_ : SimdCharClass_<TFunctor>
+{
+    typedef TFunctor TClass;
+};
+
+template <typename TFunctor, typename TException, typename TContext, typename TOValue>
+struct SimdIgnoreClass_<OrFunctor<TFunctor, AssertFunctor<IsInAlphabet<TOValue>, TException, TContext, false> >, TOValue> :
+    SimdCharClass_<TFunctor>
+{
+    typedef TFunctor TClass;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction SimdCharConverter_
+// ----------------------------------------------------------------------------
+// Stores a vector of characters converted into the target alphabet and
+// returns the number of leading characters (at most n) that were valid.
+
+template <typename TOValue>
+struct SimdCharConverter_ : False
+{};
+
+template <typename TOValue>
+struct SimdCharConverterCopy_ : True
+{
+    static unsigned convert(TOValue * optr, TokenizationSimd_::TVector const & v, unsigned n)
+    {
+        TokenizationSimd_::store(optr, v);
+        return n;
+    }
+};
+
+template <>
+struct SimdCharConverter_<char> : SimdCharConverterCopy_<char>
+{};
+
+template <>
+struct SimdCharConverter_<signed char> : SimdCharConverterCopy_<signed char>
+{};
+
+template <>
+struct SimdCharConverter_<unsigned char> : SimdCharConverterCopy_<unsigned char>
+{};
+
+// Upper case 'A', 'C', 'G', 'T' and 'N' have distinct lower nibbles, so the
+// nibble of (c & ~0x20) selects the candidate symbol and its upper case
+// character.  The character is valid if it equals the candidate.
+template <typename TOValue, bool WITH_N>
+struct SimdCharConverterNucleotide_ : True
+{
+    static unsigned convert(TOValue * optr, TokenizationSimd_::TVector const & v, unsigned n)
+    {
+        typedef TokenizationSimd_ TSimd;
+
+        TSimd::TVector upper = TSimd::bitAnd(v, TSimd::fill('\xdf'));
+#if defined(__SSSE3__) || defined(__AVX2__)
+        // Unused entries hold ' ', which never equals an upper case character.
+        static const char CHARS[16] =
+        {
+            ' ', 'A', ' ', 'C', 'T', ' ', ' ', 'G', ' ', ' ', ' ', ' ', ' ', ' ', WITH_N ? 'N' : ' ', ' '
+        };
+        static const char CODES[16] =
+        {
+            0, 0, 0, 1, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 4, 0
+        };
+        TSimd::TVector nibble = TSimd::bitAnd(upper, TSimd::fill('\x0f'));
+        TSimd::TVector valid = TSimd::cmpEq(TSimd::lookup(CHARS, nibble), upper);
+        TSimd::store(optr, TSimd::lookup(CODES, nibble));
+#else
+        TSimd::TVector eqA = TSimd::cmpEq(upper, TSimd::fill('A'));
+        TSimd::TVector eqC = TSimd::cmpEq(upper, TSimd::fill('C'));
+        TSimd::TVector eqG = TSimd::cmpEq(upper, TSimd::fill('G'));
+        TSimd::TVector eqT = TSimd::cmpEq(upper, TSimd::fill('T'));
+        TSimd::TVector code = TSimd::bitOr(TSimd::bitAnd(eqC, TSimd::fill(1)),
+                                           TSimd::bitOr(TSimd::bitAnd(eqG, TSimd::fill(2)),
+                                                        TSimd::bitAnd(eqT, TSimd::fill(3))));
+        TSimd::TVector valid = TSimd::bitOr(TSimd::bitOr(eqA, eqC), TSimd::bitOr(eqG, eqT));
+        if (WITH_N)
+        {
+            TSimd::TVector eqN = TSimd::cmpEq(upper, TSimd::fill('N'));
+            code = TSimd::bitOr(code, TSimd::bitAnd(eqN, TSimd::fill(4)));
+            valid = TSimd::bitOr(valid, eqN);
+        }
+        TSimd::store(optr, code);
+#endif
+        uint32_t invalid = ~TSimd::bitMask(valid) & TSimd::fullMask();
+        if (invalid == 0)
+            return n;
+        return std::min(n, static_cast<unsigned>(bitScanForward(invalid)));
+    }
+};
+
+template <>
+struct SimdCharConverter_<Dna> : SimdCharConverterNucleotide_<Dna, false>
+{};
+
+template <>
+struct SimdCharConverter_<Dna5> : SimdCharConverterNucleotide_<Dna5, true>
+{};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _simdSkipUntil()
+// ----------------------------------------------------------------------------
+// Returns the first character of the class or the beginning of the last
+// incomplete vector.
+
+template <typename TClass>
+inline char const *
+_simdSkipUntil(char const * ptr, char const * end, TClass)
+{
+    typedef TokenizationSimd_ TSimd;
+
+    for (; end - ptr >= static_cast<std::ptrdiff_t>(TSimd::SIZE); ptr += TSimd::SIZE)
+    {
+        uint32_t stop = TSimd::bitMask(SimdCharClass_<TClass>::mask(TSimd::load(ptr)));
+        if (stop != 0)
+            return ptr + bitScanForward(stop);
+    }
+    return ptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function _simdReadRun()
+// ----------------------------------------------------------------------------
+// Converts at most maxLength characters in front of the first character of
+// the breaking class.  Stops early at invalid characters, the end of the
+// output chunk and the last incomplete vector of the input chunk.
+
+template <typename TBreakClass, typename TOValue>
+inline char const *
+_simdReadRun(TOValue * SEQAN_RESTRICT & optr, TOValue * oend, char const * iptr, char const * iend, uint64_t & maxLength, TBreakClass)
+{
+    typedef TokenizationSimd_ TSimd;
+
+    static_assert(sizeof(TOValue) == 1, "Bulk conversion only supports single byte alphabets.");
+
+    while (iend - iptr >= static_cast<std::ptrdiff_t>(TSimd::SIZE) &&
+           oend - optr >= static_cast<std::ptrdiff_t>(TSimd::SIZE) &&
+           maxLength != 0)
+    {
+        TSimd::TVector v = TSimd::load(iptr);
+        uint32_t stop = TSimd::bitMask(SimdCharClass_<TBreakClass>::mask(v));
+
+        unsigned n = (stop == 0) ? TSimd::SIZE : bitScanForward(stop);
+        if (n > maxLength)
+            n = maxLength;
+
+        // the whole vector is written to the reserved output, but only n values are kept
+        unsigned valid = SimdCharConverter_<TOValue>::convert(optr, v, n);
+        optr += valid;
+        iptr += valid;
+        maxLength -= valid;
+
+        if (valid != TSimd::SIZE)
+            break;
+    }
+    return iptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function _skipUntilBulk()
+// ----------------------------------------------------------------------------
+
+template <typename TStopFunctor>
+inline SEQAN_FUNC_ENABLE_IF(SimdCharClass_<TStopFunctor>, char const *)
+_skipUntilBulk(char const * ptr, char const * end, TStopFunctor &)
+{
+    return _simdSkipUntil(ptr, end, TStopFunctor());
+}
+
+// Skip whole vectors while they contain fewer counted characters than remaining.
+template <typename TFunctor, uint64_t REMAINING>
+inline SEQAN_FUNC_ENABLE_IF(SimdCharClass_<TFunctor>, char const *)
+_skipUntilBulk(char const * ptr, char const * end, CountDownFunctor<TFunctor, REMAINING> & stopFunctor)
+{
+    typedef TokenizationSimd_ TSimd;
+
+    for (; end - ptr >= static_cast<std::ptrdiff_t>(TSimd::SIZE); ptr += TSimd::SIZE)
+    {
+        unsigned counted = popCount(TSimd::bitMask(SimdCharClass_<TFunctor>::mask(TSimd::load(ptr))));
+        if (counted >= stopFunctor.remaining)
+            break;
+        stopFunctor.remaining -= counted;
+    }
+    return ptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readUntilBulk()
+// ----------------------------------------------------------------------------
+
+template <typename TOValue, typename TStopFunctor, typename TIgnoreFunctor>
+inline SEQAN_FUNC_ENABLE_IF(And<SimdCharClass_<TStopFunctor>,
+                            And<SimdIgnoreClass_<TIgnoreFunctor, TOValue>,
+                                SimdCharConverter_<TOValue> > >, char const *)
+_readUntilBulk(TOValue * SEQAN_RESTRICT & optr, TOValue * oend, char const * iptr, char const * iend,
+               TStopFunctor &, TIgnoreFunctor &)
+{
+    typedef typename SimdIgnoreClass_<TIgnoreFunctor, TOValue>::TClass  TIgnoreClass;
+
+    uint64_t maxLength = MaxValue<uint64_t>::VALUE;
+    return _simdReadRun(optr, oend, iptr, iend, maxLength, OrFunctor<TStopFunctor, TIgnoreClass>());
+}
+
+// Read only counted characters, at most as many as remaining.
+template <typename TOValue, typename TFunctor, uint64_t REMAINING, typename TIgnoreFunctor>
+inline SEQAN_FUNC_ENABLE_IF(And<SimdCharClass_<TFunctor>,
+                            And<SimdIgnoreClass_<TIgnoreFunctor, TOValue>,
+                                SimdCharConverter_<TOValue> > >, char const *)
+_readUntilBulk(TOValue * SEQAN_RESTRICT & optr, TOValue * oend, char const * iptr, char const * iend,
+               CountDownFunctor<TFunctor, REMAINING> & stopFunctor, TIgnoreFunctor &)
+{
+    typedef typename SimdIgnoreClass_<TIgnoreFunctor, TOValue>::TClass  TIgnoreClass;
+
+    return _simdReadRun(optr, oend, iptr, iend, stopFunctor.remaining,
+                        OrFunctor<NotFunctor<TFunctor>, TIgnoreClass>());
+}
+
+}  // namespace seqan2
+
+#endif  // #if SEQAN_SIMD_TOKENIZATION
+
+#endif  // #ifndef SEQAN_STREAM_TOKENIZATION_SIMD_H_
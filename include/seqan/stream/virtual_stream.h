@@ -64,8 +64,14 @@ typedef
 #endif
 #if SEQAN_HAS_BZIP2
     TagList<BZ2File,
+#endif
+#if SEQAN_HAS_ZSTD
+    TagList<ZstdFile,
 #endif
     TagList<Nothing>
+#if SEQAN_HAS_ZSTD
+    >
+#endif
 #if SEQAN_HAS_BZIP2
     >
 #endif
@@ -121,7 +127,11 @@ struct VirtualStreamSwitch_
 template <typename TValue>
 struct VirtualStreamSwitch_<TValue, Input, GZFile>
 {
+#if SEQAN_ZIP_PIPELINED
+    typedef zlib_stream::basic_zip_pipelined_istream<TValue> Type;
+#else
     typedef zlib_stream::basic_zip_istream<TValue> Type;
+#endif
 };
 
 template <typename TValue>
@@ -149,7 +159,11 @@ struct VirtualStreamSwitch_<TValue, Output, BgzfFile>
 template <typename TValue>
 struct VirtualStreamSwitch_<TValue, Input, BZ2File>
 {
+#if SEQAN_BZIP2_PARALLEL
+    typedef basic_bzip2_parallel_istream<TValue> Type;
+#else
     typedef bzip2_stream::basic_bzip2_istream<TValue> Type;
+#endif
 };
 
 template <typename TValue>
@@ -159,6 +173,20 @@ struct VirtualStreamSwitch_<TValue, Output, BZ2File>
 };
 #endif
 
+#if SEQAN_HAS_ZSTD
+template <typename TValue>
+struct VirtualStreamSwitch_<TValue, Input, ZstdFile>
+{
+    typedef zstd_stream::basic_zstd_istream<TValue> Type;
+};
+
+template <typename TValue>
+struct VirtualStreamSwitch_<TValue, Output, ZstdFile>
+{
+    typedef zstd_stream::basic_zstd_ostream<TValue> Type;
+};
+#endif
+
 // ==========================================================================
 // Classes
 // ==========================================================================
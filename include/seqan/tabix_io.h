@@ -46,6 +46,7 @@
 #include <seqan/sequence.h>
 #include <seqan/stream.h>
 #include <seqan/misc/name_store_cache.h>
+#include <seqan/parallel.h>
 
 // ===========================================================================
 // Tabix index
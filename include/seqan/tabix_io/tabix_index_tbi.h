@@ -36,11 +36,10 @@
 // A Tabix index (Heng Li) allows one to randomly seek in a tab-seperated genome
 // related file, e.g. VCF, GFF, SAM, BED, etc. The corresponding file only
 // needs to be sorted by chromosomal position in advance and optionally
-// compressed with 'bgzip'. The resulting file must be indexed with 'tabix'.
+// compressed with 'bgzip'. The index can be created with 'tabix' or build().
 //
 // TODOs:
 //  - clean jumpToRegion(), I simply adapted the one from bam_index.h
-//  - implement Tabix index creation (and BAM index creation as well)
 // ==========================================================================
 
 #ifndef INCLUDE_SEQAN_TABIX_IO_TABIX_INDEX_TBI_H_
@@ -81,6 +80,36 @@ struct TabixRecord_
     int32_t posEnd;
 };
 
+// ----------------------------------------------------------------------------
+// Enum TabixPreset
+// ----------------------------------------------------------------------------
+
+/*!
+ * @enum TabixPreset
+ * @headerfile <seqan/tabix_io.h>
+ * @brief Column configurations of common file formats, see @link TabixIndex#setPreset @endlink.
+ *
+ * @val TabixPreset TABIX_PRESET_GFF
+ * @brief GFF/GTF files, 1-based closed intervals in columns 4 and 5.
+ *
+ * @val TabixPreset TABIX_PRESET_BED
+ * @brief BED files, 0-based half-open intervals in columns 2 and 3.
+ *
+ * @val TabixPreset TABIX_PRESET_SAM
+ * @brief SAM files, the end position is computed from the CIGAR string.
+ *
+ * @val TabixPreset TABIX_PRESET_VCF
+ * @brief VCF files, the end position is given by the REF allele or the END INFO field.
+ */
+
+enum TabixPreset
+{
+    TABIX_PRESET_GFF,
+    TABIX_PRESET_BED,
+    TABIX_PRESET_SAM,
+    TABIX_PRESET_VCF
+};
+
 // ----------------------------------------------------------------------------
 // Class TabixIndex
 // ----------------------------------------------------------------------------
@@ -111,7 +140,7 @@ public:
     typedef String<uint64_t> TLinearIndex_;
     typedef StringSet<CharString, Owner<ConcatDirect<> > > TNameStore;
 
-    int32_t format;             // Format (0: generic; 1: SAM; 2: VCF)
+    int32_t format;             // Format (0: generic; 1: SAM; 2: VCF), 0x10000 flags 0-based coordinates
     int32_t colSeq;             // Column for the sequence name
     int32_t colBeg;             // Column for the start of a region
     int32_t colEnd;             // Column for the end of a region
@@ -122,6 +151,11 @@ public:
     // 1<<14 is the size of the minimum bin.
     static const int32_t BAM_LIDX_SHIFT = 14;
 
+    static const int32_t FORMAT_GENERIC = 0;
+    static const int32_t FORMAT_SAM = 1;
+    static const int32_t FORMAT_VCF = 2;
+    static const int32_t FLAG_UCSC = 0x10000;
+
     String<TBinIndex_>          _binIndices;
     String<TLinearIndex_>       _linearIndices;
     TNameStore                  _nameStore;
@@ -176,6 +210,121 @@ _tbiReg2bins(String<uint16_t> & list, uint32_t beg, uint32_t end)
     for (k = 4681 + (beg>>14); k <= 4681 + (end>>14); ++k) appendValue(list, k);
 }
 
+// ----------------------------------------------------------------------------
+// Function _parseTabixInt()
+// ----------------------------------------------------------------------------
+
+inline bool
+_parseTabixInt(int64_t & value, char const * it, char const * itEnd)
+{
+    bool negative = (it != itEnd && *it == '-');
+    if (negative)
+        ++it;
+    if (it == itEnd || !isdigit(static_cast<unsigned char>(*it)))
+        return false;
+    for (value = 0; it != itEnd && isdigit(static_cast<unsigned char>(*it)); ++it)
+        value = value * 10 + (*it - '0');
+    if (negative)
+        value = -value;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _parseTabixLine()
+// ----------------------------------------------------------------------------
+
+// Extract the reference name and the 0-based half-open interval of a line
+// the same way tabix does.
+
+inline bool
+_parseTabixLine(TabixRecord_ & record, char const * line, char const * lineEnd, TabixIndex const & index)
+{
+    clear(record.refName);
+    int64_t posBeg = 0;
+    int64_t posEnd = 0;
+    bool hasName = false;
+    bool hasBeg = false;
+    int32_t preset = index.format & 0xffff;
+
+    char const * colBegin = line;
+    for (int32_t col = 1; ; ++col)
+    {
+        char const * colEnd = std::find(colBegin, lineEnd, '\t');
+
+        if (col == index.colSeq)
+        {
+            resize(record.refName, colEnd - colBegin);
+            std::copy(colBegin, colEnd, begin(record.refName, Standard()));
+            hasName = true;
+        }
+        else if (col == index.colBeg)
+        {
+            if (!_parseTabixInt(posBeg, colBegin, colEnd))
+                return false;
+            hasBeg = true;
+            posEnd = posBeg;            // 1-based begin equals the 0-based end of a single position
+            if (!(index.format & TabixIndex::FLAG_UCSC))
+                --posBeg;
+            else
+                ++posEnd;
+        }
+        else if (preset == TabixIndex::FORMAT_GENERIC && col == index.colEnd)
+        {
+            if (!_parseTabixInt(posEnd, colBegin, colEnd))
+                return false;
+        }
+        else if (preset == TabixIndex::FORMAT_SAM && col == 6 && hasBeg)
+        {
+            // The CIGAR string determines the end.
+            int64_t refLen = 0;
+            int64_t num = 0;
+            for (char const * it = colBegin; it != colEnd; ++it)
+            {
+                if (isdigit(static_cast<unsigned char>(*it)))
+                {
+                    num = num * 10 + (*it - '0');
+                    continue;
+                }
+                char op = toupper(*it);
+                if (op == 'M' || op == 'D' || op == 'N')
+                    refLen += num;
+                num = 0;
+            }
+            posEnd = posBeg + std::max(refLen, (int64_t)1);
+        }
+        else if (preset == TabixIndex::FORMAT_VCF && col == 4 && hasBeg)
+        {
+            // The REF allele determines the end unless there is an END field.
+            if (colEnd != colBegin)
+                posEnd = posBeg + (colEnd - colBegin);
+        }
+        else if (preset == TabixIndex::FORMAT_VCF && col == 8 && hasBeg)
+        {
+            char const * it = colBegin;
+            if (colEnd - it < 4 || !std::equal(it, it + 4, "END="))
+            {
+                char const * key = ";END=";
+                it = std::search(colBegin, colEnd, key, key + 5);
+                it = (it != colEnd) ? it + 1 : colEnd;
+            }
+            int64_t endPos = 0;
+            if (it != colEnd && _parseTabixInt(endPos, it + 4, colEnd) && endPos > posBeg)
+                posEnd = endPos;
+        }
+
+        if (colEnd == lineEnd)
+            break;
+        colBegin = colEnd + 1;
+    }
+
+    if (!hasName || !hasBeg)
+        return false;
+
+    record.posBeg = std::max(posBeg, (int64_t)0);
+    record.posEnd = std::max(posEnd, (int64_t)1);
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // Function _readTabixRecord()
 // ----------------------------------------------------------------------------
@@ -194,40 +343,9 @@ bool _readTabixRecord(TabixRecord_ & record, CharString & buffer, TIter & iter,
     if (atEnd(iter))
         return false;
 
-    // Extract columns.
-    int32_t maxCol = std::max(index.colSeq, std::max(index.colBeg, index.colEnd));
-    for (int32_t col = 1; col <= maxCol; ++col)
-    {
-        // Read column.
-        clear(buffer);
-        if (col < maxCol)
-        {
-            readUntil(buffer, iter, IsTab());
-            skipOne(iter, IsTab());
-        }
-        else
-        {
-            readUntil(buffer, iter, OrFunctor<IsTab, IsNewline>());
-        }
-
-        if (col == index.colSeq)
-            record.refName = buffer;
-        else if (col == index.colBeg)
-            record.posBeg = lexicalCast<int32_t>(buffer);
-        else if (col == index.colEnd)
-            record.posEnd = lexicalCast<int32_t>(buffer);
-    }
-
-    if (index.colEnd == 0 || index.colEnd == index.colBeg)
-        record.posEnd = record.posBeg + 1;
-
-    // all text-based file formats are 1-based (we use 0-based positions internally)
-    --record.posBeg;
-    --record.posEnd;
-
-    // Go to next line.
-    skipLine(iter);
-    return true;
+    clear(buffer);
+    readLine(buffer, iter);
+    return _parseTabixLine(record, begin(buffer, Standard()), end(buffer, Standard()), index);
 }
 
 // ----------------------------------------------------------------------------
@@ -402,6 +520,113 @@ jumpToRegion(FormattedFile<TFileFormat, Input, TSpec> & fileIn,
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Function viewRecords()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#viewRecords
+ * @brief Extract all records overlapping a region from a tab-separated genome related file using a Tabix index.
+ *
+ * You provide a region <tt>[posBeg, posEnd)</tt> on the contig <tt>refName</tt> and the function reads all
+ * records overlapping this region with at least one base.  The records are <b>appended</b> to
+ * <tt>resultContainer</tt>.  Only the chunks of the Tabix bins overlapping the region are read.
+ *
+ * @signature bool viewRecords(resultContainer, fileIn, index, refName, posBeg, posEnd);
+ *
+ * @param[in,out] resultContainer Container of the record type of <tt>fileIn</tt>, e.g. @link VcfRecord @endlink.
+ * @param[in,out] fileIn          The @link VcfFileIn @endlink, @link GffFileIn @endlink, or @link BedFileIn @endlink
+ *                                to extract records from.  Its header must have been read.
+ * @param[in]     index           The @link TabixIndex @endlink over <tt>fileIn</tt>.
+ * @param[in]     refName         The reference name of the region.
+ * @param[in]     posBeg          The 0-based begin of the region (<tt>int32_t</tt>).
+ * @param[in]     posEnd          The 0-based end of the region, exclusive (<tt>int32_t</tt>).
+ *
+ * @return bool <tt>false</tt> if <tt>refName</tt> is not in the index, otherwise <tt>true</tt>.
+ */
+
+template <typename TContainer, typename TFileFormat, typename TSpec, typename TName>
+inline bool
+viewRecords(TContainer & resultContainer,
+            FormattedFile<TFileFormat, Input, TSpec> & fileIn,
+            TabixIndex const & index,
+            TName const & refName,
+            int32_t posBeg,
+            int32_t posEnd)
+{
+    typedef Pair<uint64_t, uint64_t>                                TChunk;
+    typedef typename std::map<uint32_t, TabixIndexBinData_>::const_iterator TMapIter;
+
+    unsigned refId = 0;
+    if (!getIdByName(refId, index._nameStoreCache, refName))
+        return false;
+
+    if (posBeg >= posEnd || refId >= length(index._binIndices))
+        return true;
+
+    // Chunks ending before the linear index offset cannot contain overlapping records.
+    uint64_t linearMinOffset = 0;
+    String<uint64_t> const & linearIndex = index._linearIndices[refId];
+    if (!empty(linearIndex))
+        linearMinOffset = linearIndex[std::min(static_cast<size_t>(posBeg >> TabixIndex::BAM_LIDX_SHIFT),
+                                               static_cast<size_t>(length(linearIndex) - 1))];
+
+    // Collect the chunks of all candidate bins and join overlapping ones so that each record is read once.
+    String<uint16_t> candidateBins;
+    _tbiReg2bins(candidateBins, posBeg, posEnd);
+
+    String<TChunk> chunks;
+    for (uint16_t bin : candidateBins)
+    {
+        TMapIter mIt = index._binIndices[refId].find(bin);
+        if (mIt == index._binIndices[refId].end())
+            continue;
+        for (TChunk const & chunk : mIt->second.chunkBegEnds)
+            if (chunk.i2 > linearMinOffset)
+                appendValue(chunks, TChunk(std::max(chunk.i1, linearMinOffset), chunk.i2));
+    }
+    std::sort(begin(chunks, Standard()), end(chunks, Standard()));
+
+    size_t numChunks = 0;
+    for (size_t i = 0; i < length(chunks); ++i)
+    {
+        if (numChunks != 0 && chunks[i].i1 <= chunks[numChunks - 1].i2)
+            chunks[numChunks - 1].i2 = std::max(chunks[numChunks - 1].i2, chunks[i].i2);
+        else
+            chunks[numChunks++] = chunks[i];
+    }
+    resize(chunks, numChunks);
+
+    // Read the records of the chunks and keep the overlapping ones.
+    typename Value<TContainer>::Type record;
+    TabixRecord_ tabixRecord;
+    CharString buffer;
+    for (TChunk const & chunk : chunks)
+    {
+        if (!setPosition(fileIn, chunk.i1))
+            return false;
+
+        while (!atEnd(fileIn) && static_cast<uint64_t>(position(fileIn)) < chunk.i2)
+        {
+            uint64_t offset = position(fileIn);
+            if (!_readTabixRecord(tabixRecord, buffer, fileIn.iter, index))
+                break;
+
+            if (tabixRecord.refName != refName || tabixRecord.posBeg >= posEnd)
+                break;  // The remaining records of the chunk lie behind the region.
+
+            if (tabixRecord.posEnd > posBeg)
+            {
+                setPosition(fileIn, offset);
+                readRecord(record, fileIn);
+                appendValue(resultContainer, record, Generous());
+            }
+        }
+    }
+
+    return true;
+}
+
 // ----------------------------------------------------------------------------
 // Function getUnalignedCount()
 // ----------------------------------------------------------------------------
@@ -422,6 +647,55 @@ getUnalignedCount(TabixIndex const & index)
     return index.unalignedCount;
 }
 
+// ----------------------------------------------------------------------------
+// Function setPreset()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#setPreset
+ * @brief Configure the columns and comment character of a Tabix index for a common file format.
+ *
+ * @signature void setPreset(index, preset);
+ *
+ * @param[in,out] index  The @link TabixIndex @endlink to configure, before calling @link TabixIndex#build @endlink.
+ * @param[in]     preset The @link TabixPreset @endlink of the file format.
+ */
+
+inline void
+setPreset(TabixIndex & index, TabixPreset preset)
+{
+    index.meta = '#';
+    index.skip = 0;
+    switch (preset)
+    {
+        case TABIX_PRESET_GFF:
+            index.format = TabixIndex::FORMAT_GENERIC;
+            index.colSeq = 1;
+            index.colBeg = 4;
+            index.colEnd = 5;
+            break;
+        case TABIX_PRESET_BED:
+            index.format = TabixIndex::FORMAT_GENERIC | TabixIndex::FLAG_UCSC;
+            index.colSeq = 1;
+            index.colBeg = 2;
+            index.colEnd = 3;
+            break;
+        case TABIX_PRESET_SAM:
+            index.format = TabixIndex::FORMAT_SAM;
+            index.colSeq = 3;
+            index.colBeg = 4;
+            index.colEnd = 0;
+            index.meta = '@';
+            break;
+        case TABIX_PRESET_VCF:
+            index.format = TabixIndex::FORMAT_VCF;
+            index.colSeq = 1;
+            index.colBeg = 2;
+            index.colEnd = 0;
+            break;
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function open()
 // ----------------------------------------------------------------------------
@@ -469,13 +743,16 @@ open(TabixIndex & index, char const * filename)
     CharString tmp;
     readRawPod(lNm, iter);
     read(tmp, iter, lNm);
-    // Trim last terminating '\0's as they confuse strSplit() below
-    while (!empty(tmp) && back(tmp) == '\0')
-        resize(tmp, length(tmp) - 1);
 
-    // Split concatenated names at \0's.
+    // Split concatenated names at \0's.  The names are appended one by one as
+    // strSplit() into the concatenated name store mangles the last name.
     clear(index._nameStore);
-    strSplit(index._nameStore, tmp, EqualsChar<'\0'>(), true, nRef - 1);
+    for (size_t pos = 0, nameEnd = 0; pos < length(tmp) && length(index._nameStore) < static_cast<size_t>(nRef);
+         pos = nameEnd + 1)
+    {
+        for (nameEnd = pos; nameEnd < length(tmp) && tmp[nameEnd] != '\0'; ++nameEnd) {}
+        appendValue(index._nameStore, infix(tmp, pos, nameEnd));
+    }
     refresh(index._nameStoreCache);
 
     clear(index._linearIndices);
@@ -527,6 +804,277 @@ open(TabixIndex & index, char const * filename)
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#save
+ * @brief Save a Tabix index to a BGZF compressed file.
+ *
+ * @signature bool save(index, filename);
+ *
+ * @param[in] index    The @link TabixIndex @endlink to write out.
+ * @param[in] filename The name of the TBI file to write to. Types: char const *
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
+ */
+
+inline bool
+save(TabixIndex const & index, char const * filename)
+{
+    typedef VirtualStream<char, Output> TOutStream;
+    typedef TabixIndex::TBinIndex_::const_iterator TBinIter;
+
+    std::ofstream file(filename, std::ios::binary | std::ios::out);
+    if (!file.good())
+        return false;  // Could not open file.
+
+    {
+        TOutStream tbi;
+        if (!open(tbi, file, BgzfFile()))
+            return false;
+
+        DirectionIterator<TOutStream, Output>::Type iter = directionIterator(tbi, Output());
+
+        // Write magic header and parameters.
+        write(iter, "TBI\1");
+        appendRawPod(iter, static_cast<int32_t>(length(index._binIndices)));
+        appendRawPod(iter, index.format);
+        appendRawPod(iter, index.colSeq);
+        appendRawPod(iter, index.colBeg);
+        appendRawPod(iter, index.colEnd);
+        appendRawPod(iter, index.meta);
+        appendRawPod(iter, index.skip);
+
+        // Write concatenated '\0'-terminated names.
+        int32_t lNm = 0;
+        for (size_t i = 0; i < length(index._nameStore); ++i)
+            lNm += length(index._nameStore[i]) + 1;
+        appendRawPod(iter, lNm);
+        for (size_t i = 0; i < length(index._nameStore); ++i)
+        {
+            write(iter, index._nameStore[i]);
+            writeValue(iter, '\0');
+        }
+
+        for (size_t i = 0; i < length(index._binIndices); ++i)  // For each reference.
+        {
+            // Write bin index.
+            appendRawPod(iter, static_cast<int32_t>(index._binIndices[i].size()));
+            for (TBinIter it = index._binIndices[i].begin(); it != index._binIndices[i].end(); ++it)
+            {
+                appendRawPod(iter, it->first);
+                appendRawPod(iter, static_cast<int32_t>(length(it->second.chunkBegEnds)));
+                for (size_t k = 0; k < length(it->second.chunkBegEnds); ++k)
+                {
+                    appendRawPod(iter, it->second.chunkBegEnds[k].i1);
+                    appendRawPod(iter, it->second.chunkBegEnds[k].i2);
+                }
+            }
+
+            // Write linear index.
+            appendRawPod(iter, static_cast<int32_t>(length(index._linearIndices[i])));
+            for (size_t j = 0; j < length(index._linearIndices[i]); ++j)
+                appendRawPod(iter, index._linearIndices[i][j]);
+        }
+
+        // Write the number of records without coordinate if set.
+        if (index.unalignedCount != std::numeric_limits<uint64_t>::max())
+            appendRawPod(iter, index.unalignedCount);
+    }
+
+    return file.good();
+}
+
+// ----------------------------------------------------------------------------
+// Function _tabixScanLines()
+// ----------------------------------------------------------------------------
+
+// Add the lines starting at lineBegins[from, to) to an index part, the
+// reference ids are local to the part and listed in refNames.
+
+inline void
+_tabixScanLines(BinningIndexPart_ & part,
+                String<CharString> & refNames,
+                BgzfBatchReader_ const & reader,
+                String<size_t> const & lineBegins,
+                size_t from,
+                size_t to,
+                uint64_t firstLineNo,
+                TabixIndex const & index)
+{
+    TabixRecord_ record;
+    for (size_t i = from; i < to; ++i)
+    {
+        char const * line = &reader.buffer[0] + lineBegins[i];
+        char const * lineEnd = &reader.buffer[0] + lineBegins[i + 1];
+
+        // Skip header and comment lines.
+        if (firstLineNo + i < static_cast<uint64_t>(index.skip) || line == lineEnd || *line == (char)index.meta)
+            continue;
+
+        while (lineEnd != line && (lineEnd[-1] == '\n' || lineEnd[-1] == '\r'))
+            --lineEnd;
+        if (line == lineEnd)
+            continue;
+
+        if (!_parseTabixLine(record, line, lineEnd, index))
+        {
+            part.ok = false;
+            return;
+        }
+
+        if (empty(refNames) || back(refNames) != record.refName)
+            appendValue(refNames, record.refName);
+
+        _binningIndexAddRecord(part, length(refNames) - 1, record.posBeg, record.posEnd, true,
+                               _bgzfVirtualOffset(reader, lineBegins[i]),
+                               _bgzfVirtualOffset(reader, lineBegins[i + 1]),
+                               TabixIndex::BAM_LIDX_SHIFT, 5);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _tabixBuild()
+// ----------------------------------------------------------------------------
+
+inline bool
+_tabixBuild(TabixIndex & index,
+            char const * filename,
+            size_t threads,
+            size_t blocksPerThread)
+{
+    clear(index._binIndices);
+    clear(index._linearIndices);
+    clear(index._nameStore);
+    refresh(index._nameStoreCache);
+    index.unalignedCount = 0;
+
+    BgzfBatchReader_ reader;
+    if (!open(reader, filename, 0))
+        return false;
+
+    BinningIndexBuilder_<TabixIndex::TBinIndex_> builder(0, TabixIndex::BAM_LIDX_SHIFT, 5);
+    String<BinningIndexPart_> parts;
+    String<String<CharString> > partRefNames;
+    resize(parts, threads);
+    resize(partRefNames, threads);
+    String<size_t> lineBegins;
+    uint64_t lineNo = 0;
+
+    bool more = true;
+    while (more)
+    {
+        more = _readBlocks(reader, threads * blocksPerThread, threads);
+        if (!reader.ok)
+            return false;
+
+        // Find the complete lines in the buffer, at the end of the file the last one needs no newline.
+        clear(lineBegins);
+        size_t pos = 0;
+        char const * buf = begin(reader.buffer, Standard());
+        while (pos < length(reader.buffer))
+        {
+            char const * nl = static_cast<char const *>(std::memchr(buf + pos, '\n', length(reader.buffer) - pos));
+            if (nl == NULL && more)
+                break;
+            appendValue(lineBegins, pos);
+            pos = (nl == NULL) ? length(reader.buffer) : nl - buf + 1;
+        }
+        appendValue(lineBegins, pos);
+
+        // Bin the lines of each part independently and merge the parts in file order.
+        size_t numLines = length(lineBegins) - 1;
+        SEQAN_OMP_PRAGMA(parallel for num_threads(threads) schedule(static, 1))
+        for (int64_t t = 0; t < static_cast<int64_t>(threads); ++t)
+        {
+            clear(parts[t].runs);
+            clear(parts[t].linear);
+            clear(partRefNames[t]);
+            parts[t].ok = true;
+            _tabixScanLines(parts[t], partRefNames[t], reader, lineBegins, numLines * t / threads,
+                            numLines * (t + 1) / threads, lineNo, index);
+        }
+
+        for (size_t t = 0; t < threads; ++t)
+        {
+            // Translate the part's reference ids, new names are appended in order of appearance.
+            String<int32_t> globalIds;
+            for (CharString const & name : partRefNames[t])
+            {
+                unsigned id = 0;
+                if (!getIdByName(id, index._nameStoreCache, name))
+                {
+                    id = length(index._nameStore);
+                    appendName(index._nameStoreCache, name);
+                    _binningIndexResize(builder, id + 1);
+                }
+                appendValue(globalIds, id);
+            }
+            for (BinningIndexRun_ & run : parts[t].runs)
+                run.rID = globalIds[run.rID];
+            for (BinningIndexLinearPatch_ & patch : parts[t].linear)
+                patch.rID = globalIds[patch.rID];
+
+            _binningIndexMerge(builder, parts[t]);
+        }
+
+        if (!builder.ok)
+            return false;
+
+        lineNo += numLines;
+        _consumeBuffer(reader, pos);
+    }
+
+    if (!_binningIndexFinish(builder))
+        return false;
+
+    swap(index._binIndices, builder.binIndices);
+    swap(index._linearIndices, builder.linearIndices);
+    index.unalignedCount = builder.unalignedCount;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function build()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn TabixIndex#build
+ * @brief Create a Tabix index for a BGZF compressed tab-separated file.
+ *
+ * @signature bool build(index, filename[, execPolicy]);
+ *
+ * @param[in,out] index      The @link TabixIndex @endlink to build.  Its columns, comment character, and number of
+ *                           skipped lines are used as they are, see @link TabixIndex#setPreset @endlink.
+ * @param[in]     filename   Path to the file to build an index for, e.g. a <tt>.vcf.gz</tt> created by
+ *                           <tt>bgzip</tt>. Types: char const *
+ * @param[in]     execPolicy The @link ExecutionPolicy @endlink to use.  With a parallel policy the BGZF blocks
+ *                           are decompressed and binned by <tt>numThreads(execPolicy)</tt> threads.  Defaults to
+ *                           @link ExecutionPolicy#Sequential @endlink.
+ *
+ * The records must be grouped by reference and sorted by begin position.  The resulting index has the same bins,
+ * chunks, and linear index as the one created by <tt>tabix</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> otherwise.
+ */
+
+template <typename TParallel, typename TVectorization>
+inline bool
+build(TabixIndex & index, char const * filename, ExecutionPolicy<TParallel, TVectorization> const & execPolicy)
+{
+    // Each thread decompresses and bins 64 BGZF blocks per batch.
+    size_t threads = IsParallel<TParallel>::VALUE ? std::max(numThreads(execPolicy), static_cast<size_t>(1)) : 1;
+    return _tabixBuild(index, filename, threads, 64);
+}
+
+inline bool
+build(TabixIndex & index, char const * filename)
+{
+    return build(index, filename, Sequential());
+}
+
 }  // namespace seqan2
 
 #endif  // #ifndef INCLUDE_SEQAN_TABIX_IO_TABIX_INDEX_TBI_H_
@@ -59,6 +59,8 @@
 #include "test_alignment_algorithms_local_banded.h"
 #include "test_alignment_algorithms_dynamic_gap.h"
 #include "test_align_global_alignment_specialized.h"
+#include "test_align_striped.h"
+#include "test_align_packed_trace.h"
 
 #include "test_align_alignment_operations.h"
 #include "test_evaluate_alignment.h"
@@ -302,6 +304,9 @@ SEQAN_BEGIN_TESTSUITE(test_align)
     SEQAN_CALL_TEST(test_alignment_dp_matrix_navigator_trace_matrix_enabled_coordinate);
     SEQAN_CALL_TEST(test_alignment_dp_matrix_navigator_trace_matrix_enabled_container);
     SEQAN_CALL_TEST(test_alignment_dp_matrix_navigator_trace_matrix_enabled_to_global_position);
+    SEQAN_CALL_TEST(test_alignment_dp_matrix_navigator_trace_matrix_packed_assign_value);
+    SEQAN_CALL_TEST(test_alignment_dp_matrix_navigator_trace_matrix_packed_alignment);
+    SEQAN_CALL_TEST(test_alignment_dp_matrix_navigator_trace_matrix_packed_selection);
 
     // ----------------------------------------------------------------------------
     // Test Recursion Formula.
@@ -596,6 +601,7 @@ SEQAN_BEGIN_TESTSUITE(test_align)
 
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_align);
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_gaps);
+    SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_affine);
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_fragments);
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_graph);
 
@@ -604,10 +610,22 @@ SEQAN_BEGIN_TESTSUITE(test_align)
     SEQAN_CALL_TEST(test_align_global_alignment_myers_hirschberg_fragments);
     SEQAN_CALL_TEST(test_align_global_alignment_myers_hirschberg_graph);
 
+    SEQAN_CALL_TEST(test_align_global_alignment_myers_align);
+    SEQAN_CALL_TEST(test_align_global_alignment_myers_gaps);
+
     SEQAN_CALL_TEST(test_align_global_alignment_score_hirschberg);
     SEQAN_CALL_TEST(test_align_global_alignment_score_myers);
     SEQAN_CALL_TEST(test_align_global_alignment_score_myers_hirschberg);
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_single_character);
+    SEQAN_CALL_TEST(test_align_global_alignment_wfa);
+    SEQAN_CALL_TEST(test_align_global_alignment_biwfa);
+    SEQAN_CALL_TEST(test_align_global_alignment_difference_recurrence);
+
+    SEQAN_CALL_TEST(test_align_striped_global);
+    SEQAN_CALL_TEST(test_align_striped_local);
+
+    SEQAN_CALL_TEST(test_align_packed_trace_global_alignment);
+    SEQAN_CALL_TEST(test_align_packed_trace_local_alignment);
 
     // -----------------------------------------------------------------------
     // Test Operations On Align Objects
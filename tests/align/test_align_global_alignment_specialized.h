@@ -31,13 +31,15 @@
 // ==========================================================================
 // Author: Manuel Holtgrewe <manuel.holtgrewe@fu-berlin.de>
 // ==========================================================================
-// Tests for the more specialized global alignment algorithms Hirschberg
-// and Myers-Hirschberg.
+// Tests for the more specialized global alignment algorithms Hirschberg,
+// Myers-Hirschberg, MyersBitVector, WFA, BiWFA and the difference recurrence.
 // ==========================================================================
 
 #ifndef SEQAN_TESTS_ALIGN_TEST_ALIGN_GLOBAL_ALIGNMENT_SPECIALIZED_H_
 #define SEQAN_TESTS_ALIGN_TEST_ALIGN_GLOBAL_ALIGNMENT_SPECIALIZED_H_
 
+#include <random>
+
 SEQAN_DEFINE_TEST(test_align_global_alignment_hirschberg_single_character)
 {
     using namespace seqan2;
@@ -178,6 +180,77 @@ SEQAN_DEFINE_TEST(test_align_global_alignment_hirschberg_gaps)
     }
 }
 
+SEQAN_DEFINE_TEST(test_align_global_alignment_hirschberg_affine)
+{
+    using namespace seqan2;
+
+    // Affine gap scores run the algorithm of Myers and Miller, the gap is opened only once.
+    {
+        DnaString strH = "AAAAAATTTTTTTTG";
+        DnaString strV = "AATTTTTTTTTTGGGGG";
+
+        Align<DnaString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+
+        Score<int, Simple> scoringScheme(2, -1, -1, -3);
+        int score = globalAlignment(align, scoringScheme, Hirschberg());
+        SEQAN_ASSERT_EQ(score, globalAlignmentScore(strH, strV, scoringScheme));
+
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, scoringScheme), score);
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, Hirschberg()), score);
+    }
+
+    // Sequences large enough to be divided, with affine gaps and a scoring matrix.
+    std::mt19937 rng(42);
+    Score<int, Simple> const dnaScore(2, -3, -1, -5);
+    Blosum62 const proteinScore(-1, -11);
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        DnaString strH;
+        for (unsigned j = 0; j < 300 + 50 * i; ++j)
+            appendValue(strH, Dna(rng() % 4));
+        DnaString strV = strH;
+        for (unsigned j = 0; j < 10 * i; ++j)
+        {
+            unsigned pos = rng() % length(strV);
+            if (j % 3 == 0)
+                strV[pos] = Dna(rng() % 4);
+            else if (j % 3 == 1)
+                insertValue(strV, pos, Dna(rng() % 4));
+            else
+                erase(strV, pos);
+        }
+        if (i % 2)
+            resize(strV, length(strV) / 2);
+
+        Gaps<DnaString> gapsH(strH);
+        Gaps<DnaString> gapsV(strV);
+        int expected = globalAlignmentScore(strH, strV, dnaScore);
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(globalAlignment(gapsH, gapsV, dnaScore, Hirschberg()), expected);
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, gapsH, gapsV, dnaScore), expected);
+
+        Peptide pepH;
+        Peptide pepV;
+        for (unsigned j = 0; j < 100 + 20 * i; ++j)
+            appendValue(pepH, AminoAcid(rng() % 20));
+        for (unsigned j = 0; j < length(pepH); ++j)
+            if (rng() % 4)
+                appendValue(pepV, (rng() % 3) ? pepH[j] : AminoAcid(rng() % 20));
+
+        Align<Peptide> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), pepH);
+        assignSource(row(align, 1), pepV);
+        expected = globalAlignmentScore(pepH, pepV, proteinScore);
+        SEQAN_ASSERT_EQ(globalAlignment(align, proteinScore, Hirschberg()), expected);
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, proteinScore), expected);
+    }
+}
+
 SEQAN_DEFINE_TEST(test_align_global_alignment_hirschberg_fragments)
 {
     // TODO(holtgrew): Test when implemented!
@@ -252,6 +325,87 @@ SEQAN_DEFINE_TEST(test_align_global_alignment_myers_hirschberg_graph)
     // TODO(holtgrew): Test when implemented!
 }
 
+SEQAN_DEFINE_TEST(test_align_global_alignment_myers_align)
+{
+    using namespace seqan2;
+
+    // More or less simple alignment.
+    {
+        Dna5String strH = "AAAAAATTTTTTTTG";
+        Dna5String strV = "AATTTTTTTTTTGGGGG";
+
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+
+        int score = globalAlignment(align, MyersBitVector());
+        SEQAN_ASSERT_EQ(score, -8);
+
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, Score<int, Simple>(0, -1, -1)), -8);
+    }
+
+    // Sequences spanning several blocks, with either one being the longer one.
+    std::mt19937 rng(42);
+    Score<int, Simple> const scoringScheme(0, -1, -1);
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        DnaString strH;
+        for (unsigned j = 0; j < 1000; ++j)
+            appendValue(strH, Dna(rng() % 4));
+        DnaString strV = strH;
+        for (unsigned j = 0; j < 20 * i; ++j)
+        {
+            unsigned pos = rng() % length(strV);
+            if (j % 3 == 0)
+                strV[pos] = Dna(rng() % 4);
+            else if (j % 3 == 1)
+                insertValue(strV, pos, Dna(rng() % 4));
+            else
+                erase(strV, pos);
+        }
+        if (i % 2)
+            swap(strH, strV);
+
+        Align<DnaString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+
+        int expected = globalAlignmentScore(strH, strV, MyersBitVector());
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(globalAlignment(align, MyersBitVector()), expected);
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, scoringScheme), expected);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_myers_gaps)
+{
+    using namespace seqan2;
+
+    Dna5String strH = "AAAAAATTTTTTTTG";
+    DnaString strV = "AATTTTTTTTTTGGGGG";
+
+    Gaps<Dna5String, ArrayGaps> gapsH(strH);
+    Gaps<DnaString, ArrayGaps> gapsV(strV);
+
+    int score = globalAlignment(gapsH, gapsV, MyersBitVector());
+    SEQAN_ASSERT_EQ(score, -8);
+
+    std::stringstream ssH, ssV;
+    ssH << gapsH;
+    ssV << gapsV;
+    SEQAN_ASSERT_EQ(length(ssH.str()), length(ssV.str()));
+
+    // Unaligned sequence.
+    DnaString strE;
+    Gaps<Dna5String, ArrayGaps> gapsH2(strH);
+    Gaps<DnaString, ArrayGaps> gapsE(strE);
+    SEQAN_ASSERT_EQ(globalAlignment(gapsH2, gapsE, MyersBitVector()), -15);
+    SEQAN_ASSERT_EQ(length(gapsE), 15u);
+}
+
 SEQAN_DEFINE_TEST(test_align_global_alignment_score_hirschberg)
 {
     using namespace seqan2;
@@ -315,4 +469,150 @@ SEQAN_DEFINE_TEST(test_align_global_alignment_score_myers_hirschberg)
     SEQAN_ASSERT_EQ(res, -8);
 }
 
+template <typename TAlgorithmTag>
+void testAlignGlobalAlignmentWfa(TAlgorithmTag const & algorithmTag)
+{
+    using namespace seqan2;
+
+    // Simple alignment.
+    {
+        Dna5String strH = "AAAAAATTTTTTTTG";
+        DnaString strV = "AATTTTTTTTTTGGGGG";
+
+        Gaps<Dna5String, ArrayGaps> gapsH(strH);
+        Gaps<DnaString, ArrayGaps> gapsV(strV);
+
+        Score<int, Simple> scoringScheme(2, -1, -1);
+        int score = globalAlignment(gapsH, gapsV, scoringScheme, algorithmTag);
+        SEQAN_ASSERT_EQ(score, 14);
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, algorithmTag), 14);
+
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, algorithmTag), 14);
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, scoringScheme), 14);
+    }
+
+    // Scoring schemes the WFA cannot handle fall back to dynamic programming.
+    {
+        Dna5String strH = "AAAAAATTTTTTTTG";
+        DnaString strV = "AATTTTTTTTTTGGGGG";
+
+        Score<int, Simple> scoringSchemes[] = {Score<int, Simple>(1, 1, -1), Score<int, Simple>(0, 0, 0),
+                                               Score<int, Simple>(2, -3, 1, -3)};
+        for (Score<int, Simple> const & scoringScheme : scoringSchemes)
+        {
+            int expected = globalAlignmentScore(strH, strV, scoringScheme);
+            SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, algorithmTag), expected);
+
+            Align<Dna5String> align;
+            resize(rows(align), 2);
+            assignSource(row(align, 0), strH);
+            assignSource(row(align, 1), strV);
+            AlignmentStats stats;
+            SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, algorithmTag), expected);
+            SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, scoringScheme), expected);
+        }
+    }
+
+    // Similar long sequences, such that the BiWFA splits the alignment recursively.
+    std::mt19937 rng(42);
+    Score<int, Simple> scoringSchemes[] = {Score<int, Simple>(2, -4, -2, -6), Score<int, Simple>(0, -1, -1),
+                                           Score<int, Simple>(1, -3, -1, -5)};
+    for (unsigned i = 0; i < 6; ++i)
+    {
+        Score<int, Simple> const & scoringScheme = scoringSchemes[i % 3];
+
+        DnaString strH;
+        for (unsigned j = 0; j < 5000; ++j)
+            appendValue(strH, Dna(rng() % 4));
+        DnaString strV = strH;
+        for (unsigned j = 0; j < 150; ++j)
+        {
+            unsigned pos = rng() % length(strV);
+            unsigned len = 1 + rng() % 5;
+            if (j % 3 == 0)
+                strV[pos] = Dna(rng() % 4);
+            else if (j % 3 == 1)
+                insert(strV, pos, infix(strH, 0, len));
+            else
+                erase(strV, pos, _min(pos + len, static_cast<unsigned>(length(strV))));
+        }
+
+        Align<DnaString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+
+        int expected = globalAlignmentScore(strH, strV, scoringScheme);
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, algorithmTag), expected);
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, scoringScheme), expected);
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, algorithmTag), expected);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_wfa)
+{
+    testAlignGlobalAlignmentWfa(seqan2::Wfa());
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_biwfa)
+{
+    testAlignGlobalAlignmentWfa(seqan2::BiWfa());
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_difference_recurrence)
+{
+    using namespace seqan2;
+
+    // Random sequences in random bands, compared to the banded dynamic programming.
+    std::mt19937 rng(42);
+    Score<int, Simple> scoringSchemes[] = {Score<int, Simple>(2, -4, -2, -6), Score<int, Simple>(1, -1, -1),
+                                           Score<int, Simple>(1, -3, -1, -5)};
+    for (unsigned i = 0; i < 60; ++i)
+    {
+        Score<int, Simple> const & scoringScheme = scoringSchemes[i % 3];
+
+        Dna5String strH;
+        Dna5String strV;
+        unsigned lengthH = 2 + rng() % 200;
+        unsigned lengthV = 2 + rng() % 200;
+        for (unsigned j = 0; j < lengthH; ++j)
+            appendValue(strH, Dna5(rng() % 5));
+        for (unsigned j = 0; j < lengthV; ++j)
+            appendValue(strV, (j < lengthH && rng() % 4) ? strH[j] : Dna5(rng() % 5));
+
+        int diagEnd = static_cast<int>(lengthH) - static_cast<int>(lengthV);
+        int lowerDiag = _min(0, diagEnd) - static_cast<int>(rng() % 10);
+        int upperDiag = _max(0, diagEnd) + static_cast<int>(rng() % 10);
+
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+
+        int expected = globalAlignmentScore(strH, strV, scoringScheme, lowerDiag, upperDiag);
+        AlignmentStats stats;
+        SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, lowerDiag, upperDiag, DifferenceRecurrence()), expected);
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, scoringScheme), expected);
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, lowerDiag, upperDiag, DifferenceRecurrence()),
+                        expected);
+    }
+
+    // Score matrix and a band of a single diagonal.
+    {
+        Peptide strH = "QWERTYIPASDFGHKLCVNM";
+        Peptide strV = "QWERTYIPASDFHHKLCVNM";
+        Blosum62 scoringScheme(-1, -11);
+        int expected = globalAlignmentScore(strH, strV, scoringScheme, 0, 0);
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, 0, 0, DifferenceRecurrence()), expected);
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, -3, 2, DifferenceRecurrence()),
+                        globalAlignmentScore(strH, strV, scoringScheme, -3, 2));
+    }
+}
+
 #endif  // #ifndef SEQAN_TESTS_ALIGN_TEST_ALIGN_GLOBAL_ALIGNMENT_SPECIALIZED_H_
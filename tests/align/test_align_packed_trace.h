@@ -0,0 +1,122 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests the alignment functions with packed trace matrices.
+// ==========================================================================
+
+#ifndef TESTS_ALIGN_TEST_ALIGN_PACKED_TRACE_H_
+#define TESTS_ALIGN_TEST_ALIGN_PACKED_TRACE_H_
+
+#include <seqan/basic.h>
+#include <seqan/align.h>
+
+// Compares the traces computed with a packed trace matrix against the traces computed with an unpacked one.
+template <typename TGapModel, typename TAlignConfig, typename TScoringScheme>
+void testAlignPackedTraceEqualsUnpacked(seqan2::Dna5String const & seqH,
+                                        seqan2::Dna5String const & seqV,
+                                        TScoringScheme const & scoringScheme,
+                                        TAlignConfig const & alignConfig)
+{
+    using namespace seqan2;
+
+    typedef String<TraceSegment_<unsigned, unsigned> > TTraceSegments;
+
+    TTraceSegments traces;
+    TTraceSegments packedTraces;
+    DPScoutState_<Default> scoutState;
+
+    int score = _setUpAndRunAlignment(traces, scoutState, seqH, seqV, scoringScheme, alignConfig, TGapModel());
+    SEQAN_ASSERT_EQ(_setUpAndRunAlignment(packedTraces, scoutState, seqH, seqV, scoringScheme, alignConfig,
+                                          PackedTrace<TGapModel>()), score);
+    SEQAN_ASSERT_EQ(length(traces), length(packedTraces));
+    for (unsigned i = 0; i < length(traces); ++i)
+        SEQAN_ASSERT(traces[i] == packedTraces[i]);
+}
+
+SEQAN_DEFINE_TEST(test_align_packed_trace_global_alignment)
+{
+    using namespace seqan2;
+
+    Dna5String seqH = "AAACGTGCTTTAGGCATTACCGATTACGAGGCTAACC";
+    Dna5String seqV = "AAAGGCTTAGCATTTACCGTTACGAGAAGCTACC";
+
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > TTraceFlag;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOff>, FreeEndGaps_<>, TTraceFlag> TAlignConfig;
+    typedef AlignConfig2<DPGlobal, DPBandConfig<BandOn>, FreeEndGaps_<>, TTraceFlag> TBandedAlignConfig;
+
+    testAlignPackedTraceEqualsUnpacked<AffineGaps>(seqH, seqV, Score<int, Simple>(2, -3, -1, -5), TAlignConfig());
+    testAlignPackedTraceEqualsUnpacked<LinearGaps>(seqH, seqV, Score<int, Simple>(2, -1, -2), TAlignConfig());
+    testAlignPackedTraceEqualsUnpacked<AffineGaps>(seqH, seqV, Score<int, Simple>(2, -3, -1, -5),
+                                                   TBandedAlignConfig(-5, 5));
+
+    // The public interface packs the trace matrix on request and computes the same alignment.
+    Score<int, Simple> scoringScheme(2, -3, -1, -5);
+    Align<Dna5String> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), seqH);
+    assignSource(row(align, 1), seqV);
+    Align<Dna5String> packedAlign(align);
+    SEQAN_ASSERT_EQ(globalAlignment(packedAlign, scoringScheme, PackedTrace<Gotoh>()),
+                    globalAlignment(align, scoringScheme, Gotoh()));
+    SEQAN_ASSERT(row(packedAlign, 0) == row(align, 0));
+    SEQAN_ASSERT(row(packedAlign, 1) == row(align, 1));
+
+    // Score only computations have no trace matrix to pack.
+    SEQAN_ASSERT_EQ(globalAlignmentScore(seqH, seqV, scoringScheme, PackedTrace<Gotoh>()),
+                    globalAlignmentScore(seqH, seqV, scoringScheme, Gotoh()));
+}
+
+SEQAN_DEFINE_TEST(test_align_packed_trace_local_alignment)
+{
+    using namespace seqan2;
+
+    Dna5String seqH = "GGGGGGAAACGTGCTTTAGGCATTACCGATTACGAGGCTAACCTTTT";
+    Dna5String seqV = "CCCAAAGGCTTAGCATTTACCGTTACGAGAAGCTACCAAAA";
+
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > TTraceFlag;
+    typedef AlignConfig2<DPLocal, DPBandConfig<BandOff>, FreeEndGaps_<>, TTraceFlag> TAlignConfig;
+
+    testAlignPackedTraceEqualsUnpacked<AffineGaps>(seqH, seqV, Score<int, Simple>(2, -3, -1, -5), TAlignConfig());
+    testAlignPackedTraceEqualsUnpacked<LinearGaps>(seqH, seqV, Score<int, Simple>(2, -1, -2), TAlignConfig());
+
+    Score<int, Simple> scoringScheme(2, -3, -1, -5);
+    Align<Dna5String> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), seqH);
+    assignSource(row(align, 1), seqV);
+    Align<Dna5String> packedAlign(align);
+    SEQAN_ASSERT_EQ(localAlignment(packedAlign, scoringScheme, PackedTrace<AffineGaps>()),
+                    localAlignment(align, scoringScheme, AffineGaps()));
+    SEQAN_ASSERT(row(packedAlign, 0) == row(align, 0));
+    SEQAN_ASSERT(row(packedAlign, 1) == row(align, 1));
+}
+
+#endif  // #ifndef TESTS_ALIGN_TEST_ALIGN_PACKED_TRACE_H_
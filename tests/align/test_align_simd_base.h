@@ -35,7 +35,10 @@
 #ifndef TESTS_ALIGN_TEST_ALIGN_SIMD_BASE_H_
 #define TESTS_ALIGN_TEST_ALIGN_SIMD_BASE_H_
 
+#include <algorithm>
+#include <random>
 #include <tuple>
+#include <vector>
 
 #include <seqan/basic.h>
 #include <seqan/align.h>
@@ -267,4 +270,108 @@ void testAlignSimdScore(TFunctor const &,
         testAlignSimdScore<TAlphabet>(TFunctor(), score, config, TSimdLength(), -4, 6);
 }
 
+// ----------------------------------------------------------------------------
+// Function testAlignSimdScoreAdaptive()
+// ----------------------------------------------------------------------------
+
+// Mixes short and long pairs, such that some pairs are computed in 8 bit lanes and the others are promoted to
+// wider lanes.
+template <typename TTester,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlignConfig>
+void testAlignSimdScoreAdaptive(TTester const &,
+                                seqan2::Score<TScoreValue, TScoreSpec> const & score,
+                                TAlignConfig const & config)
+{
+    std::mt19937 rng(42);
+    unsigned const lengths[] = {4, 9, 17, 40, 130, 7};
+
+    seqan2::StringSet<seqan2::String<seqan2::Dna> > setH;
+    seqan2::StringSet<seqan2::String<seqan2::Dna> > setV;
+    for (unsigned i = 0; i < 75; ++i)
+    {
+        seqan2::String<seqan2::Dna> seqH;
+        seqan2::String<seqan2::Dna> seqV;
+        for (unsigned j = 0; j < lengths[i % 6]; ++j)
+            appendValue(seqH, seqan2::Dna(rng() % 4));
+        for (unsigned j = lengths[i % 6] + rng() % 5; j > 0; --j)
+            appendValue(seqV, seqan2::Dna(rng() % 4));
+        appendValue(setH, seqH);
+        appendValue(setV, seqV);
+    }
+
+    int const lDiag = std::numeric_limits<int>::min();
+    int const uDiag = std::numeric_limits<int>::max();
+    seqan2::String<TScoreValue> scores = TTester::run(setH, setV, score, config, lDiag, uDiag);
+    SEQAN_ASSERT_EQ(length(scores), length(setH));
+
+    for (unsigned i = 0; i < length(setH); ++i)
+        SEQAN_ASSERT_EQ(scores[i], TTester::run(setH[i], setV[i], score, config, lDiag, uDiag));
+}
+
+#ifdef SEQAN_SIMD_ENABLED
+// ----------------------------------------------------------------------------
+// Function testAlignSimdScoreNarrow()
+// ----------------------------------------------------------------------------
+
+// Computes pairs of reads and mutated copies in 8 bit lanes and checks that exactly the given pairs are left for
+// wider lanes, and that the scores of all others are correct.
+template <typename TAlphabet,
+          typename TTester,
+          typename TAlgo,
+          typename TScoreValue, typename TScoreSpec,
+          typename TAlignConfig,
+          typename TGapModel>
+void testAlignSimdScoreNarrow(TTester const &,
+                              TAlgo const &,
+                              seqan2::Score<TScoreValue, TScoreSpec> const & score,
+                              TAlignConfig const & config,
+                              TGapModel const &,
+                              unsigned const readLength,
+                              unsigned const numMutations,
+                              std::vector<unsigned> const & expectedWide)
+{
+    typedef typename seqan2::SubstituteAlignConfig_<TAlignConfig>::Type TFreeEndGaps;
+    typedef seqan2::AlignConfig2<TAlgo, seqan2::DPBandConfig<seqan2::BandOff>, TFreeEndGaps,
+                                 seqan2::TracebackOff> TAlignConfig2;
+
+    std::mt19937 rng(42);
+    unsigned const alphabetSize = seqan2::ValueSize<TAlphabet>::VALUE;
+    seqan2::StringSet<seqan2::String<TAlphabet> > setH;
+    seqan2::StringSet<seqan2::String<TAlphabet> > setV;
+    for (unsigned i = 0; i < 100; ++i)
+    {
+        seqan2::String<TAlphabet> seqH;
+        for (unsigned j = 0; j < readLength - i % 3; ++j)
+            appendValue(seqH, TAlphabet(rng() % alphabetSize));
+        seqan2::String<TAlphabet> seqV = seqH;
+        // The expected pairs are not mutated.
+        if (std::find(expectedWide.begin(), expectedWide.end(), i) == expectedWide.end())
+            for (unsigned j = 0; j < numMutations; ++j)
+                seqV[rng() % length(seqV)] = TAlphabet(rng() % alphabetSize);
+        appendValue(setH, seqH);
+        appendValue(setV, seqV);
+    }
+
+    seqan2::String<TScoreValue> results;
+    resize(results, length(setH));
+    seqan2::String<unsigned> positions;
+    for (unsigned i = 0; i < length(setH); ++i)
+        appendValue(positions, i);
+
+    seqan2::_alignWrapperSimdNarrow<int8_t>(results, positions, setH, setV, score, TAlignConfig2(), TGapModel(),
+                                           std::true_type());
+
+    SEQAN_ASSERT_EQ(length(positions), expectedWide.size());
+    for (unsigned i = 0; i < length(positions); ++i)
+        SEQAN_ASSERT_EQ(positions[i], expectedWide[i]);
+
+    int const lDiag = std::numeric_limits<int>::min();
+    int const uDiag = std::numeric_limits<int>::max();
+    for (unsigned i = 0; i < length(setH); ++i)
+        if (std::find(expectedWide.begin(), expectedWide.end(), i) == expectedWide.end())
+            SEQAN_ASSERT_EQ(results[i], TTester::run(setH[i], setV[i], score, config, lDiag, uDiag));
+}
+#endif  // SEQAN_SIMD_ENABLED
+
 #endif  // #ifndef TESTS_ALIGN_TEST_ALIGN_SIMD_BASE_H_
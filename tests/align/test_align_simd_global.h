@@ -119,4 +119,31 @@ SEQAN_TYPED_TEST(SimdAlignTestCommon, Dynamic_Score_Matrix)
                                          TAlignConf(), TLengthParam(), TBandSwitch());
 }
 
+SEQAN_TYPED_TEST(SimdAlignTestCommon, Adaptive_Score)
+{
+    using TAlignConf = typename TestFixture::TAlignConfig;
+
+    // Fits into 8 bit lanes for the short pairs, 16 bit lanes for the others.
+    testAlignSimdScoreAdaptive(impl::test_align_simd::GlobalAlignScoreTester_(), seqan2::Score<int>(2, -1, -1), TAlignConf());
+    testAlignSimdScoreAdaptive(impl::test_align_simd::GlobalAlignScoreTester_(), seqan2::Score<int>(2, -1, -1, -3), TAlignConf());
+    // Overflows 16 bit lanes for the long pairs.
+    testAlignSimdScoreAdaptive(impl::test_align_simd::GlobalAlignScoreTester_(), seqan2::Score<int>(100, -90, -80, -300),
+                               TAlignConf());
+}
+
+#ifdef SEQAN_SIMD_ENABLED
+SEQAN_TYPED_TEST(SimdAlignTestCommon, Narrow_Score)
+{
+    using TAlignConf = typename TestFixture::TAlignConfig;
+
+    // Reads of 50 bp are computed in 8 bit lanes.
+    testAlignSimdScoreNarrow<seqan2::Dna>(impl::test_align_simd::GlobalAlignScoreTester_(), seqan2::DPGlobal(),
+                                          seqan2::Score<int>(1, -1, -1), TAlignConf(), seqan2::LinearGaps(), 50, 3,
+                                          std::vector<unsigned>());
+    testAlignSimdScoreNarrow<seqan2::Dna>(impl::test_align_simd::GlobalAlignScoreTester_(), seqan2::DPGlobal(),
+                                          seqan2::Score<int>(1, -1, -1, -2), TAlignConf(), seqan2::AffineGaps(), 50, 3,
+                                          std::vector<unsigned>());
+}
+#endif  // SEQAN_SIMD_ENABLED
+
 #endif  // #ifndef TESTS_ALIGN_TEST_ALIGN_SIMD_GLOBAL_H_
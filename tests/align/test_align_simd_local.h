@@ -119,4 +119,35 @@ SEQAN_TYPED_TEST(SimdAlignTestCommon, Dynamic_Score_Matrix)
                                          TAlignConf(), TLengthParam(), TBandSwitch());
 }
 
+SEQAN_TYPED_TEST(SimdAlignTestCommon, Adaptive_Score)
+{
+    using TAlignConf = typename TestFixture::TAlignConfig;
+
+    // Fits into 8 bit lanes for the short pairs, 16 bit lanes for the others.
+    testAlignSimdScoreAdaptive(impl::test_align_simd::LocalScoreTester_(), seqan2::Score<int>(2, -1, -1), TAlignConf());
+    testAlignSimdScoreAdaptive(impl::test_align_simd::LocalScoreTester_(), seqan2::Score<int>(2, -1, -1, -3), TAlignConf());
+    // Overflows 16 bit lanes for the long pairs.
+    testAlignSimdScoreAdaptive(impl::test_align_simd::LocalScoreTester_(), seqan2::Score<int>(100, -90, -80, -300),
+                               TAlignConf());
+}
+
+#ifdef SEQAN_SIMD_ENABLED
+SEQAN_TYPED_TEST(SimdAlignTestCommon, Narrow_Score)
+{
+    using TAlignConf = typename TestFixture::TAlignConfig;
+
+    // Reads of 100 bp are computed in 8 bit lanes.
+    testAlignSimdScoreNarrow<seqan2::Dna>(impl::test_align_simd::LocalScoreTester_(), seqan2::DPLocal(),
+                                          seqan2::Score<int>(1, -4, -1, -6), TAlignConf(), seqan2::AffineGaps(), 100, 3,
+                                          std::vector<unsigned>());
+    testAlignSimdScoreNarrow<seqan2::Dna>(impl::test_align_simd::LocalScoreTester_(), seqan2::DPLocal(),
+                                          seqan2::Score<int>(1, -1, -1), TAlignConf(), seqan2::LinearGaps(), 120, 2,
+                                          std::vector<unsigned>());
+    // Only the identical pairs overflow and are left for wider lanes.
+    testAlignSimdScoreNarrow<seqan2::Dna>(impl::test_align_simd::LocalScoreTester_(), seqan2::DPLocal(),
+                                          seqan2::Score<int>(2, -4, -2, -6), TAlignConf(), seqan2::AffineGaps(), 100, 40,
+                                          std::vector<unsigned>{7, 50, 51});
+}
+#endif  // SEQAN_SIMD_ENABLED
+
 #endif  // #ifndef TESTS_ALIGN_TEST_ALIGN_SIMD_LOCAL_H_
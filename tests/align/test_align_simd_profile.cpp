@@ -0,0 +1,152 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests the batch order and the lane utilization profile of the SIMD
+// alignment.
+// ==========================================================================
+
+#define SEQAN_ALIGN_SIMD_PROFILE 1
+
+#include <seqan/basic.h>
+#include <seqan/stream.h>
+
+#include <seqan/align.h>
+
+#ifdef SEQAN_SIMD_ENABLED
+
+SEQAN_DEFINE_TEST(test_align_simd_sort_batch_positions)
+{
+    using namespace seqan2;
+
+    StringSet<DnaString> stringsH;
+    StringSet<DnaString> stringsV;
+    unsigned const lengthsH[6] = {5, 3, 5, 1, 3, 5};
+    unsigned const lengthsV[6] = {2, 4, 1, 1, 4, 2};
+    for (unsigned i = 0; i < 6; ++i)
+    {
+        appendValue(stringsH, DnaString(std::string(lengthsH[i], 'A')));
+        appendValue(stringsV, DnaString(std::string(lengthsV[i], 'C')));
+    }
+
+    String<unsigned> positions;
+    for (unsigned i = 0; i < 6; ++i)
+        appendValue(positions, i);
+    _sortSimdBatchPositions(positions, stringsH, stringsV);
+
+    // Ordered by the lengths of the first and then of the second sequence, equal pairs keep their order.
+    unsigned const expected[6] = {3, 1, 4, 2, 0, 5};
+    SEQAN_ASSERT_EQ(length(positions), 6u);
+    for (unsigned i = 0; i < 6; ++i)
+        SEQAN_ASSERT_EQ(positions[i], expected[i]);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_record_lane_utilization)
+{
+    using namespace seqan2;
+
+    StringSet<DnaString> batchH;
+    StringSet<DnaString> batchV;
+    unsigned const lengthsH[4] = {2, 3, 4, 4};
+    unsigned const lengthsV[4] = {3, 3, 2, 5};
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        appendValue(batchH, DnaString(std::string(lengthsH[i], 'A')));
+        appendValue(batchV, DnaString(std::string(lengthsV[i], 'C')));
+    }
+
+    // The last pair only fills up the batch, all lanes are computed up to the longest sequences.
+    profile.clear();
+    _recordSimdLaneUtilization(batchH, batchV, 3u);
+    SEQAN_ASSERT_EQ(profile.usedCells, 2u * 3u + 3u * 3u + 4u * 2u);
+    SEQAN_ASSERT_EQ(profile.computedCells, 4u * 4u * 5u);
+    SEQAN_ASSERT_EQ(profile.laneUtilization(), 23.0 / 80.0);
+}
+
+SEQAN_DEFINE_TEST(test_align_simd_lane_utilization)
+{
+    using namespace seqan2;
+
+    // Alternate short and long pairs.  Sorted into batches, no lane computes more cells than its own pair needs,
+    // as each group fills whole batches of any vector width.
+    StringSet<Dna5String> seqsH;
+    StringSet<Dna5String> seqsV;
+    uint64_t usedCells = 0;
+    for (unsigned i = 0; i < 128; ++i)
+    {
+        unsigned const len = (i % 2 == 0) ? 10 : 100;
+        Dna5String seqH;
+        Dna5String seqV;
+        for (unsigned j = 0; j < len; ++j)
+        {
+            appendValue(seqH, Dna5((i + j) % 4));
+            appendValue(seqV, Dna5((i + 3 * j) % 4));
+        }
+        appendValue(seqsH, seqH);
+        appendValue(seqsV, seqV);
+        usedCells += static_cast<uint64_t>(len) * len;
+    }
+
+    StringSet<Gaps<Dna5String> > gapsH;
+    StringSet<Gaps<Dna5String> > gapsV;
+    for (unsigned i = 0; i < length(seqsH); ++i)
+    {
+        appendValue(gapsH, Gaps<Dna5String>(seqsH[i]));
+        appendValue(gapsV, Gaps<Dna5String>(seqsV[i]));
+    }
+
+    profile.clear();
+    String<int> scores = globalAlignment(gapsH, gapsV, Score<int, Simple>(1, -1, -1));
+    SEQAN_ASSERT_EQ(length(scores), 128u);
+    SEQAN_ASSERT_EQ(profile.usedCells, usedCells);
+    SEQAN_ASSERT_EQ(profile.computedCells, usedCells);
+    SEQAN_ASSERT_EQ(profile.laneUtilization(), 1.0);
+
+    // A single pair leaves all other lanes idle.
+    resize(gapsH, 1);
+    resize(gapsV, 1);
+    profile.clear();
+    globalAlignment(gapsH, gapsV, Score<int, Simple>(1, -1, -1));
+    SEQAN_ASSERT_EQ(profile.usedCells, 100u);
+    SEQAN_ASSERT_GT(profile.computedCells, profile.usedCells);
+    SEQAN_ASSERT_EQ(profile.computedCells % profile.usedCells, 0u);
+}
+
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+
+SEQAN_BEGIN_TESTSUITE(test_align_simd_profile)
+{
+#ifdef SEQAN_SIMD_ENABLED
+    SEQAN_CALL_TEST(test_align_simd_sort_batch_positions);
+    SEQAN_CALL_TEST(test_align_simd_record_lane_utilization);
+    SEQAN_CALL_TEST(test_align_simd_lane_utilization);
+#endif  // #ifdef SEQAN_SIMD_ENABLED
+}
+SEQAN_END_TESTSUITE
@@ -0,0 +1,164 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the striped alignment of single pairs.
+// ==========================================================================
+
+#ifndef TESTS_ALIGN_TEST_ALIGN_STRIPED_H_
+#define TESTS_ALIGN_TEST_ALIGN_STRIPED_H_
+
+#include <random>
+
+#include <seqan/basic.h>
+#include <seqan/align.h>
+
+namespace impl
+{
+namespace test_align_striped
+{
+
+struct GlobalStripedTester_
+{
+    template <typename TAlign, typename TScoreValue, typename TScoreSpec>
+    static auto
+    run(TAlign & align, seqan2::Score<TScoreValue, TScoreSpec> const & score)
+    {
+        return globalAlignment(align, score, seqan2::Striped());
+    }
+
+    template <typename TStringH, typename TStringV, typename TScoreValue, typename TScoreSpec>
+    static auto
+    runScore(TStringH const & strH, TStringV const & strV, seqan2::Score<TScoreValue, TScoreSpec> const & score)
+    {
+        return globalAlignmentScore(strH, strV, score, seqan2::Striped());
+    }
+
+    template <typename TStringH, typename TStringV, typename TScoreValue, typename TScoreSpec>
+    static auto
+    expected(TStringH const & strH, TStringV const & strV, seqan2::Score<TScoreValue, TScoreSpec> const & score)
+    {
+        return globalAlignmentScore(strH, strV, score);
+    }
+};
+
+struct LocalStripedTester_
+{
+    template <typename TAlign, typename TScoreValue, typename TScoreSpec>
+    static auto
+    run(TAlign & align, seqan2::Score<TScoreValue, TScoreSpec> const & score)
+    {
+        return localAlignment(align, score, seqan2::Striped());
+    }
+
+    template <typename TStringH, typename TStringV, typename TScoreValue, typename TScoreSpec>
+    static auto
+    runScore(TStringH const & strH, TStringV const & strV, seqan2::Score<TScoreValue, TScoreSpec> const & score)
+    {
+        return localAlignmentScore(strH, strV, score, seqan2::Striped());
+    }
+
+    template <typename TStringH, typename TStringV, typename TScoreValue, typename TScoreSpec>
+    static auto
+    expected(TStringH const & strH, TStringV const & strV, seqan2::Score<TScoreValue, TScoreSpec> const & score)
+    {
+        return localAlignmentScore(strH, strV, score);
+    }
+};
+
+}  // namespace test_align_striped
+}  // namespace impl
+
+// ----------------------------------------------------------------------------
+// Function testAlignStriped()
+// ----------------------------------------------------------------------------
+
+// Compares the striped alignment of single pairs against the standard DP algorithm.  The lengths cover vertical
+// sequences shorter than, equal to and many times the number of lanes.
+template <typename TAlphabet,
+          typename TTester,
+          typename TScoreValue, typename TScoreSpec>
+void testAlignStriped(TTester const &,
+                      seqan2::Score<TScoreValue, TScoreSpec> const & score)
+{
+    std::mt19937 rng(42);
+    unsigned const lengths[][2] = {{1, 1}, {1, 9}, {13, 4}, {40, 45}, {130, 127}, {300, 290}, {1000, 1010}};
+
+    for (auto const & len : lengths)
+    {
+        seqan2::String<TAlphabet> seqH;
+        seqan2::String<TAlphabet> seqV;
+        for (unsigned j = 0; j < len[0]; ++j)
+            appendValue(seqH, TAlphabet(rng() % seqan2::ValueSize<TAlphabet>::VALUE));
+        // Let half of the vertical sequence be a mutated copy of the horizontal one.
+        for (unsigned j = 0; j < len[1]; ++j)
+            appendValue(seqV, (j < len[0] && rng() % 2) ? seqH[j] : TAlphabet(rng() % seqan2::ValueSize<TAlphabet>::VALUE));
+
+        TScoreValue const expected = TTester::expected(seqH, seqV, score);
+        SEQAN_ASSERT_EQ(TTester::runScore(seqH, seqV, score), expected);
+
+        seqan2::Align<seqan2::String<TAlphabet> > align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), seqH);
+        assignSource(row(align, 1), seqV);
+        SEQAN_ASSERT_EQ(TTester::run(align, score), expected);
+
+        seqan2::AlignmentStats stats;
+        SEQAN_ASSERT_EQ(computeAlignmentStats(stats, align, score), expected);
+    }
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+SEQAN_DEFINE_TEST(test_align_striped_global)
+{
+    using namespace seqan2;
+
+    testAlignStriped<Dna>(::impl::test_align_striped::GlobalStripedTester_(), Score<int>(2, -1, -1));
+    testAlignStriped<Dna>(::impl::test_align_striped::GlobalStripedTester_(), Score<int>(2, -1, -1, -3));
+    testAlignStriped<AminoAcid>(::impl::test_align_striped::GlobalStripedTester_(), Blosum62(-2, -4));
+    // Overflows 16 bit lanes for the long pairs.
+    testAlignStriped<Dna>(::impl::test_align_striped::GlobalStripedTester_(), Score<int>(100, -90, -80, -300));
+}
+
+SEQAN_DEFINE_TEST(test_align_striped_local)
+{
+    using namespace seqan2;
+
+    testAlignStriped<Dna>(::impl::test_align_striped::LocalStripedTester_(), Score<int>(2, -1, -1));
+    testAlignStriped<Dna>(::impl::test_align_striped::LocalStripedTester_(), Score<int>(2, -1, -1, -3));
+    testAlignStriped<AminoAcid>(::impl::test_align_striped::LocalStripedTester_(), Blosum62(-2, -4));
+    // Overflows 16 bit lanes for the long pairs.
+    testAlignStriped<Dna>(::impl::test_align_striped::LocalStripedTester_(), Score<int>(100, -90, -80, -300));
+}
+
+#endif  // #ifndef TESTS_ALIGN_TEST_ALIGN_STRIPED_H_
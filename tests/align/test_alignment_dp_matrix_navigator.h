@@ -871,4 +871,134 @@ SEQAN_DEFINE_TEST(test_alignment_dp_matrix_navigator_trace_matrix_enabled_to_glo
     }
 }
 
+SEQAN_DEFINE_TEST(test_alignment_dp_matrix_navigator_trace_matrix_packed_assign_value)
+{
+    using namespace seqan2;
+
+    typedef TraceBitMap_<> TBitMap;
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > TTraceFlag;
+    typedef DPMatrix_<PackedTraceValue_<AffineGaps>, FullDPMatrix, PackedTraceMatrixHost_<AffineGaps>::Type> TDPMatrix;
+
+    TDPMatrix dpMatrix;
+    setLength(dpMatrix, DPMatrixDimension_::HORIZONTAL, 10);
+    setLength(dpMatrix, DPMatrixDimension_::VERTICAL, 10);
+    resize(dpMatrix);
+
+    DPMatrixNavigator_<TDPMatrix, DPTraceMatrix<TTraceFlag>, NavigateColumnWise>
+        navi{dpMatrix, DPBandConfig<BandOff>{}};
+    SEQAN_ASSERT_EQ(scalarValue(navi), TBitMap::NONE);
+
+    TBitMap::Type traceValues[4] =
+    {
+        TBitMap::DIAGONAL | TBitMap::HORIZONTAL | TBitMap::VERTICAL_OPEN,
+        TBitMap::MAX_FROM_VERTICAL_MATRIX | TBitMap::HORIZONTAL_OPEN | TBitMap::VERTICAL,
+        TBitMap::MAX_FROM_HORIZONTAL_MATRIX | TBitMap::HORIZONTAL | TBitMap::VERTICAL,
+        TBitMap::NONE
+    };
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        _setToPosition(navi, 17u + i);
+        assignValue(navi, traceValues[i]);
+    }
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        _setToPosition(navi, 17u + i);
+        SEQAN_ASSERT_EQ(position(navi), 17u + i);
+        SEQAN_ASSERT_EQ(scalarValue(navi), traceValues[i]);
+    }
+
+    // Sixteen cells share one 64 bit word.
+    SEQAN_ASSERT_EQ(length(host(dpMatrix)), 100u);
+    SEQAN_ASSERT_LEQ(length(host(host(dpMatrix))), 8u);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_matrix_navigator_trace_matrix_packed_alignment)
+{
+    using namespace seqan2;
+
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > TTraceFlag;
+    typedef String<TraceSegment_<unsigned, unsigned> > TTraceSegments;
+
+    Dna5String strH = "AAACGTGCTTTAGGCATTACCGATTACGAGGCTAACC";
+    Dna5String strV = "AAAGGCTTAGCATTTACCGTTACGAGAAGCTACC";
+
+    // Affine gaps, global and local, banded and unbanded.
+    {
+        typedef DPCell_<int, AffineGaps> TDPCell;
+        Score<int, Simple> scoringScheme(2, -3, -1, -5);
+
+        DPContext<TDPCell, TraceBitMap_<>::Type> dpContext;
+        DPContext<TDPCell, PackedTraceValue_<AffineGaps>, String<TDPCell>,
+                  PackedTraceMatrixHost_<AffineGaps>::Type> packedContext;
+        DPScoutState_<Default> scoutState;
+
+        TTraceSegments traces;
+        TTraceSegments packedTraces;
+        int score = _computeAlignment(dpContext, traces, scoutState, strH, strV, scoringScheme,
+                                      DPBandConfig<BandOff>(),
+                                      DPProfile_<GlobalAlignment_<>, AffineGaps, TTraceFlag>());
+        SEQAN_ASSERT_EQ(_computeAlignment(packedContext, packedTraces, scoutState, strH, strV, scoringScheme,
+                                          DPBandConfig<BandOff>(),
+                                          DPProfile_<GlobalAlignment_<>, AffineGaps, TTraceFlag>()), score);
+        SEQAN_ASSERT_EQ(length(traces), length(packedTraces));
+        for (unsigned i = 0; i < length(traces); ++i)
+            SEQAN_ASSERT(traces[i] == packedTraces[i]);
+
+        clear(traces);
+        clear(packedTraces);
+        score = _computeAlignment(dpContext, traces, scoutState, strH, strV, scoringScheme,
+                                  DPBandConfig<BandOn>(-4, 6),
+                                  DPProfile_<LocalAlignment_<>, AffineGaps, TTraceFlag>());
+        SEQAN_ASSERT_EQ(_computeAlignment(packedContext, packedTraces, scoutState, strH, strV, scoringScheme,
+                                          DPBandConfig<BandOn>(-4, 6),
+                                          DPProfile_<LocalAlignment_<>, AffineGaps, TTraceFlag>()), score);
+        SEQAN_ASSERT_EQ(length(traces), length(packedTraces));
+        for (unsigned i = 0; i < length(traces); ++i)
+            SEQAN_ASSERT(traces[i] == packedTraces[i]);
+    }
+
+    // Linear gaps with free end gaps.
+    {
+        typedef DPCell_<int, LinearGaps> TDPCell;
+        typedef DPProfile_<GlobalAlignment_<FreeEndGaps_<True, True, True, True> >, LinearGaps, TTraceFlag> TDPProfile;
+        Score<int, Simple> scoringScheme(2, -1, -2);
+
+        DPContext<TDPCell, TraceBitMap_<>::Type> dpContext;
+        DPContext<TDPCell, PackedTraceValue_<LinearGaps>, String<TDPCell>,
+                  PackedTraceMatrixHost_<LinearGaps>::Type> packedContext;
+        DPScoutState_<Default> scoutState;
+
+        TTraceSegments traces;
+        TTraceSegments packedTraces;
+        int score = _computeAlignment(dpContext, traces, scoutState, strH, strV, scoringScheme,
+                                      DPBandConfig<BandOff>(), TDPProfile());
+        SEQAN_ASSERT_EQ(_computeAlignment(packedContext, packedTraces, scoutState, strH, strV, scoringScheme,
+                                          DPBandConfig<BandOff>(), TDPProfile()), score);
+        SEQAN_ASSERT_EQ(length(traces), length(packedTraces));
+        for (unsigned i = 0; i < length(traces); ++i)
+            SEQAN_ASSERT(traces[i] == packedTraces[i]);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_matrix_navigator_trace_matrix_packed_selection)
+{
+    using namespace seqan2;
+
+    typedef TracebackOn<TracebackConfig_<SingleTrace, GapsLeft> > TSingleTrace;
+    typedef TracebackOn<TracebackConfig_<CompleteTrace, GapsLeft> > TCompleteTrace;
+
+    // Only single traces of linear and affine gaps are packed.
+    static_assert(CanPackTraceMatrix_<TSingleTrace, AffineGaps>::VALUE, "Expected a packed trace matrix.");
+    static_assert(CanPackTraceMatrix_<TSingleTrace, LinearGaps>::VALUE, "Expected a packed trace matrix.");
+    static_assert(!CanPackTraceMatrix_<TCompleteTrace, AffineGaps>::VALUE, "Expected an unpacked trace matrix.");
+    static_assert(!CanPackTraceMatrix_<TracebackOff, AffineGaps>::VALUE, "Expected an unpacked trace matrix.");
+    static_assert(!CanPackTraceMatrix_<TSingleTrace, DynamicGaps>::VALUE, "Expected an unpacked trace matrix.");
+
+    // The algorithm tags are substituted by the gap model inside of the packed trace tag.
+    static_assert(IsSameType<SubstituteAlgoTag_<PackedTrace<Gotoh> >::Type, PackedTrace<AffineGaps> >::VALUE,
+                  "Expected PackedTrace<AffineGaps>.");
+    static_assert(IsSameType<SubstituteAlgoTag_<PackedTrace<LinearGaps> >::Type, PackedTrace<LinearGaps> >::VALUE,
+                  "Expected PackedTrace<LinearGaps>.");
+}
+
 #endif  // #ifndef SANDBOX_RMAERKER_TESTS_ALIGN2_TEST_ALIGNMENT_DP_MATRIX_NAVIGATOR_H_
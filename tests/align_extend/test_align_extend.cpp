@@ -46,6 +46,9 @@ SEQAN_BEGIN_TESTSUITE(test_align_extend)
     SEQAN_CALL_TEST(test_align_extend_banded);
     SEQAN_CALL_TEST(test_align_extend_xdrop);
     SEQAN_CALL_TEST(test_align_extend_xdrop_banded);
+    SEQAN_CALL_TEST(test_align_extend_zdrop_banded);
+    SEQAN_CALL_TEST(test_align_extend_difference_recurrence_random);
+    SEQAN_CALL_TEST(test_align_extend_xdrop_batch);
     SEQAN_CALL_TEST(test_align_extend_semiglobal);
 }
 SEQAN_END_TESTSUITE
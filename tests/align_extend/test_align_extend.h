@@ -37,6 +37,9 @@
 #ifndef SEQAN_TESTS_ALIGN_TEST_ALIGN_EXTEND_H_
 #define SEQAN_TESTS_ALIGN_TEST_ALIGN_EXTEND_H_
 
+#include <random>
+#include <vector>
+
 #include <seqan/basic.h>
 #include <seqan/sequence.h>
 
@@ -532,6 +535,232 @@ SEQAN_DEFINE_TEST(test_align_extend_xdrop_banded)
 
 }
 
+SEQAN_DEFINE_TEST(test_align_extend_zdrop_banded)
+{
+    using namespace seqan2;
+    Score<int> sc(2, -1, -2);
+
+    Align<typename Infix<CharString const>::Type, ArrayGaps> align;
+
+    resize(rows(align), 2);
+
+    // large ZDrop -> alignment spans local minimum of scores
+    {
+        CharString const s1("NNNNNNNNNNTTCCGGGA"  "GGTA""CACACACGGGGGGGGGGG");
+        CharString const s2(           "CTCGGGAC" "GGTA" "AGGCACGGTTTTTGGGG");
+
+        assignSource(row(align, 0), infix(s1, 18, 22));
+        assignSource(row(align, 1), infix(s2, 8, 12));
+
+        globalAlignment(align, sc);
+
+        Tuple<unsigned, 4> const positions = { {18u,8u,22u,12u} };
+        int score = extendAlignment(align,
+                                    s1,
+                                    s2,
+                                    positions,
+                                    EXTEND_BOTH,
+                                    -3,
+                                    +3,
+                                    100,
+                                    sc,
+                                    DifferenceRecurrence());
+
+        SEQAN_ASSERT_EQ(score, 27);
+        SEQAN_ASSERT_EQ(CharString("CGGGA-""GGTA""CACACACGGGGGGGGGGG"),
+                        row(align, 0));
+        SEQAN_ASSERT_EQ(CharString("CGGGAC""GGTA""-AGGCACGGTTTTTGGGG"),
+                        row(align, 1));
+
+        SEQAN_ASSERT_EQ(clippedBeginPosition(row(align, 0)), 13);
+        SEQAN_ASSERT_EQ(clippedBeginPosition(row(align, 1)), 2);
+        SEQAN_ASSERT_EQ(clippedEndPosition(row(align, 0)), 41);
+        SEQAN_ASSERT_EQ(clippedEndPosition(row(align, 1)), 30);
+    }
+
+    // small ZDrop -> alignment stops before local minimum of scores
+    {
+        CharString const s1("NNNNNNNNNNTTCCGGGA"  "GGTA""CACACACGGGGGGGGGGG");
+        CharString const s2(           "CTCGGGAC" "GGTA" "AGGCACGGTTTTTGGGG");
+
+        assignSource(row(align, 0), infix(s1, 18, 22));
+        assignSource(row(align, 1), infix(s2, 8, 12));
+
+        globalAlignment(align, sc);
+
+        Tuple<unsigned, 4> const positions = { {18u,8u,22u,12u} };
+        int score = extendAlignment(align,
+                                    s1,
+                                    s2,
+                                    positions,
+                                    EXTEND_BOTH,
+                                    -3,
+                                    +3,
+                                    3,
+                                    sc,
+                                    DifferenceRecurrence());
+
+        SEQAN_ASSERT_EQ(score, 24);
+        SEQAN_ASSERT_EQ(CharString("CGGGA-""GGTA""CACACACGG"), row(align, 0));
+        SEQAN_ASSERT_EQ(CharString("CGGGAC""GGTA""-AGGCACGG"), row(align, 1));
+
+        SEQAN_ASSERT_EQ(clippedBeginPosition(row(align, 0)), 13);
+        SEQAN_ASSERT_EQ(clippedBeginPosition(row(align, 1)), 2);
+        SEQAN_ASSERT_EQ(clippedEndPosition(row(align, 0)), 32);
+        SEQAN_ASSERT_EQ(clippedEndPosition(row(align, 1)), 21);
+    }
+}
+
+// Returns the best score of all cells in the band [lowerDiag, upperDiag] of the affine dynamic programming matrix.
+template <typename TSequence, typename TScore>
+int testAlignExtendBestBandedScore(TSequence const & strH, TSequence const & strV, TScore const & scoringScheme,
+                                   int lowerDiag, int upperDiag)
+{
+    int const negInf = -(1 << 20);
+    int const gapOpen = scoreGapOpen(scoringScheme);
+    int const gapExtend = scoreGapExtend(scoringScheme);
+    int const n = length(strH);
+    int const m = length(strV);
+
+    std::vector<std::vector<int> > h(m + 1, std::vector<int>(n + 1, negInf));
+    std::vector<std::vector<int> > e(m + 1, std::vector<int>(n + 1, negInf));
+    std::vector<std::vector<int> > f(m + 1, std::vector<int>(n + 1, negInf));
+    int best = 0;
+    for (int i = 0; i <= m; ++i)
+    {
+        for (int j = 0; j <= n; ++j)
+        {
+            if (j - i < lowerDiag || j - i > upperDiag)
+                continue;
+            if (i > 0)
+                e[i][j] = std::max(e[i - 1][j] + gapExtend, h[i - 1][j] + gapOpen);
+            if (j > 0)
+                f[i][j] = std::max(f[i][j - 1] + gapExtend, h[i][j - 1] + gapOpen);
+            h[i][j] = std::max(e[i][j], f[i][j]);
+            if (i == 0 && j == 0)
+                h[i][j] = 0;
+            else if (i > 0 && j > 0)
+                h[i][j] = std::max(h[i][j], h[i - 1][j - 1] + score(scoringScheme, strH[j - 1], strV[i - 1]));
+            best = std::max(best, h[i][j]);
+        }
+    }
+    return best;
+}
+
+SEQAN_DEFINE_TEST(test_align_extend_difference_recurrence_random)
+{
+    using namespace seqan2;
+
+    // Without z-drop the extension ends in the best cell of the band.
+    std::mt19937 rng(42);
+    Score<int, Simple> scoringSchemes[] = {Score<int, Simple>(2, -4, -2, -6), Score<int, Simple>(1, -1, -1),
+                                           Score<int, Simple>(3, -2, -1, -4)};
+    for (unsigned i = 0; i < 200; ++i)
+    {
+        Score<int, Simple> const & scoringScheme = scoringSchemes[i % 3];
+
+        Dna5String strH;
+        Dna5String strV;
+        unsigned const lengthH = 1 + rng() % 60;
+        unsigned const lengthV = 1 + rng() % 60;
+        for (unsigned k = 0; k < lengthH; ++k)
+            appendValue(strH, Dna5(rng() % 4));
+        for (unsigned k = 0; k < lengthV; ++k)
+            appendValue(strV, (k < lengthH && rng() % 4) ? strH[k] : Dna5(rng() % 4));
+        int const lowerDiag = -static_cast<int>(rng() % 8);
+        int const upperDiag = static_cast<int>(rng() % 8);
+
+        String<TraceSegment_<unsigned, unsigned> > traceSegments;
+        SEQAN_ASSERT_EQ(_alignDifferenceRecurrence(traceSegments, strH, strV, scoringScheme, lowerDiag, upperDiag,
+                                                   true, -1, TracebackOff()),
+                        testAlignExtendBestBandedScore(strH, strV, scoringScheme, lowerDiag, upperDiag));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_extend_xdrop_batch)
+{
+    using namespace seqan2;
+
+    StringSet<Dna5String> hSeqs;
+    StringSet<Dna5String> vSeqs;
+    appendValue(hSeqs, "ACGTACGT");
+    appendValue(vSeqs, "ACGTACGT");
+    appendValue(hSeqs, "ACGTTTTTTTTTTTTTTTTT");
+    appendValue(vSeqs, "ACGTAAAAAAAAAAAAAAAA");
+    appendValue(hSeqs, "ACGTACGTACGT");
+    appendValue(vSeqs, "ACGTCACGTACGT");
+    appendValue(hSeqs, "");
+    appendValue(vSeqs, "ACGT");
+
+    // More pairs than lanes with different lengths and similarities.
+    std::mt19937 rng(42);
+    for (unsigned i = 0; i < 40; ++i)
+    {
+        Dna5String hSeq;
+        Dna5String vSeq;
+        unsigned const lengthH = rng() % 80;
+        unsigned const lengthV = rng() % 80;
+        for (unsigned k = 0; k < lengthH; ++k)
+            appendValue(hSeq, Dna5(rng() % 4));
+        for (unsigned k = 0; k < lengthV; ++k)
+            appendValue(vSeq, (k < lengthH && rng() % 10 < 8) ? hSeq[k] : Dna5(rng() % 4));
+        appendValue(hSeqs, hSeq);
+        appendValue(vSeqs, vSeq);
+    }
+
+    String<unsigned> positions;
+    for (unsigned i = 0; i < length(hSeqs); ++i)
+        if (!empty(hSeqs[i]) && !empty(vSeqs[i]))
+            appendValue(positions, i);
+
+    // Linear gaps.
+    {
+        Score<int, Simple> sc(1, -1, -1);
+        String<Pair<unsigned> > endPositions;
+        String<int> scores = extendAlignment(endPositions, hSeqs, vSeqs, 2, sc);
+
+        SEQAN_ASSERT_EQ(length(scores), length(hSeqs));
+        SEQAN_ASSERT_EQ(length(endPositions), length(hSeqs));
+        SEQAN_ASSERT_EQ(scores[0], 8);
+        SEQAN_ASSERT_EQ(endPositions[0], Pair<unsigned>(8u, 8u));
+        SEQAN_ASSERT_EQ(scores[1], 4);
+        SEQAN_ASSERT_EQ(endPositions[1], Pair<unsigned>(4u, 4u));
+        SEQAN_ASSERT_EQ(scores[2], 11);
+        SEQAN_ASSERT_EQ(endPositions[2], Pair<unsigned>(12u, 13u));
+        SEQAN_ASSERT_EQ(scores[3], 0);
+        SEQAN_ASSERT_EQ(endPositions[3], Pair<unsigned>(0u, 0u));
+
+        String<int> seqScores;
+        String<Pair<unsigned> > seqEndPositions;
+        resize(seqScores, length(hSeqs), 0);
+        resize(seqEndPositions, length(hSeqs), Pair<unsigned>(0u, 0u));
+        _extendAlignmentXDropSequential(seqScores, seqEndPositions, positions, hSeqs, vSeqs, 2, sc);
+        for (unsigned i = 0; i < length(hSeqs); ++i)
+        {
+            SEQAN_ASSERT_EQ(scores[i], seqScores[i]);
+            SEQAN_ASSERT_EQ(endPositions[i], seqEndPositions[i]);
+        }
+    }
+
+    // Affine gaps.
+    {
+        Score<int, Simple> sc(2, -3, -2, -5);
+        String<Pair<unsigned> > endPositions;
+        String<int> scores = extendAlignment(endPositions, hSeqs, vSeqs, 10, sc);
+
+        String<int> seqScores;
+        String<Pair<unsigned> > seqEndPositions;
+        resize(seqScores, length(hSeqs), 0);
+        resize(seqEndPositions, length(hSeqs), Pair<unsigned>(0u, 0u));
+        _extendAlignmentXDropSequential(seqScores, seqEndPositions, positions, hSeqs, vSeqs, 10, sc);
+        for (unsigned i = 0; i < length(hSeqs); ++i)
+        {
+            SEQAN_ASSERT_EQ(scores[i], seqScores[i]);
+            SEQAN_ASSERT_EQ(endPositions[i], seqEndPositions[i]);
+        }
+    }
+}
+
 SEQAN_DEFINE_TEST(test_align_extend_semiglobal)
 {
     using namespace seqan2;
@@ -58,5 +58,7 @@ SEQAN_BEGIN_TESTSUITE(test_align_split)
     SEQAN_CALL_TEST(test_align_split_insertion_in_reference_gaps_banded);
 
     SEQAN_CALL_TEST(test_align_split_issue_1679);
+
+    SEQAN_CALL_TEST(test_align_split_batch);
 }
 SEQAN_END_TESTSUITE
@@ -558,4 +558,75 @@ SEQAN_DEFINE_TEST(test_align_split_issue_1679)
     SEQAN_ASSERT_EQ(refGapsRight,  "AAATTCTAATATGATGAAGAATCCTGCTT");
 }
 
+SEQAN_DEFINE_TEST(test_align_split_batch)
+{
+    using namespace seqan2;
+
+    StringSet<DnaString> contigs;
+    StringSet<DnaString> readsL;
+    StringSet<DnaString> readsR;
+    appendValue(contigs, "AGCATGTTAGATAAGATAGCTGTGCTAGTAGGCAGTCAGCGCCAT");
+    appendValue(readsL,  "AGCCTGTTAGATAAGATAGCTGTGGT");
+    appendValue(readsR,  "GGCTAGTAGGCAGTCAGCGACAT");
+    appendValue(contigs, "AGCATGTTAGATAAGATAGCTGTGCTAGTAGGCAGTCAGCGCCAT");
+    appendValue(readsL,  "AGCATGTTAGATAAGATAGGGGG");
+    appendValue(readsR,  "CCCCCTGTGCTAGTAGGCAGTCAGCGCCTT");
+    appendValue(contigs, "GAGCCGAGGACCG");
+    appendValue(readsL,  "TTTTTTTTTTTTGAGCCGATTTTTTTT");
+    appendValue(readsR,  "CCCCCCCCCCCCCCCCGGACCGTTTTTTTTTTTTTTTTTTTTTTT");
+    // Fill more than one batch of the widest SIMD vector.
+    for (unsigned i = 0; i < 40; ++i)
+    {
+        appendValue(contigs, contigs[i % 3]);
+        appendValue(readsL, readsL[i % 3]);
+        appendValue(readsR, readsR[i % 3]);
+        if (i % 2)
+        {
+            appendValue(back(readsL), 'A');
+            insertValue(back(readsR), 0, 'C');
+        }
+    }
+
+    Score<int> scoring(1, -3, -4, -5);
+    String<Triple<unsigned, unsigned, unsigned> > splitPositions;
+    String<int> scores = splitAlignment(splitPositions, contigs, readsL, contigs, readsR, scoring,
+                                        AlignConfig<false, true, true, true>());
+
+    SEQAN_ASSERT_EQ(length(scores), length(contigs));
+    SEQAN_ASSERT_EQ(length(splitPositions), length(contigs));
+    for (unsigned i = 0; i < length(contigs); ++i)
+    {
+        Gaps<DnaString> gapsContigL(contigs[i]);
+        Gaps<DnaString> gapsReadL(readsL[i]);
+        Gaps<DnaString> gapsContigR(contigs[i]);
+        Gaps<DnaString> gapsReadR(readsR[i]);
+        int score = splitAlignment(gapsContigL, gapsReadL, gapsContigR, gapsReadR, scoring,
+                                   AlignConfig<false, true, true, true>());
+
+        SEQAN_ASSERT_EQ(scores[i], score);
+        SEQAN_ASSERT_EQ(splitPositions[i].i1, endPosition(gapsContigL));
+        SEQAN_ASSERT_EQ(splitPositions[i].i2, endPosition(gapsReadL));
+        SEQAN_ASSERT_EQ(splitPositions[i].i1, beginPosition(gapsContigR));
+        SEQAN_ASSERT_EQ(splitPositions[i].i3, beginPosition(gapsReadR));
+    }
+
+    // Linear gaps and the default configuration.
+    Score<int> linearScoring(0, -1, -1, -1);
+    scores = splitAlignment(splitPositions, contigs, readsL, contigs, readsR, linearScoring);
+    for (unsigned i = 0; i < length(contigs); ++i)
+    {
+        Gaps<DnaString> gapsContigL(contigs[i]);
+        Gaps<DnaString> gapsReadL(readsL[i]);
+        Gaps<DnaString> gapsContigR(contigs[i]);
+        Gaps<DnaString> gapsReadR(readsR[i]);
+        SEQAN_ASSERT_EQ(scores[i], splitAlignment(gapsContigL, gapsReadL, gapsContigR, gapsReadR, linearScoring));
+        SEQAN_ASSERT_EQ(splitPositions[i].i1, endPosition(gapsContigL));
+    }
+
+    SEQAN_ASSERT_EQ(scores[0], -2);
+    SEQAN_ASSERT_EQ(splitPositions[0].i1, 23u);
+    SEQAN_ASSERT_EQ(splitPositions[0].i2, 23u);
+    SEQAN_ASSERT_EQ(splitPositions[0].i3, 1u);
+}
+
 #endif  // SEQAN_TESTS_ALIGN_SPLIT_TEST_ALIGN_SPLIT_H_
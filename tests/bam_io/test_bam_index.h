@@ -58,6 +58,50 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_index_build)
     SEQAN_ASSERT(_compareBinaryFiles(toCString(tmpOutPath), toCString(expectedBaiFilename)));
 }
 
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_build_parallel)
+{
+    CharString expectedBaiFilename = getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+
+    // Serial build.
+    {
+        CharString tmpOutPath = SEQAN_TEMP_FILENAME();
+        append(tmpOutPath, ".bai");
+
+        BamIndex<Bai> baiIndex;
+        SEQAN_ASSERT(build(baiIndex, toCString(bamFilename)));
+        SEQAN_ASSERT(save(baiIndex, toCString(tmpOutPath)));
+        SEQAN_ASSERT(_compareBinaryFiles(toCString(tmpOutPath), toCString(expectedBaiFilename)));
+    }
+
+    // Parallel build.
+    {
+        CharString tmpOutPath = SEQAN_TEMP_FILENAME();
+        append(tmpOutPath, ".bai");
+
+        ExecutionPolicy<Parallel, Serial> execPolicy;
+        setNumThreads(execPolicy, 4);
+
+        BamIndex<Bai> baiIndex;
+        SEQAN_ASSERT(build(baiIndex, toCString(bamFilename), execPolicy));
+        SEQAN_ASSERT(save(baiIndex, toCString(tmpOutPath)));
+        SEQAN_ASSERT(_compareBinaryFiles(toCString(tmpOutPath), toCString(expectedBaiFilename)));
+    }
+
+    // One block per thread and batch, so records and runs cross batch and thread boundaries.
+    for (size_t threads = 1; threads <= 5; ++threads)
+    {
+        CharString tmpOutPath = SEQAN_TEMP_FILENAME();
+        append(tmpOutPath, ".bai");
+
+        BamIndex<Bai> baiIndex;
+        SEQAN_ASSERT(_baiBuild(baiIndex, toCString(bamFilename), threads, 1));
+        SEQAN_ASSERT(save(baiIndex, toCString(tmpOutPath)));
+        SEQAN_ASSERT(_compareBinaryFiles(toCString(tmpOutPath), toCString(expectedBaiFilename)));
+    }
+}
+
 
 SEQAN_DEFINE_TEST(test_bam_io_bam_index_open)
 {
@@ -230,4 +274,221 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_index_view_records)
     clear(records);
 }
 
+// Build a CSI index with the BAI binning scheme and compare it to the BAI index.
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_csi_build)
+{
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+    CharString baiFilename = getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT(open(baiIndex, toCString(baiFilename)));
+
+    BamIndex<Csi> csiIndex;
+    csiIndex.depth = 5;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+    SEQAN_ASSERT_EQ(csiIndex.minShift, 14);
+    SEQAN_ASSERT_EQ(csiIndex.depth, 5);
+    SEQAN_ASSERT_EQ(getUnalignedCount(csiIndex), getUnalignedCount(baiIndex));
+
+    SEQAN_ASSERT_EQ(length(csiIndex._binIndices), length(baiIndex._binIndices));
+    for (unsigned i = 0; i < length(baiIndex._binIndices); ++i)
+    {
+        SEQAN_ASSERT_EQ(csiIndex._binIndices[i].size(), baiIndex._binIndices[i].size());
+        for (auto const & bin : csiIndex._binIndices[i])
+        {
+            auto it = baiIndex._binIndices[i].find(bin.first);
+            SEQAN_ASSERT(it != baiIndex._binIndices[i].end());
+            SEQAN_ASSERT(bin.second.chunkBegEnds == it->second.chunkBegEnds);
+
+            uint64_t bottom = _binningBinBottom(bin.first, 5);
+            if (bin.first < 37449 && bottom < length(baiIndex._linearIndices[i]))
+                SEQAN_ASSERT_EQ(bin.second.loff, baiIndex._linearIndices[i][bottom]);
+            else
+                SEQAN_ASSERT_EQ(bin.second.loff, 0u);
+        }
+    }
+
+    // Save and load.
+    CharString tmpOutPath = SEQAN_TEMP_FILENAME();
+    append(tmpOutPath, ".csi");
+    SEQAN_ASSERT(save(csiIndex, toCString(tmpOutPath)));
+
+    // The result does not depend on the number of threads.  The loff of a bin
+    // is the linear index entry of its first 16kbp window.
+    for (size_t threads = 2; threads <= 4; ++threads)
+    {
+        BamIndex<Csi> parIndex;
+        parIndex.depth = 5;
+        SEQAN_ASSERT(_csiBuild(parIndex, toCString(bamFilename), threads, 1));
+        SEQAN_ASSERT_EQ(getUnalignedCount(parIndex), getUnalignedCount(csiIndex));
+        SEQAN_ASSERT_EQ(length(parIndex._binIndices), length(csiIndex._binIndices));
+        for (unsigned i = 0; i < length(csiIndex._binIndices); ++i)
+        {
+            SEQAN_ASSERT_EQ(parIndex._binIndices[i].size(), csiIndex._binIndices[i].size());
+            for (auto const & bin : csiIndex._binIndices[i])
+            {
+                auto it = parIndex._binIndices[i].find(bin.first);
+                SEQAN_ASSERT(it != parIndex._binIndices[i].end());
+                SEQAN_ASSERT_EQ(it->second.loff, bin.second.loff);
+                SEQAN_ASSERT(it->second.chunkBegEnds == bin.second.chunkBegEnds);
+            }
+        }
+
+        CharString parOutPath = SEQAN_TEMP_FILENAME();
+        append(parOutPath, ".csi");
+        SEQAN_ASSERT(save(parIndex, toCString(parOutPath)));
+        SEQAN_ASSERT(_compareBinaryFiles(toCString(parOutPath), toCString(tmpOutPath)));
+    }
+
+    BamIndex<Csi> loadedIndex;
+    SEQAN_ASSERT(open(loadedIndex, toCString(tmpOutPath)));
+    SEQAN_ASSERT_EQ(loadedIndex.minShift, 14);
+    SEQAN_ASSERT_EQ(loadedIndex.depth, 5);
+    SEQAN_ASSERT_EQ(getUnalignedCount(loadedIndex), getUnalignedCount(csiIndex));
+    SEQAN_ASSERT_EQ(length(loadedIndex._binIndices), length(csiIndex._binIndices));
+    for (unsigned i = 0; i < length(csiIndex._binIndices); ++i)
+    {
+        SEQAN_ASSERT_EQ(loadedIndex._binIndices[i].size(), csiIndex._binIndices[i].size());
+        for (auto const & bin : csiIndex._binIndices[i])
+        {
+            auto it = loadedIndex._binIndices[i].find(bin.first);
+            SEQAN_ASSERT(it != loadedIndex._binIndices[i].end());
+            SEQAN_ASSERT_EQ(it->second.loff, bin.second.loff);
+            SEQAN_ASSERT(it->second.chunkBegEnds == bin.second.chunkBegEnds);
+        }
+    }
+
+    // Without a depth, the smallest one covering the references is chosen.
+    BamIndex<Csi> autoIndex;
+    SEQAN_ASSERT(build(autoIndex, toCString(bamFilename)));
+    SEQAN_ASSERT_EQ(autoIndex.depth, 0);
+}
+
+// Queries with CSI indices give the same results as with the BAI index.
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_csi_view_records)
+{
+    CharString bamFilename = getAbsolutePath("/tests/bam_io/ex1.bam");
+    CharString baiFilename = getAbsolutePath("/tests/bam_io/ex1.bam.bai");
+
+    BamFileIn bamFile;
+    SEQAN_ASSERT(open(bamFile, toCString(bamFilename)));
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT(open(baiIndex, toCString(baiFilename)));
+
+    BamIndex<Csi> csiIndices[3];
+    csiIndices[1].minShift = 8;
+    csiIndices[2].minShift = 8;
+    csiIndices[2].depth = 3;
+    for (BamIndex<Csi> & csiIndex : csiIndices)
+        SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+
+    unsigned const regions[][3] = {{0, 1, 1}, {0, 1, 10}, {0, 1, 100}, {0, 1, 1575}, {0, 100, 1575}, {0, 101, 1575},
+                                   {0, 102, 1575}, {1, 300, 400}, {1, 1, 1584}, {1, 98, 98}, {1, 99, 103}};
+    for (auto const & region : regions)
+    {
+        std::vector<BamAlignmentRecord> expected;
+        viewRecords(expected, bamFile, baiIndex, region[0], region[1], region[2]);
+
+        bool expectedHasAlignments = false;
+        BamAlignmentRecord expectedRecord;
+        SEQAN_ASSERT(jumpToRegion(bamFile, expectedHasAlignments, region[0], region[1], region[2], baiIndex));
+        if (expectedHasAlignments)
+            readRecord(expectedRecord, bamFile);
+
+        for (BamIndex<Csi> const & csiIndex : csiIndices)
+        {
+            std::vector<BamAlignmentRecord> records;
+            viewRecords(records, bamFile, csiIndex, region[0], region[1], region[2]);
+            SEQAN_ASSERT_EQ(records.size(), expected.size());
+            for (size_t i = 0; i < records.size(); ++i)
+            {
+                SEQAN_ASSERT_EQ(records[i].beginPos, expected[i].beginPos);
+                SEQAN_ASSERT_EQ(records[i].qName, expected[i].qName);
+            }
+
+            bool hasAlignments = false;
+            SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, region[0], region[1], region[2], csiIndex));
+            SEQAN_ASSERT_EQ(hasAlignments, expectedHasAlignments);
+            if (hasAlignments)
+            {
+                BamAlignmentRecord record;
+                readRecord(record, bamFile);
+                SEQAN_ASSERT_EQ(record.beginPos, expectedRecord.beginPos);
+                SEQAN_ASSERT_EQ(record.qName, expectedRecord.qName);
+            }
+        }
+    }
+}
+
+// CSI indices support references longer than 2^29 bases.
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_csi_large_reference)
+{
+    CharString bamFilename = SEQAN_TEMP_FILENAME();
+    append(bamFilename, ".bam");
+
+    int32_t const positions[] = {10, 600000000, 900000000, 900000050};
+    {
+        BamFileOut bamFile(toCString(bamFilename));
+        appendName(contigNamesCache(context(bamFile)), "chrBig");
+        appendValue(contigLengths(context(bamFile)), 1000000000);
+
+        BamHeader header;
+        resize(header, 1);
+        header[0].type = BAM_HEADER_FIRST;
+        appendValue(header[0].tags, Pair<CharString>("VN", "1.6"));
+        appendValue(header[0].tags, Pair<CharString>("SO", "coordinate"));
+        writeHeader(bamFile, header);
+
+        BamAlignmentRecord record;
+        record.rID = 0;
+        record.mapQ = 60;
+        appendValue(record.cigar, CigarElement<>('M', 100));
+        resize(record.seq, 100, 'A');
+        resize(record.qual, 100, 'I');
+        for (int32_t pos : positions)
+        {
+            record.beginPos = pos;
+            record.qName = "read";
+            appendNumber(record.qName, pos);
+            writeRecord(bamFile, record);
+        }
+    }
+
+    // The positions cannot be stored in a BAI index.
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT_NOT(build(baiIndex, toCString(bamFilename)));
+
+    BamIndex<Csi> csiIndex;
+    SEQAN_ASSERT(build(csiIndex, toCString(bamFilename)));
+    SEQAN_ASSERT_EQ(csiIndex.depth, 6);
+
+    BamFileIn bamFile(toCString(bamFilename));
+    BamHeader header;
+    readHeader(header, bamFile);
+
+    std::vector<BamAlignmentRecord> records;
+    viewRecords(records, bamFile, csiIndex, 0, 600000050, 600000050);
+    SEQAN_ASSERT_EQ(records.size(), 1u);
+    SEQAN_ASSERT_EQ(records[0].beginPos, 600000000);
+    records.clear();
+
+    viewRecords(records, bamFile, csiIndex, 0, 900000101, 999999999);
+    SEQAN_ASSERT_EQ(records.size(), 1u);
+    SEQAN_ASSERT_EQ(records[0].beginPos, 900000050);
+    records.clear();
+
+    viewRecords(records, bamFile, csiIndex, 0, 700000000, 800000000);
+    SEQAN_ASSERT(records.empty());
+
+    bool hasAlignments = false;
+    BamAlignmentRecord record;
+    SEQAN_ASSERT(jumpToRegion(bamFile, hasAlignments, 0, 800000000, 900000001, csiIndex));
+    SEQAN_ASSERT(hasAlignments);
+    readRecord(record, bamFile);
+    SEQAN_ASSERT_EQ(record.beginPos, 900000000);
+}
+
 #endif  // TESTS_BAM_IO_TEST_BAM_INDEX_H_
@@ -182,11 +182,14 @@ SEQAN_BEGIN_TESTSUITE(test_bam_io)
 
     // Test BAM indices.
     SEQAN_CALL_TEST(test_bam_io_bam_index_save);
-//  TODO(dadi): uncomment when BamIndex.build index is fixed
-//    SEQAN_CALL_TEST(test_bam_io_bam_index_build);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_build);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_build_parallel);
     SEQAN_CALL_TEST(test_bam_io_bam_index_open);
     SEQAN_CALL_TEST(test_bam_io_bam_index_jump_to_region);
     SEQAN_CALL_TEST(test_bam_io_bam_index_view_records);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_csi_build);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_csi_view_records);
+    SEQAN_CALL_TEST(test_bam_io_bam_index_csi_large_reference);
 #endif
 }
 SEQAN_END_TESTSUITE
@@ -42,6 +42,45 @@ using namespace seqan2;
 
 SEQAN_TYPED_TEST_CASE(IndexTest, FMIndexTypes);
 
+// --------------------------------------------------------------------------
+// Class IndexMMapTest
+// --------------------------------------------------------------------------
+// Saves an in-memory index and opens it with memory-mapped fibres.
+
+template <typename TIndex>
+struct MMapIndex_;
+
+template <typename TValue>
+struct MMapIndex_<Index<String<TValue>, FMIndex<> > >
+{
+    typedef Index<String<TValue, MMap<> >, FMIndex<void, MMapFMIndexConfig<> > >    Type;
+};
+
+template <typename TValue>
+struct MMapIndex_<Index<StringSet<String<TValue>, Owner<ConcatDirect<> > >, FMIndex<> > >
+{
+    typedef StringSet<String<TValue, MMap<> >, Owner<ConcatDirect<> > >             TText_;
+    typedef Index<TText_, FMIndex<void, MMapFMIndexConfig<> > >                     Type;
+};
+
+template <typename TValue>
+struct MMapIndex_<Index<String<TValue>, IndexEsa<> > >
+{
+    typedef Index<String<TValue, MMap<> >, IndexEsa<> >                             Type;
+};
+
+typedef
+    TagList<Index<DnaString, FMIndex<> >,
+    TagList<Index<StringSet<DnaString, Owner<ConcatDirect<> > >, FMIndex<> >,
+    TagList<Index<DnaString, IndexEsa<> >
+    > > >
+    MMapIndexTypes;
+
+template <typename TIndex>
+class IndexMMapTest : public IndexTest<TIndex> {};
+
+SEQAN_TYPED_TEST_CASE(IndexMMapTest, MMapIndexTypes);
+
 // ==========================================================================
 // Index Tests
 // ==========================================================================
@@ -111,6 +150,66 @@ SEQAN_TYPED_TEST(IndexTest, OpenSave)
     SEQAN_ASSERT_EQ(length(this->index), lengthSum(this->text));
 }
 
+// --------------------------------------------------------------------------
+// Test open() with memory-mapped fibres
+// --------------------------------------------------------------------------
+
+template <typename TIndex>
+inline void _requireAllFibres(TIndex & index)
+{
+    indexCreate(index);
+}
+
+template <typename TText>
+inline void _requireAllFibres(Index<TText, IndexEsa<> > & index)
+{
+    indexRequire(index, EsaSA());
+    indexRequire(index, EsaLcp());
+    indexRequire(index, EsaChildtab());
+    indexRequire(index, EsaBwt());
+}
+
+template <typename TIndex, typename TPattern, typename TOccurrences>
+inline void _getSortedOccurrences(TIndex & index, TPattern const & pattern, TOccurrences & occs)
+{
+    Finder<TIndex> finder(index);
+    clear(occs);
+    while (find(finder, pattern))
+        appendValue(occs, position(finder));
+    std::sort(begin(occs, Standard()), end(occs, Standard()));
+}
+
+SEQAN_TYPED_TEST(IndexMMapTest, OpenReadOnly)
+{
+    typedef typename TestFixture::TIndex                TIndex;
+    typedef typename MMapIndex_<TIndex>::Type           TMMapIndex;
+    typedef typename SAValue<TIndex>::Type              TSAValue;
+    typedef String<TSAValue>                            TOccurrences;
+
+    String<DnaString> patterns;
+    appendValue(patterns, "A");
+    appendValue(patterns, "CG");
+    appendValue(patterns, "TAC");
+
+    _requireAllFibres(this->index);
+    const char * fileName = SEQAN_TEMP_FILENAME();
+    SEQAN_ASSERT(save(this->index, fileName));
+
+    TMMapIndex mmapIndex;
+    SEQAN_ASSERT(open(mmapIndex, fileName, OPEN_RDONLY));
+    SEQAN_ASSERT_EQ(length(mmapIndex), lengthSum(this->text));
+
+    TOccurrences occs;
+    TOccurrences mmapOccs;
+    for (unsigned i = 0; i < length(patterns); ++i)
+    {
+        _getSortedOccurrences(this->index, patterns[i], occs);
+        _getSortedOccurrences(mmapIndex, patterns[i], mmapOccs);
+        SEQAN_ASSERT_GT(length(occs), 0u);
+        SEQAN_ASSERT(occs == mmapOccs);
+    }
+}
+
 // ==========================================================================
 // Functions
 // ==========================================================================
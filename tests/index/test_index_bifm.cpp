@@ -201,6 +201,64 @@ SEQAN_TYPED_TEST(BidirectionalFMIndexTest, SearchInStringSet)
 }
 #endif // __alpha__
 
+// goDown() computes the ranks of all characters at once, compare its children against goDown(c)
+template <typename TBiFMIter, typename TDirection>
+inline void
+testGoDownChildren(TBiFMIter const &, unsigned, TDirection const &, True const &)
+{
+    // NOTE: goDown() and goRight() cannot increment bool characters.
+}
+
+template <typename TBiFMIter, typename TDirection>
+inline void
+testGoDownChildren(TBiFMIter const & it, unsigned depth, TDirection const &, False const &)
+{
+    typedef typename Value<typename Container<TBiFMIter>::Type>::Type  TAlphabet;
+
+    TBiFMIter child(it);
+    if (depth == 0 || !goDown(child, TDirection()))
+        return;
+
+    do
+    {
+        TBiFMIter expected(it);
+        TAlphabet c = value(_iter(child, TDirection())).lastChar;
+        SEQAN_ASSERT(goDown(expected, c, TDirection()));
+        SEQAN_ASSERT(value(_iter(child, Fwd())).range == value(_iter(expected, Fwd())).range);
+        SEQAN_ASSERT(value(_iter(child, Rev())).range == value(_iter(expected, Rev())).range);
+        SEQAN_ASSERT_EQ(value(_iter(child, TDirection())).smaller, value(_iter(expected, TDirection())).smaller);
+
+        testGoDownChildren(child, depth - 1, TDirection(), False());
+    }
+    while (goRight(child, TDirection()));
+}
+
+SEQAN_TYPED_TEST(BidirectionalFMIndexTest, GoDownChildren)
+{
+    typedef typename TestFixture::TIndex                        TIndex;
+    typedef typename Host<TIndex>::Type                         TText;
+    typedef typename Spec<TIndex>::Type                         TIndexSpec;
+    typedef StringSet<TText, Owner<ConcatDirect<void> > >       TStringSet;
+    typedef Index<TStringSet, TIndexSpec>                       TStringSetIndex;
+    typedef typename Iterator<TStringSetIndex, TopDown<> >::Type TIter;
+    typedef typename IsSameType<typename Value<TText>::Type, bool>::Type TIsBool;
+
+    std::mt19937 rng(time(nullptr));
+
+    TStringSet stringSet;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        TText text;
+        generateText(rng, text, 397);
+        appendValue(stringSet, text);
+    }
+
+    TStringSetIndex index(stringSet);
+    TIter it(index);
+    testGoDownChildren(it, 3, Fwd(), TIsBool());
+    testGoDownChildren(it, 3, Rev(), TIsBool());
+}
+
 // ==========================================================================
 // Functions
 // ==========================================================================
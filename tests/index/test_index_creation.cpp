@@ -56,6 +56,11 @@ SEQAN_BEGIN_TESTSUITE(test_index)
     SEQAN_CALL_TEST(testIndexModifiedStringViewEsa);
     SEQAN_CALL_TEST(testIndexModifiedStringViewFM);
     SEQAN_CALL_TEST(testIssue519);
+    SEQAN_CALL_TEST(testIndexCreationParallelPrefixDoubling);
+    SEQAN_CALL_TEST(testIndexCreationParallelPrefixDoublingLargeGroups);
+    SEQAN_CALL_TEST(testIndexCreationKarkkainenPhi);
+    SEQAN_CALL_TEST(testIndexCreationSemiExternalPhi);
+    SEQAN_CALL_TEST(testIndexCreationSemiExternalBwt);
     SEQAN_CALL_TEST(testIndexCreation);
 }
 SEQAN_END_TESTSUITE
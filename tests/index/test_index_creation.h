@@ -126,6 +126,198 @@ SEQAN_DEFINE_TEST(testIssue519)
 //                  << suffix(getValue(strSet, getSeqNo(*iterSet)), getSeqOffset(*iterSet)) << std::endl;
 }
 
+SEQAN_DEFINE_TEST(testIndexCreationParallelPrefixDoubling)
+{
+    // Periodic texts need many doubling rounds.
+    DnaString text;
+    for (unsigned i = 0; i < 5000; ++i)
+        appendValue(text, Dna((i * i / 7) % 3));
+    for (unsigned i = 0; i < 2000; ++i)
+        appendValue(text, text[i % 13]);
+
+    String<unsigned> sa1, sa2;
+    resize(sa1, length(text));
+    resize(sa2, length(text));
+    createSuffixArray(sa1, text, Skew7());
+    createSuffixArray(sa2, text, ParallelPrefixDoubling());
+    SEQAN_ASSERT_EQ(sa1, sa2);
+
+    // Equal suffixes of different sequences must be ordered like Skew7 does.
+    StringSet<CharString> strSet;
+    appendValue(strSet, "bananamama");
+    appendValue(strSet, "");
+    appendValue(strSet, "mama");
+    appendValue(strSet, "bananajoe");
+    appendValue(strSet, "a");
+    appendValue(strSet, "joesmama");
+    Index<StringSet<CharString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<CharString>, IndexEsa<> > index2(strSet);
+
+    indexCreate(index1, EsaSA(), Skew7());
+    indexCreate(index2, EsaSA(), ParallelPrefixDoubling());
+    SEQAN_ASSERT_EQ(indexSA(index1), indexSA(index2));
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationParallelPrefixDoublingLargeGroups)
+{
+    // A long run and a long period leave groups larger than the text length per thread after the bucket sort,
+    // which are sorted by all threads together.
+    DnaString text;
+    for (unsigned i = 0; i < 100000; ++i)
+        appendValue(text, Dna(0));
+    for (unsigned i = 0; i < 100000; ++i)
+        appendValue(text, Dna((i % 7) % 4));
+    for (unsigned i = 0; i < 20000; ++i)
+        appendValue(text, Dna((i * i / 7) % 4));
+
+    int numThreads = omp_get_max_threads();
+    omp_set_num_threads(4);
+
+    String<unsigned> sa1, sa2;
+    resize(sa1, length(text));
+    resize(sa2, length(text));
+    createSuffixArray(sa1, text, Skew7());
+    createSuffixArray(sa2, text, ParallelPrefixDoubling());
+    SEQAN_ASSERT_EQ(sa1, sa2);
+
+    StringSet<DnaString> strSet;
+    appendValue(strSet, infix(text, 0, 150000));
+    appendValue(strSet, infix(text, 50000, 220000));
+    Index<StringSet<DnaString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<DnaString>, IndexEsa<> > index2(strSet);
+    indexCreate(index1, EsaSA(), Skew7());
+    indexCreate(index2, EsaSA(), ParallelPrefixDoubling());
+    SEQAN_ASSERT_EQ(indexSA(index1), indexSA(index2));
+
+    omp_set_num_threads(numThreads);
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationKarkkainenPhi)
+{
+    DnaString text;
+    for (unsigned i = 0; i < 5000; ++i)
+        appendValue(text, Dna((i * i / 7) % 3));
+    for (unsigned i = 0; i < 2000; ++i)
+        appendValue(text, text[i % 13]);
+
+    String<unsigned> sa, lcp1, lcp2;
+    resize(sa, length(text));
+    resize(lcp1, length(text));
+    resize(lcp2, length(text));
+    createSuffixArray(sa, text, Skew7());
+    createLcpTable(lcp1, text, sa, Kasai());
+
+    // A small workspace limit forces several blocks.
+    createLcpTable(lcp2, text, sa, KarkkainenPhi(1000));
+    SEQAN_ASSERT_EQ(lcp1, lcp2);
+
+    // External suffix arrays and LCP tables are scanned sequentially.
+    String<unsigned, External<> > saExt, lcpExt;
+    saExt = sa;
+    resize(lcpExt, length(text));
+    createLcpTable(lcpExt, text, saExt, KarkkainenPhi(4000));
+    SEQAN_ASSERT(lcp1 == lcpExt);
+
+    StringSet<CharString> strSet;
+    appendValue(strSet, "bananamama");
+    appendValue(strSet, "");
+    appendValue(strSet, "mama");
+    appendValue(strSet, "bananajoe");
+    appendValue(strSet, "a");
+    appendValue(strSet, "joesmama");
+    Index<StringSet<CharString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<CharString>, IndexEsa<> > index2(strSet);
+
+    indexRequire(index1, EsaSA());
+    indexSA(index2) = indexSA(index1);
+    indexCreate(index1, EsaLcp(), Kasai());
+    indexCreate(index2, EsaLcp(), KarkkainenPhi(24));
+    SEQAN_ASSERT_EQ(indexLcp(index1), indexLcp(index2));
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationSemiExternalPhi)
+{
+    DnaString text;
+    for (unsigned i = 0; i < 50000; ++i)
+        appendValue(text, Dna((i * i / 7) % 3));
+    for (unsigned i = 0; i < 20000; ++i)
+        appendValue(text, text[i % 13]);
+
+    String<unsigned> sa, lcp1, lcp2;
+    resize(sa, length(text));
+    resize(lcp1, length(text));
+    resize(lcp2, length(text));
+    createSuffixArray(sa, text, Skew7());
+    createLcpTable(lcp1, text, sa, Kasai());
+
+    // Pools that fit into the limit stay in memory.
+    createLcpTable(lcp2, text, sa, SemiExternalPhi());
+    SEQAN_ASSERT_EQ(lcp1, lcp2);
+
+    // A small limit moves both pools to disk, with several pages, and needs many batches.
+    String<unsigned, External<> > saExt, lcpExt;
+    saExt = sa;
+    resize(lcpExt, length(text));
+    createLcpTable(lcpExt, text, saExt, SemiExternalPhi(1));
+    SEQAN_ASSERT(lcp1 == lcpExt);
+
+    StringSet<CharString> strSet;
+    appendValue(strSet, "bananamama");
+    appendValue(strSet, "");
+    appendValue(strSet, "mama");
+    appendValue(strSet, "bananajoe");
+    appendValue(strSet, "a");
+    appendValue(strSet, "joesmama");
+    Index<StringSet<CharString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<CharString>, IndexEsa<> > index2(strSet);
+
+    indexRequire(index1, EsaSA());
+    indexSA(index2) = indexSA(index1);
+    indexCreate(index1, EsaLcp(), Kasai());
+    indexCreate(index2, EsaLcp(), SemiExternalPhi(1));
+    SEQAN_ASSERT_EQ(indexLcp(index1), indexLcp(index2));
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationSemiExternalBwt)
+{
+    CharString text;
+    for (unsigned i = 0; i < 5000; ++i)
+        appendValue(text, 'a' + (i * i / 7) % 5);
+
+    String<unsigned> sa;
+    resize(sa, length(text));
+    createSuffixArray(sa, text, Skew7());
+
+    CharString bwt1, bwt2;
+    resize(bwt1, length(text));
+    resize(bwt2, length(text));
+    createBWTable(bwt1, text, sa);
+    createBWTable(bwt2, text, sa, SemiExternalBwt());
+    SEQAN_ASSERT_EQ(bwt1, bwt2);
+
+    // A small limit needs many batches.
+    String<unsigned, External<> > saExt;
+    String<char, External<> > bwtExt;
+    saExt = sa;
+    resize(bwtExt, length(text));
+    createBWTable(bwtExt, text, saExt, SemiExternalBwt(1));
+    SEQAN_ASSERT(bwt1 == bwtExt);
+
+    StringSet<CharString> strSet;
+    appendValue(strSet, "bananamama");
+    appendValue(strSet, "mama");
+    appendValue(strSet, "bananajoe");
+    appendValue(strSet, "joesmama");
+    Index<StringSet<CharString>, IndexEsa<> > index1(strSet);
+    Index<StringSet<CharString>, IndexEsa<> > index2(strSet);
+
+    indexRequire(index1, EsaSA());
+    indexSA(index2) = indexSA(index1);
+    indexCreate(index1, EsaBwt(), Bwt());
+    indexCreate(index2, EsaBwt(), SemiExternalBwt(1));
+    SEQAN_ASSERT_EQ(indexBwt(index1), indexBwt(index2));
+}
+
 SEQAN_DEFINE_TEST(testIndexCreation)
 {
     typedef String<char>        TText;
@@ -181,6 +373,12 @@ SEQAN_DEFINE_TEST(testIndexCreation)
         std::cout << "suffix array creation (internal SAQSort) failed." << std::endl;
     }
 
+    blank(sa);
+    createSuffixArray(sa, text, ParallelPrefixDoubling());
+    if (!isSuffixArray(sa, text)) {
+        std::cout << "suffix array creation (internal ParallelPrefixDoubling) failed." << std::endl;
+    }
+
 //    blank(sa);
 //    createSuffixArray(sa, text, QSQGSR(), 3);
 //    if (!isSuffixArray(sa, text)) {
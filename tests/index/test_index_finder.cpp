@@ -33,6 +33,8 @@
 // ==========================================================================
 
 #include <vector>
+#include <tuple>
+#include <algorithm>
 #include <seqan/basic.h>
 #include <seqan/index.h>
 
@@ -98,6 +100,84 @@ SEQAN_TYPED_TEST(IndexFinderTest, StdVector)
     Iterator<TIndex, TopDown<> >::Type iter(index);
 }
 
+// --------------------------------------------------------------------------
+// Class IndexFindBatchTest
+// --------------------------------------------------------------------------
+
+template <typename TIndex_>
+class IndexFindBatchTest : public IndexTest<TIndex_>
+{
+public:
+    typedef TIndex_                                         TIndex;
+    typedef IndexTest<TIndex>                               TBase;
+    typedef typename Value<TIndex>::Type                    TValue;
+    typedef StringSet<String<TValue> >                      TNeedles;
+    typedef typename Iterator<TIndex, TopDown<> >::Type     TIndexIt;
+    typedef typename Size<TIndex>::Type                     TSize;
+    typedef std::tuple<unsigned, TSize, TSize>              THit;
+
+    TNeedles needles;
+
+    void setUp()
+    {
+        TBase::setUp();
+
+        // Substrings of the text and needles that do not occur in it.
+        String<TValue> concatText = concat(TBase::text);
+        for (unsigned i = 0; i + 12 < length(concatText); i += 7)
+            appendValue(needles, infix(concatText, i, i + 1 + i % 12));
+        appendValue(needles, String<TValue>());
+        String<TValue> missing;
+        resize(missing, 200, TValue(0));
+        appendValue(needles, missing);
+    }
+
+    template <typename TThreading>
+    void findBatch(std::vector<THit> & hits, TThreading)
+    {
+        find(TBase::index, needles, 0u,
+             [&](TIndexIt const & it, typename Iterator<TNeedles const, Rooted>::Type const & needlesIt, unsigned)
+             {
+                 SEQAN_OMP_PRAGMA(critical)
+                 hits.emplace_back(position(needlesIt), range(it).i1, range(it).i2);
+             },
+             Backtracking<Exact>(), TThreading());
+    }
+};
+
+SEQAN_TYPED_TEST_CASE(IndexFindBatchTest, UnidirectionalFMIndexTypes);
+
+// --------------------------------------------------------------------------
+// Test batched find
+// --------------------------------------------------------------------------
+
+SEQAN_TYPED_TEST(IndexFindBatchTest, SameAsGoDown)
+{
+    typedef typename TestFixture::TIndexIt  TIndexIt;
+    typedef typename TestFixture::THit      THit;
+
+    std::vector<THit> expected, serial, parallel;
+    for (unsigned i = 0; i < length(this->needles); ++i)
+    {
+        TIndexIt it(this->index);
+        if (!empty(this->needles[i]) && goDown(it, this->needles[i]))
+            expected.emplace_back(i, range(it).i1, range(it).i2);
+    }
+
+    this->findBatch(serial, Serial());
+    this->findBatch(parallel, Parallel());
+    std::sort(parallel.begin(), parallel.end());
+
+    // Empty needles match the root.
+    SEQAN_ASSERT_EQ(serial.size(), expected.size() + 1);
+    SEQAN_ASSERT_EQ(std::get<0>(serial.back()), length(this->needles) - 2);
+    serial.pop_back();
+    SEQAN_ASSERT(serial == expected);
+
+    parallel.pop_back();
+    SEQAN_ASSERT(parallel == expected);
+}
+
 // ==========================================================================
 // Functions
 // ==========================================================================
@@ -81,6 +81,7 @@ typedef FMIndex<void, WTFMIndexConfig<> >       WTFMIndex;
 typedef FMIndex<void, SmallWTFMIndexConfig<> >  SmallWTFMIndex;
 typedef FMIndex<void, SmallLVFMIndexConfig<> >  SmallLVFMIndex;
 typedef FMIndex<void, PrefixLVFMIndexConfig<> > PrefixLVFMIndex;
+typedef FMIndex<void, InterleavedFMIndexConfig<> > InterleavedFMIndex;
 
 // --------------------------------------------------------------------------
 // FMIndex Types
@@ -95,8 +96,10 @@ typedef
     TagList<Index<String<bool>, PrefixLVFMIndex>,
     TagList<Index<DnaString, PrefixLVFMIndex>,
     TagList<Index<CharString, PrefixLVFMIndex>,
-    TagList<Index<StringSet<DnaString>, PrefixLVFMIndex>
-    > > > > > > > > >
+    TagList<Index<StringSet<DnaString>, PrefixLVFMIndex>,
+    TagList<Index<DnaString, InterleavedFMIndex>,
+    TagList<Index<StringSet<DnaString>, InterleavedFMIndex>
+    > > > > > > > > > > >
     FMIndexTypes2;
 
 // ==========================================================================
@@ -206,6 +209,34 @@ SEQAN_TYPED_TEST(CSATest, BeginEnd)
     SEQAN_ASSERT_EQ(position(itEnd), static_cast<TPos>(length(this->fibre)));
 }
 
+// --------------------------------------------------------------------------
+// Test the temporary suffix array
+// --------------------------------------------------------------------------
+
+SEQAN_TYPED_TEST(CSATest, TempSA)
+{
+    typedef typename TestFixture::TIndex                            TIndex;
+    typedef typename Fibre<TIndex, FibreTempSA>::Type               TTempSA;
+    typedef typename Size<typename TestFixture::TFibre>::Type       TSize;
+
+    // By default the temporary suffix array is stored on disk.
+    static_assert(!IsSameType<typename Spec<TTempSA>::Type, Alloc<> >::VALUE, "Expected an external SA.");
+
+    // The compressed suffix array starts with one entry per sentinel.
+    String<typename SAValue<TIndex>::Type> sa;
+    resize(sa, lengthSum(this->text));
+    createSuffixArray(sa, this->text, Skew7());
+    for (unsigned i = 0; i < length(sa); ++i)
+        SEQAN_ASSERT_EQ(this->fibre[i + countSequences(this->text)], sa[i]);
+
+    // Building it in memory by prefix doubling yields the same index.
+    TIndex index(this->text);
+    SEQAN_ASSERT(indexCreate(index, FibreSALF(), ParallelPrefixDoubling()));
+    SEQAN_ASSERT_EQ(length(indexSA(index)), length(this->fibre));
+    for (TSize i = 0; i < length(this->fibre); ++i)
+        SEQAN_ASSERT_EQ(indexSA(index)[i], this->fibre[i]);
+}
+
 // ==========================================================================
 // Functions
 // ==========================================================================
@@ -75,6 +75,9 @@ typedef Levels<void, LevelsRDConfig<uint32_t, Alloc<>, 1, 1> >       Default1Lev
 typedef Levels<void, LevelsRDConfig<uint32_t, Alloc<>, 2, 2> >       Default2Level;
 typedef Levels<void, LevelsRDConfig<uint32_t, Alloc<>, 3, 3> >       Default3Level;
 
+typedef Levels<void, InterleavedRDConfig<uint64_t, Alloc<>, 2> >     Interleaved2Level;
+typedef Levels<void, InterleavedRDConfig<uint64_t, Alloc<>, 3> >     Interleaved3Level;
+
 typedef
     TagList<RankDictionary<bool,            Prefix1Level>,
     TagList<RankDictionary<Dna,             Prefix1Level>,
@@ -125,13 +128,27 @@ typedef
 #ifndef __alpha__ // NOTE(h-2): fails on alpha for unknown reasons
     TagList<RankDictionary<AminoAcid,       Default3Level>,
 #endif
+    TagList<RankDictionary<bool,            Interleaved2Level>,
+    TagList<RankDictionary<Dna,             Interleaved2Level>,
+    TagList<RankDictionary<Dna5,            Interleaved2Level>,
+    TagList<RankDictionary<Dna5Q,           Interleaved2Level>,
+    TagList<RankDictionary<ReducedMurphy10, Interleaved2Level>,
+    TagList<RankDictionary<AminoAcid,       Interleaved3Level>,
     RankDictionaryPrefixSumTypes
-    > > > > > > > > > > > > > > > > > >
+    > > > > > > > > > > > > > > > > > > > > > > > >
 #ifndef __alpha__
     >
 #endif
     RankDictionaryAllTypes;
 
+typedef
+    TagList<RankDictionary<bool,            Interleaved2Level>,
+    TagList<RankDictionary<Dna,             Interleaved2Level>,
+    TagList<RankDictionary<Dna5,            Interleaved2Level>,
+    TagList<RankDictionary<AminoAcid,       Interleaved3Level>
+    > > > >
+    RankDictionaryInterleavedTypes;
+
 // ==========================================================================
 // Test Classes
 // ==========================================================================
@@ -173,6 +190,11 @@ class RankDictionaryPrefixTest : public RankDictionaryTest<TRankDictionary> {};
 SEQAN_TYPED_TEST_CASE(RankDictionaryTest, RankDictionaryAllTypes);
 SEQAN_TYPED_TEST_CASE(RankDictionaryPrefixTest, RankDictionaryPrefixSumTypes);
 
+template <typename TRankDictionary>
+class RankDictionaryInterleavedTest : public RankDictionaryTest<TRankDictionary> {};
+
+SEQAN_TYPED_TEST_CASE(RankDictionaryInterleavedTest, RankDictionaryInterleavedTypes);
+
 // ==========================================================================
 // Tests
 // ==========================================================================
@@ -255,6 +277,35 @@ SEQAN_TYPED_TEST(RankDictionaryTest, GetRank)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Test getRanks()
+// ----------------------------------------------------------------------------
+
+SEQAN_TYPED_TEST(RankDictionaryTest, GetRanks)
+{
+    typedef typename TestFixture::TValueSize            TValueSize;
+    typedef typename TestFixture::TText                 TText;
+    typedef typename TestFixture::TTextIterator         TTextIterator;
+    typedef typename Size<TText>::Type                  TTextSize;
+    typedef String<TTextSize>                           TPrefixSum;
+
+    typename TestFixture::TRankDict dict(this->text);
+
+    TPrefixSum prefixSum;
+    TPrefixSum ranks;
+    resize(prefixSum, this->alphabetSize, 0);
+    resize(ranks, this->alphabetSize, 0);
+
+    for (TTextIterator textIt = this->textBegin; textIt != this->textEnd; ++textIt)
+    {
+        prefixSum[ordValue(value(textIt))]++;
+
+        getRanks(dict, (unsigned long)(textIt - this->textBegin), ranks);
+        for (TValueSize c = 0; c < this->alphabetSize; ++c)
+            SEQAN_ASSERT_EQ(ranks[c], prefixSum[c]);
+    }
+}
+
 SEQAN_TYPED_TEST(RankDictionaryPrefixTest, GetPrefixRank)
 {
     typedef typename TestFixture::TValueSize TValueSize;
@@ -287,6 +338,26 @@ SEQAN_TYPED_TEST(RankDictionaryPrefixTest, GetPrefixRank)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Test interleaved block layout
+// ----------------------------------------------------------------------------
+
+SEQAN_TYPED_TEST(RankDictionaryInterleavedTest, CacheLineLayout)
+{
+    typedef typename TestFixture::TRankDict                         TRankDict;
+    typedef typename Fibre<TRankDict, FibreRanks>::Type             TRanks;
+    typedef typename Value<TRanks>::Type                            TEntry;
+
+    SEQAN_ASSERT_EQ(sizeof(TEntry), 64u);
+    SEQAN_ASSERT_EQ(alignof(TEntry), 64u);
+
+    TRankDict dict(this->text);
+    TRanks const & ranks = getFibre(dict, FibreRanks());
+    SEQAN_ASSERT_GT(length(ranks), 1u);
+    SEQAN_ASSERT_EQ(reinterpret_cast<uintptr_t>(&ranks[0]) % 64, 0u);
+    SEQAN_ASSERT_EQ(reinterpret_cast<uintptr_t>(&ranks[1]) % 64, 0u);
+}
+
 // ----------------------------------------------------------------------------
 // Test setValue()
 // ----------------------------------------------------------------------------
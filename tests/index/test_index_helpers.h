@@ -196,6 +196,14 @@ void createText(StringSet<TValue> & text, TValue)
     generateText(text, 10u, 100u);
 }
 
+template <typename TString, typename TSpec, typename TValue>
+void createText(StringSet<TString, Owner<ConcatDirect<TSpec> > > & text, TValue)
+{
+    StringSet<TString> owner;
+    createText(owner, TString());
+    text = owner;
+}
+
 // --------------------------------------------------------------------------
 // Function createText(bool)
 // --------------------------------------------------------------------------
@@ -48,6 +48,7 @@
 #include "test_parallel_algorithms.h"
 #include "test_parallel_queue.h"
 #include "test_parallel_thread_pool.h"
+#include "test_parallel_work_stealing_scheduler.h"
 #include "test_parallel_enumerable_thread_local.h"
 
 SEQAN_BEGIN_TESTSUITE(test_parallel) {
@@ -108,6 +109,17 @@ SEQAN_BEGIN_TESTSUITE(test_parallel) {
     SEQAN_CALL_TEST(test_parallel_thread_pool_join);
     SEQAN_CALL_TEST(test_parallel_thread_pool_destruct);
 
+    // -----------------------------------------------------------------------
+    // Test work-stealing scheduler.
+    // -----------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_parallel_work_stealing_scheduler_construct);
+    SEQAN_CALL_TEST(test_parallel_work_stealing_scheduler_spawn_wait);
+    SEQAN_CALL_TEST(test_parallel_work_stealing_scheduler_nested);
+    SEQAN_CALL_TEST(test_parallel_work_stealing_scheduler_exception);
+    SEQAN_CALL_TEST(test_parallel_work_stealing_scheduler_no_threads);
+    SEQAN_CALL_TEST(test_parallel_work_stealing_scheduler_destruct);
+
     // -----------------------------------------------------------------------
     // Test Enumerable Thread Specific.
     // -----------------------------------------------------------------------
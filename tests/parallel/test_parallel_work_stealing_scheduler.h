@@ -0,0 +1,164 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2026, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the work-stealing task scheduler.
+// ==========================================================================
+
+#include <seqan/parallel.h>
+
+SEQAN_DEFINE_TEST(test_parallel_work_stealing_scheduler_construct)
+{
+    using namespace seqan2;
+
+    SEQAN_ASSERT(std::is_default_constructible<WorkStealingScheduler>::value);
+    SEQAN_ASSERT(!std::is_copy_constructible<WorkStealingScheduler>::value);
+    SEQAN_ASSERT(!std::is_move_constructible<WorkStealingScheduler>::value);
+    SEQAN_ASSERT(!std::is_copy_constructible<TaskGroup>::value);
+    SEQAN_ASSERT(!std::is_move_constructible<TaskGroup>::value);
+
+    WorkStealingScheduler scheduler(3);
+    SEQAN_ASSERT_EQ(numThreads(scheduler), 3u);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_work_stealing_scheduler_spawn_wait)
+{
+    using namespace seqan2;
+
+    WorkStealingScheduler scheduler(4);
+    TaskGroup group;
+    std::vector<int> res(1000, 0);
+    for (size_t i = 0; i < length(res); ++i)
+        spawn(scheduler, group, [&res, i] () { res[i] = static_cast<int>(i); });
+    wait(scheduler, group);
+
+    for (size_t i = 0; i < length(res); ++i)
+        SEQAN_ASSERT_EQ(res[i], static_cast<int>(i));
+
+    // The group can be reused after waiting.
+    std::atomic<unsigned> counter{0};
+    for (unsigned i = 0; i < 100; ++i)
+        spawn(scheduler, group, [&counter] () { ++counter; });
+    wait(scheduler, group);
+    SEQAN_ASSERT_EQ(counter.load(), 100u);
+}
+
+inline uint64_t
+_testWorkStealingFib(seqan2::WorkStealingScheduler & scheduler, unsigned n)
+{
+    if (n < 2)
+        return n;
+
+    seqan2::TaskGroup group;
+    uint64_t x = 0;
+    spawn(scheduler, group, [&] () { x = _testWorkStealingFib(scheduler, n - 1); });
+    uint64_t y = _testWorkStealingFib(scheduler, n - 2);
+    wait(scheduler, group);
+    return x + y;
+}
+
+SEQAN_DEFINE_TEST(test_parallel_work_stealing_scheduler_nested)
+{
+    using namespace seqan2;
+
+    WorkStealingScheduler scheduler(4);
+    TaskGroup group;
+    uint64_t res = 0;
+    spawn(scheduler, group, [&] () { res = _testWorkStealingFib(scheduler, 20); });
+    wait(scheduler, group);
+    SEQAN_ASSERT_EQ(res, 6765u);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_work_stealing_scheduler_exception)
+{
+    using namespace seqan2;
+
+    WorkStealingScheduler scheduler(2);
+    TaskGroup group;
+    std::atomic<unsigned> counter{0};
+    for (unsigned i = 0; i < 50; ++i)
+    {
+        spawn(scheduler, group, [&counter, i] ()
+        {
+            ++counter;
+            if (i == 10)
+                throw std::runtime_error("task failed");
+        });
+    }
+
+    bool caught = false;
+    try
+    {
+        wait(scheduler, group);
+    }
+    catch (std::runtime_error const & e)
+    {
+        caught = true;
+        SEQAN_ASSERT_EQ(std::string(e.what()), std::string("task failed"));
+    }
+    SEQAN_ASSERT(caught);
+    SEQAN_ASSERT_EQ(counter.load(), 50u);  // All other tasks were still executed.
+}
+
+SEQAN_DEFINE_TEST(test_parallel_work_stealing_scheduler_no_threads)
+{
+    using namespace seqan2;
+
+    WorkStealingScheduler scheduler(0);
+    SEQAN_ASSERT_EQ(numThreads(scheduler), 0u);
+
+    TaskGroup group;
+    auto masterId = std::this_thread::get_id();
+    bool sameThread = true;
+    uint64_t res = 0;
+    spawn(scheduler, group, [&] ()
+    {
+        sameThread = std::this_thread::get_id() == masterId;
+        res = _testWorkStealingFib(scheduler, 15);
+    });
+    wait(scheduler, group);
+    SEQAN_ASSERT(sameThread);
+    SEQAN_ASSERT_EQ(res, 610u);
+}
+
+SEQAN_DEFINE_TEST(test_parallel_work_stealing_scheduler_destruct)
+{
+    using namespace seqan2;
+
+    // Pending tasks are executed before the scheduler is destroyed.
+    std::atomic<unsigned> counter{0};
+    TaskGroup group;
+    {
+        WorkStealingScheduler scheduler(2);
+        for (unsigned i = 0; i < 500; ++i)
+            spawn(scheduler, group, [&counter] () { ++counter; });
+    }
+    SEQAN_ASSERT_EQ(counter.load(), 500u);
+}
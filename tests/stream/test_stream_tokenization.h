@@ -360,4 +360,85 @@ SEQAN_TYPED_TEST(TokenizationTest, SkipLine)
     SEQAN_ASSERT(atEnd(ctx.iter));
 }
 
+// long lines that are read and converted in bulk
+SEQAN_TYPED_TEST(TokenizationTest, ReadUntilBulk)
+{
+    typedef OrFunctor<IsWhitespace, AssertFunctor<IsInAlphabet<Dna5>, ParseError> > TIgnoreOrAssert;
+
+    std::string text = ">seq\n";
+    Dna5String expectedSeq;
+    char const * nucleotides = "ACGTNacgtn";
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        text += nucleotides[(i * 7) % 10];
+        appendValue(expectedSeq, nucleotides[(i * 7) % 10]);
+        if (i % 70 == 69)
+            text += (i % 140 == 139) ? "\r\n" : "\n";
+    }
+    text += "\n>qual\n";
+    CharString expectedQual;
+    for (unsigned i = 0; i < 250; ++i)
+    {
+        text += static_cast<char>('!' + (i * 13) % 94);
+        appendValue(expectedQual, static_cast<char>('!' + (i * 13) % 94));
+        if (i % 100 == 99)
+            text += '\n';
+    }
+    text += "\n@tail ACGTACGTACGTACGTACGTACGTACGTACGTACGTACGTX";
+
+    TokenizationContext<typename TestFixture::TStream> ctx(text.c_str());
+
+    CharString meta;
+    skipOne(ctx.iter, EqualsChar<'>'>());
+    readLine(meta, ctx.iter);
+    SEQAN_ASSERT_EQ(meta, "seq");
+
+    Dna5String seq;
+    readUntil(seq, ctx.iter, EqualsChar<'>'>(), TIgnoreOrAssert());
+    SEQAN_ASSERT_EQ(seq, expectedSeq);
+    SEQAN_ASSERT_EQ(*ctx.iter, '>');
+    skipLine(ctx.iter);
+
+    // read as many qualities as there are and skip the newlines in between
+    CharString qual;
+    CountDownFunctor<NotFunctor<IsNewline> > countDown(length(expectedQual));
+    readUntil(qual, ctx.iter, countDown, IsNewline());
+    SEQAN_ASSERT_EQ(qual, expectedQual);
+    SEQAN_ASSERT_EQ(*ctx.iter, '\n');
+
+    skipUntil(ctx.iter, EqualsChar<'A'>());
+    clear(seq);
+    SEQAN_TRY
+    {
+        readUntil(seq, ctx.iter, EqualsChar<'>'>(), TIgnoreOrAssert());
+        SEQAN_ASSERT_FAIL("ParseError expected.");
+    }
+    SEQAN_CATCH(ParseError const & e)
+    {
+        SEQAN_ASSERT_EQ(std::string(e.what()).substr(0, 27), "Unexpected character 'X' fo");
+    }
+}
+
+// skip a number of counted characters
+SEQAN_TYPED_TEST(TokenizationTest, SkipUntilCountDown)
+{
+    std::string text;
+    for (unsigned i = 0; i < 300; ++i)
+    {
+        text += static_cast<char>('!' + (i * 13) % 94);
+        if (i % 60 == 59)
+            text += '\n';
+    }
+    text += "@";
+
+    TokenizationContext<typename TestFixture::TStream> ctx(text.c_str());
+
+    CountDownFunctor<NotFunctor<IsNewline> > countDown(299);
+    skipUntil(ctx.iter, countDown);
+    SEQAN_ASSERT_EQ(*ctx.iter, static_cast<char>('!' + (299 * 13) % 94));
+    skipOne(ctx.iter);
+    skipUntil(ctx.iter, NotFunctor<IsWhitespace>());
+    SEQAN_ASSERT_EQ(*ctx.iter, '@');
+}
+
 #endif // ifndef TEST_STREAM_TEST_STREAM_TOKENIZATION_H_
@@ -42,6 +42,8 @@
 #include <seqan/stream.h>
 
 #include <sstream>
+#include <future>
+#include <random>
 
 using namespace seqan2;
 
@@ -174,4 +176,390 @@ SEQAN_TYPED_TEST(VStreamTest, AutoDetection)
     SEQAN_ASSERT_NOT((bool)vstream);
 }
 
+#if SEQAN_HAS_ZLIB
+SEQAN_TEST(BgzfStreamTest, SharedScheduler)
+{
+    CharString buffer;
+    for (unsigned i = 0; i != 10000; ++i)
+    {
+        appendNumber(buffer, i);
+        append(buffer, FASTQ_EXAMPLE);
+    }
+
+    // Two streams compress their blocks with the same worker threads, a third one without any.
+    WorkStealingScheduler scheduler(2);
+    WorkStealingScheduler noThreads(0);
+    std::vector<CharString> fileNames;
+    {
+        std::vector<std::unique_ptr<std::fstream> > files;
+        std::vector<std::unique_ptr<basic_bgzf_streambuf<char> > > streamBufs;
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            fileNames.push_back(SEQAN_TEMP_FILENAME());
+            append(fileNames.back(), ".gz");
+            files.emplace_back(new std::fstream(toCString(fileNames.back()), std::ios::out | std::ios::binary));
+            streamBufs.emplace_back(new basic_bgzf_streambuf<char>(*files.back(), (i < 2) ? scheduler : noThreads));
+        }
+
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            std::ostream ostream(streamBufs[i].get());
+            ostream << buffer;
+            SEQAN_ASSERT(ostream.good());
+            streamBufs[i]->addFooter();
+        }
+    }
+
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        VirtualStream<char, Input> vistream(toCString(fileNames[i]), OPEN_RDONLY);
+        SEQAN_ASSERT((bool)vistream);
+        std::stringstream sstr;
+        sstr << vistream.streamBuf;
+        SEQAN_ASSERT_EQ(CharString(sstr.str()), buffer);
+        close(vistream);
+    }
+}
+
+SEQAN_TEST(BgzfStreamTest, WriteFromWorker)
+{
+    CharString buffer;
+    for (unsigned i = 0; i != 10000; ++i)
+    {
+        appendNumber(buffer, i);
+        append(buffer, FASTQ_EXAMPLE);
+    }
+
+    // The only worker of the scheduler writes the stream itself, so it has to compress the
+    // blocks it spawned instead of waiting for an idle job.  The main thread does not help.
+    WorkStealingScheduler scheduler(1);
+    TaskGroup group;
+    std::stringstream compressed;
+    std::promise<void> done;
+    spawn(scheduler, group, [&] ()
+    {
+        {
+            basic_bgzf_streambuf<char> streamBuf(compressed, scheduler, 1);
+            std::ostream ostream(&streamBuf);
+            ostream << buffer;
+            SEQAN_ASSERT(ostream.good());
+            streamBuf.addFooter();
+        }
+        done.set_value();
+    });
+    done.get_future().wait();
+    wait(scheduler, group);
+
+    basic_unbgzf_streambuf<char> unbgzfBuf(compressed, 1);
+    std::stringstream sstr;
+    sstr << &unbgzfBuf;
+    SEQAN_ASSERT_EQ(CharString(sstr.str()), buffer);
+}
+
+SEQAN_TEST(BgzfStreamTest, RoundTrip)
+{
+    // Compressible text and incompressible bytes, the latter need stored DEFLATE blocks that must still fit into one
+    // BGZF block.  The blocks are compared after decompression only, as zlib and libdeflate compress differently.
+    CharString text;
+    for (unsigned i = 0; i != 10000; ++i)
+    {
+        appendNumber(text, i);
+        append(text, FASTQ_EXAMPLE);
+    }
+    CharString noise;
+    uint32_t state = 12345u;
+    for (unsigned i = 0; i != 300000; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        appendValue(noise, static_cast<char>(state >> 24));
+    }
+
+    for (CharString const & buffer : {text, noise, CharString()})
+    {
+        std::stringstream compressed;
+        {
+            basic_bgzf_streambuf<char> streamBuf(compressed, 2);
+            std::ostream ostream(&streamBuf);
+            ostream << buffer;
+            SEQAN_ASSERT(ostream.good());
+            streamBuf.addFooter();
+        }
+
+        // Every BGZF file ends with the empty end-of-file block.
+        std::string const data = compressed.str();
+        SEQAN_ASSERT_GEQ(data.size(), BGZF_END_OF_FILE_MARKER.size());
+        SEQAN_ASSERT(std::equal(BGZF_END_OF_FILE_MARKER.begin(), BGZF_END_OF_FILE_MARKER.end(),
+                                reinterpret_cast<uint8_t const *>(data.data()) + data.size() -
+                                BGZF_END_OF_FILE_MARKER.size()));
+
+        basic_unbgzf_streambuf<char> unbgzfBuf(compressed, 2);
+        std::stringstream sstr;
+        sstr << &unbgzfBuf;
+        SEQAN_ASSERT_EQ(CharString(sstr.str()), buffer);
+    }
+
+#if SEQAN_HAS_LIBDEFLATE
+    // Single blocks go through libdeflate, for writing only with SEQAN_BGZF_LIBDEFLATE_COMPRESSION.
+    for (CharString const & buffer : {text, noise})
+    {
+        size_t const blockLength = std::min<size_t>(length(buffer), DefaultPageSize<BgzfFile>::VALUE);
+        std::vector<char> block(DefaultPageSize<BgzfFile>::MAX_BLOCK_SIZE);
+        std::vector<char> decompressed(DefaultPageSize<BgzfFile>::MAX_BLOCK_SIZE);
+
+        CompressionContext<BgzfFile> ctx;
+        size_t const compressedLength = _compressBlock(&block[0], block.size(), &buffer[0], blockLength, ctx);
+        SEQAN_ASSERT_LEQ(compressedLength, block.size());
+#ifdef SEQAN_BGZF_LIBDEFLATE_COMPRESSION
+        SEQAN_ASSERT(ctx.compressor != nullptr);
+#endif  // #ifdef SEQAN_BGZF_LIBDEFLATE_COMPRESSION
+
+        SEQAN_ASSERT_EQ(_decompressBlock(&decompressed[0], decompressed.size(), &block[0], compressedLength, ctx),
+                        blockLength);
+        SEQAN_ASSERT(ctx.decompressor != nullptr);
+        SEQAN_ASSERT(std::equal(decompressed.begin(), decompressed.begin() + blockLength, begin(buffer, Standard())));
+    }
+#endif  // #if SEQAN_HAS_LIBDEFLATE
+}
+
+SEQAN_TEST(GZStreamTest, Pipelined)
+{
+    CharString buffer;
+    for (unsigned i = 0; i != 10000; ++i)
+    {
+        appendNumber(buffer, i);
+        append(buffer, FASTQ_EXAMPLE);
+    }
+
+    // Two concatenated gzip members.
+    std::stringstream compressed;
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        zlib_stream::zip_ostream zostream(compressed);
+        zostream.write(toCString(buffer), length(buffer));
+    }
+
+    // Small buffers such that the thread has to wait for the reader many times.
+    {
+        std::stringstream input(compressed.str());
+        zlib_stream::zip_pipelined_istream zistream(input, 31, 1000, 1000, 3);
+        std::stringstream sstr;
+        sstr << zistream.rdbuf();
+        CharString expected = buffer;
+        append(expected, buffer);
+        SEQAN_ASSERT_EQ(CharString(sstr.str()), expected);
+    }
+
+    // Characters can be put back across the buffer boundaries.
+    {
+        std::stringstream input(compressed.str());
+        zlib_stream::zip_pipelined_istream zistream(input, 31, 10, 1000, 2);
+        for (unsigned i = 0; i < 100; ++i)
+        {
+            char c = 0;
+            SEQAN_ASSERT(zistream.get(c).good());
+            SEQAN_ASSERT_EQ(c, buffer[i]);
+            SEQAN_ASSERT(zistream.unget().good());
+            SEQAN_ASSERT(zistream.get(c).good());
+            SEQAN_ASSERT_EQ(c, buffer[i]);
+        }
+    }
+
+    // The stream can be destroyed before everything was read.
+    {
+        std::stringstream input(compressed.str());
+        zlib_stream::zip_pipelined_istream zistream(input, 31, 1000, 1000, 2);
+        char c = 0;
+        SEQAN_ASSERT(zistream.get(c).good());
+        SEQAN_ASSERT_EQ(c, buffer[0]);
+    }
+}
+#endif  // #if SEQAN_HAS_ZLIB
+
+#if SEQAN_HAS_BZIP2
+SEQAN_TEST(BZ2StreamTest, Parallel)
+{
+    CharString buffer;
+    for (unsigned i = 0; i != 10000; ++i)
+    {
+        appendNumber(buffer, i);
+        append(buffer, FASTQ_EXAMPLE);
+    }
+
+    // Two concatenated bzip2 streams with 100k blocks.
+    std::stringstream compressed;
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        bzip2_stream::bzip2_ostream zostream(compressed, 1);
+        zostream.write(toCString(buffer), length(buffer));
+    }
+    CharString expected = buffer;
+    append(expected, buffer);
+
+    {
+        std::stringstream input(compressed.str());
+        bzip2_parallel_istream zistream(input, 3, 1);
+        std::stringstream sstr;
+        sstr << zistream.rdbuf();
+        SEQAN_ASSERT_EQ(CharString(sstr.str()), expected);
+    }
+
+    // Characters can be put back across the block boundaries.
+    {
+        std::stringstream input(compressed.str());
+        bzip2_parallel_istream zistream(input, 2, 2);
+        for (unsigned i = 0; i + 997 <= length(expected); i += 997)
+        {
+            SEQAN_ASSERT(zistream.ignore(996).good());
+            char c = 0;
+            SEQAN_ASSERT(zistream.get(c).good());
+            SEQAN_ASSERT_EQ(c, expected[i + 996]);
+            SEQAN_ASSERT(zistream.unget().good());
+            SEQAN_ASSERT(zistream.get(c).good());
+            SEQAN_ASSERT_EQ(c, expected[i + 996]);
+        }
+    }
+
+    // A corrupted block is detected.
+    {
+        std::string corrupted = compressed.str();
+        corrupted[corrupted.size() / 4] ^= 0x10;
+        std::stringstream input(corrupted);
+        bzip2_parallel_istream zistream(input, 2, 2);
+        bool failed = false;
+        try
+        {
+            while (zistream.rdbuf()->sbumpc() != EOF) {}
+        }
+        catch (IOError const &)
+        {
+            failed = true;
+        }
+        SEQAN_ASSERT(failed);
+    }
+}
+
+// The CRC bzip2 computes over the uncompressed data, without the final complement.
+inline uint32_t
+testBzip2Crc(uint32_t crc, char const * begin, char const * end)
+{
+    for (; begin != end; ++begin)
+    {
+        crc ^= static_cast<uint32_t>(static_cast<unsigned char>(*begin)) << 24;
+        for (unsigned k = 0; k < 8; ++k)
+            crc = (crc & 0x80000000u) ? (crc << 1) ^ 0x04c11db7u : crc << 1;
+    }
+    return crc;
+}
+
+SEQAN_TEST(BZ2StreamTest, FalseMagic)
+{
+    // Craft a block whose header contains a block magic number beginning at bit 22 of the block CRC,
+    // such that the reader cuts the block into two pieces and has to merge them again. The magic
+    // number is followed by the last 10 bits of the CRC, the randomised bit, the 24 bit origPtr and
+    // the bitmap of the used 16 byte ranges. origPtr is the rank of the first rotation of the data,
+    // which is the number of bytes smaller than the first byte.
+    std::string small, large;
+    for (unsigned c = 0x00; c < 0x10; ++c)          // ranges 0, 3, 4 and 6
+        small += static_cast<char>(c);
+    for (unsigned c = 0x30; c < 0x50; ++c)
+        small += static_cast<char>(c);
+    for (unsigned c = 0x60; c < 0x70; ++c)
+        small += static_cast<char>(c);
+    for (unsigned c = 0x81; c < 0xa0; ++c)          // ranges 8, 9 and 12
+        large += static_cast<char>(c);
+    for (unsigned c = 0xc0; c < 0xd0; ++c)
+        large += static_cast<char>(c);
+
+    // no runs of equal bytes, such that the block is not shortened by the initial run-length encoding
+    unsigned const origPtr = 0x0ac932;
+    unsigned const length = 800000;
+    std::mt19937 rng(0);
+    std::string data(1, static_cast<char>(0x80));
+    for (unsigned i = 1; i < length; ++i)
+    {
+        std::string const & alphabet = (i <= origPtr) ? small : large;
+        char c;
+        do
+            c = alphabet[rng() % alphabet.size()];
+        while (c == data[i - 1]);
+        data += c;
+    }
+
+    // vary the last bytes until the CRC ends with the 10 bits of the magic number
+    uint32_t prefixCrc = testBzip2Crc(0xffffffffu, &data[0], &data[0] + length - 3);
+    while ((~testBzip2Crc(prefixCrc, &data[0] + length - 3, &data[0] + length) & 0x3ff) != 0xc5)
+    {
+        for (unsigned i = length - 3; i < length; ++i)
+        {
+            do
+                data[i] = large[rng() % large.size()];
+            while (data[i] == data[i - 1]);
+        }
+    }
+
+    std::stringstream compressed;
+    {
+        bzip2_stream::bzip2_ostream zostream(compressed, 9);
+        zostream.write(data.data(), data.size());
+    }
+    std::string bytes = compressed.str();
+
+    // the block magic after the stream header is followed by the false one
+    bool eos = true;
+    uint64_t numBits = 8 * bytes.size();
+    unsigned char const * begin = reinterpret_cast<unsigned char const *>(bytes.data());
+    SEQAN_ASSERT_EQ(_bzip2FindMagic(eos, begin, numBits, 0), 8 * BZIP2_HEADER_LENGTH);
+    SEQAN_ASSERT_NOT(eos);
+    SEQAN_ASSERT_EQ(_bzip2FindMagic(eos, begin, numBits, 8 * BZIP2_HEADER_LENGTH + 1),
+                    8 * BZIP2_HEADER_LENGTH + BZIP2_MAGIC_BITS + 22);
+    SEQAN_ASSERT_NOT(eos);
+
+    std::stringstream input(bytes);
+    bzip2_parallel_istream zistream(input, 2, 2);
+    std::stringstream sstr;
+    sstr << zistream.rdbuf();
+    SEQAN_ASSERT(sstr.str() == data);
+}
+#endif  // #if SEQAN_HAS_BZIP2
+
+#if SEQAN_HAS_ZSTD
+SEQAN_TEST(ZstdStreamTest, Seek)
+{
+    CharString buffer;
+    for (unsigned i = 0; i != 10000; ++i)
+    {
+        appendNumber(buffer, i);
+        append(buffer, FASTQ_EXAMPLE);
+    }
+
+    // Small frames such that the seek table has many entries.
+    std::stringstream compressed;
+    {
+        zstd_stream::zstd_ostream zostream(compressed, 3, 10000);
+        zostream.write(toCString(buffer), length(buffer));
+        SEQAN_ASSERT(zostream.zfinish().good());
+    }
+
+    std::stringstream input(compressed.str());
+    zstd_stream::zstd_istream zistream(input, 1000, 1000);
+    std::stringstream sstr;
+    sstr << zistream.rdbuf();
+    SEQAN_ASSERT_EQ(CharString(sstr.str()), buffer);
+
+    // Jump backwards and forwards, into the current buffer, to frame begins and to the end.
+    unsigned positions[] = {123456, 5, 10000, 10001, 99999, 10002, 0, (unsigned)length(buffer) - 2};
+    for (unsigned i = 0; i < sizeof(positions) / sizeof(unsigned); ++i)
+    {
+        zistream.clear();
+        SEQAN_ASSERT(zistream.seekg(positions[i]).good());
+        SEQAN_ASSERT_EQ((unsigned)zistream.tellg(), positions[i]);
+        char c = 0;
+        SEQAN_ASSERT(zistream.get(c).good());
+        SEQAN_ASSERT_EQ(c, buffer[positions[i]]);
+        SEQAN_ASSERT(zistream.get(c).good());
+        SEQAN_ASSERT_EQ(c, buffer[positions[i] + 1]);
+    }
+}
+#endif  // #if SEQAN_HAS_ZSTD
+
 #endif // ndef TEST_STREAM_TEST_VIRTUAL_STREAM_H_
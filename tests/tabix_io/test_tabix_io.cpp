@@ -41,5 +41,8 @@
 SEQAN_BEGIN_TESTSUITE(test_tabix_io)
 {
     SEQAN_CALL_TEST(test_tabix_io_read_indexed_vcf);
+    SEQAN_CALL_TEST(test_tabix_io_build);
+    SEQAN_CALL_TEST(test_tabix_io_save);
+    SEQAN_CALL_TEST(test_tabix_io_view_records);
 }
 SEQAN_END_TESTSUITE
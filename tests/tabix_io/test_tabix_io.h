@@ -116,11 +116,132 @@ SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
     SEQAN_ASSERT_NOT(atEnd(vcfFile));
 }
 
+// Compare the bins, linear index, and names of two indices.
+inline void
+_compareTabixIndices(seqan2::TabixIndex const & lhs, seqan2::TabixIndex const & rhs)
+{
+    SEQAN_ASSERT_EQ(lhs.format, rhs.format);
+    SEQAN_ASSERT_EQ(lhs.colSeq, rhs.colSeq);
+    SEQAN_ASSERT_EQ(lhs.colBeg, rhs.colBeg);
+    SEQAN_ASSERT_EQ(lhs.colEnd, rhs.colEnd);
+    SEQAN_ASSERT_EQ(lhs.meta, rhs.meta);
+    SEQAN_ASSERT_EQ(lhs.skip, rhs.skip);
+    SEQAN_ASSERT_EQ(length(lhs._nameStore), length(rhs._nameStore));
+    for (unsigned i = 0; i < length(lhs._nameStore); ++i)
+        SEQAN_ASSERT_EQ(lhs._nameStore[i], rhs._nameStore[i]);
+
+    SEQAN_ASSERT_EQ(length(lhs._binIndices), length(rhs._binIndices));
+    for (unsigned i = 0; i < length(lhs._binIndices); ++i)
+    {
+        SEQAN_ASSERT_EQ(lhs._binIndices[i].size(), rhs._binIndices[i].size());
+        for (auto const & bin : lhs._binIndices[i])
+        {
+            auto it = rhs._binIndices[i].find(bin.first);
+            SEQAN_ASSERT(it != rhs._binIndices[i].end());
+            SEQAN_ASSERT(bin.second.chunkBegEnds == it->second.chunkBegEnds);
+        }
+        SEQAN_ASSERT(lhs._linearIndices[i] == rhs._linearIndices[i]);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_build)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+    seqan2::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan2::TabixIndex expected(toCString(tbiPath));
+
+    seqan2::TabixIndex index;
+    setPreset(index, seqan2::TABIX_PRESET_VCF);
+    SEQAN_ASSERT(build(index, toCString(vcfPath)));
+    _compareTabixIndices(index, expected);
+
+    // The result does not depend on the number of threads and the batch size.
+    seqan2::ExecutionPolicy<seqan2::Parallel, seqan2::Serial> parallelPolicy;
+    setNumThreads(parallelPolicy, 4);
+    seqan2::TabixIndex parIndex;
+    setPreset(parIndex, seqan2::TABIX_PRESET_VCF);
+    SEQAN_ASSERT(build(parIndex, toCString(vcfPath), parallelPolicy));
+    _compareTabixIndices(parIndex, expected);
+
+    for (unsigned threads = 1; threads <= 5; ++threads)
+    {
+        seqan2::TabixIndex batchIndex;
+        setPreset(batchIndex, seqan2::TABIX_PRESET_VCF);
+        SEQAN_ASSERT(_tabixBuild(batchIndex, toCString(vcfPath), threads, 1));
+        _compareTabixIndices(batchIndex, expected);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_save)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+    seqan2::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan2::TabixIndex expected(toCString(tbiPath));
+
+    seqan2::CharString outPath = SEQAN_TEMP_FILENAME();
+    append(outPath, ".tbi");
+    SEQAN_ASSERT(save(expected, toCString(outPath)));
+
+    seqan2::TabixIndex index(toCString(outPath));
+    _compareTabixIndices(index, expected);
+    SEQAN_ASSERT_EQ(index.unalignedCount, expected.unalignedCount);
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_view_records)
+{
+    seqan2::CharString vcfPath = seqan2::getAbsolutePath("/tests/tabix_io/test.vcf.gz");
+    seqan2::VcfFileIn vcfFile(toCString(vcfPath));
+    seqan2::VcfHeader header;
+    readHeader(header, vcfFile);
+
+    seqan2::CharString tbiPath = vcfPath;
+    append(tbiPath, ".tbi");
+    seqan2::TabixIndex tabixIndex(toCString(tbiPath));
+
+    seqan2::String<seqan2::VcfRecord> records;
+    SEQAN_ASSERT(viewRecords(records, vcfFile, tabixIndex, "chr1", 66441, 66442));
+    SEQAN_ASSERT_EQ(length(records), 2u);
+    SEQAN_ASSERT_EQ(records[0].beginPos, 66441);
+    SEQAN_ASSERT_EQ(records[1].beginPos, 66441);
+
+    clear(records);
+    SEQAN_ASSERT(viewRecords(records, vcfFile, tabixIndex, "chr7", 62368, 62370));
+    SEQAN_ASSERT_EQ(length(records), 1u);
+    SEQAN_ASSERT_EQ(records[0].beginPos, 62369);
+
+    clear(records);
+    SEQAN_ASSERT(viewRecords(records, vcfFile, tabixIndex, "chr7", 62368, 62369));
+    SEQAN_ASSERT(empty(records));
+
+    SEQAN_ASSERT_NOT(viewRecords(records, vcfFile, tabixIndex, "chr8", 62368, 62370));
+
+    // The whole contig.
+    SEQAN_ASSERT(viewRecords(records, vcfFile, tabixIndex, "chr21", 0, std::numeric_limits<int32_t>::max()));
+    SEQAN_ASSERT_EQ(length(records), 100u);
+}
+
 #else // SEQAN_HAS_ZLIB
 SEQAN_DEFINE_TEST(test_tabix_io_read_indexed_vcf)
 {
     SEQAN_SKIP_TEST;
 }
+
+SEQAN_DEFINE_TEST(test_tabix_io_build)
+{
+    SEQAN_SKIP_TEST;
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_save)
+{
+    SEQAN_SKIP_TEST;
+}
+
+SEQAN_DEFINE_TEST(test_tabix_io_view_records)
+{
+    SEQAN_SKIP_TEST;
+}
 #endif // SEQAN_HAS_ZLIB
 
 
@@ -39,6 +39,9 @@
 #
 #   ZLIB    -- zlib compression library
 #   BZip2   -- libbz2 compression library
+#   libdeflate -- whole-buffer DEFLATE library, used for reading BGZF blocks if found
+#                 (define SEQAN_BGZF_LIBDEFLATE_COMPRESSION to also use it for writing)
+#   zstd    -- Zstandard compression library
 #   OpenMP  -- OpenMP language extensions to C/C++
 #
 # E.g.
@@ -56,6 +59,8 @@
 #
 #  SEQAN_HAS_ZLIB
 #  SEQAN_HAS_BZIP2
+#  SEQAN_HAS_LIBDEFLATE
+#  SEQAN_HAS_ZSTD
 #  SEQAN_HAS_OPENMP
 #
 # These variables give lists that are to be passed to the
@@ -108,6 +113,8 @@ endif ()
 # If you want to force-require these, just do find_package (zlib REQUIRED), etc. before find_package (seqan)
 option (SEQAN_NO_ZLIB "Don't use ZLIB, even if present." OFF)
 option (SEQAN_NO_BZIP2 "Don't use BZip2, even if present." OFF)
+option (SEQAN_NO_LIBDEFLATE "Don't use libdeflate, even if present." OFF)
+option (SEQAN_NO_ZSTD "Don't use zstd, even if present." OFF)
 option (SEQAN_NO_OPENMP "Don't use OpenMP, even if present." OFF)
 
 # ----------------------------------------------------------------------------
@@ -358,6 +365,41 @@ if (BZIP2_FOUND)
     set (SEQAN_DEFINITIONS       ${SEQAN_DEFINITIONS}       "-DSEQAN_HAS_BZIP2=1")
 endif ()
 
+# libdeflate
+
+set (SEQAN_HAS_LIBDEFLATE FALSE)
+
+# NOTE: libdeflate only replaces zlib for the independent BGZF blocks, all other formats still need ZLIB.
+if (ZLIB_FOUND AND NOT SEQAN_NO_LIBDEFLATE)
+    find_path (LIBDEFLATE_INCLUDE_DIR NAMES libdeflate.h)
+    find_library (LIBDEFLATE_LIBRARY NAMES deflate libdeflate)
+    mark_as_advanced (LIBDEFLATE_INCLUDE_DIR LIBDEFLATE_LIBRARY)
+endif ()
+
+if (LIBDEFLATE_INCLUDE_DIR AND LIBDEFLATE_LIBRARY AND ZLIB_FOUND AND NOT SEQAN_NO_LIBDEFLATE)
+    set (SEQAN_HAS_LIBDEFLATE    TRUE)
+    set (SEQAN_LIBRARIES         ${SEQAN_LIBRARIES}         ${LIBDEFLATE_LIBRARY})
+    set (SEQAN_INCLUDE_DIRS_DEPS ${SEQAN_INCLUDE_DIRS_DEPS} ${LIBDEFLATE_INCLUDE_DIR})
+    set (SEQAN_DEFINITIONS       ${SEQAN_DEFINITIONS}       "-DSEQAN_HAS_LIBDEFLATE=1")
+endif ()
+
+# zstd
+
+set (SEQAN_HAS_ZSTD FALSE)
+
+if (NOT SEQAN_NO_ZSTD)
+    find_path (ZSTD_INCLUDE_DIR NAMES zstd.h)
+    find_library (ZSTD_LIBRARY NAMES zstd libzstd)
+    mark_as_advanced (ZSTD_INCLUDE_DIR ZSTD_LIBRARY)
+endif ()
+
+if (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY AND NOT SEQAN_NO_ZSTD)
+    set (SEQAN_HAS_ZSTD          TRUE)
+    set (SEQAN_LIBRARIES         ${SEQAN_LIBRARIES}         ${ZSTD_LIBRARY})
+    set (SEQAN_INCLUDE_DIRS_DEPS ${SEQAN_INCLUDE_DIRS_DEPS} ${ZSTD_INCLUDE_DIR})
+    set (SEQAN_DEFINITIONS       ${SEQAN_DEFINITIONS}       "-DSEQAN_HAS_ZSTD=1")
+endif ()
+
 # OpenMP
 
 set (SEQAN_HAS_OPENMP FALSE)
@@ -497,6 +539,8 @@ if (SEQAN_FIND_DEBUG)
   message("  SEQAN_FOUND                ${SEQAN_FOUND}")
   message("  SEQAN_HAS_ZLIB             ${SEQAN_HAS_ZLIB}")
   message("  SEQAN_HAS_BZIP2            ${SEQAN_HAS_BZIP2}")
+  message("  SEQAN_HAS_LIBDEFLATE       ${SEQAN_HAS_LIBDEFLATE}")
+  message("  SEQAN_HAS_ZSTD             ${SEQAN_HAS_ZSTD}")
   message("  SEQAN_HAS_OPENMP           ${SEQAN_HAS_OPENMP}")
   message("")
   message("  SEQAN_INCLUDE_DIRS         ${SEQAN_INCLUDE_DIRS}")